@@ -0,0 +1,91 @@
+#ifndef ARRAY_DEQUE_H
+#define ARRAY_DEQUE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "exit_codes.h"
+#include "utilities/destroy.h"
+#include "utilities/comparisons.h"
+
+#define ARRAY_DEQUE_INITIAL_CAPACITY 8 // must be a power of two
+
+typedef struct array_deque array_deque_t;
+
+/// @brief Creates a deque of pointers backed by a circular buffer. Pushes and pops at either end are
+///        O(1) (amortized when the buffer grows) and elements are reached by logical index.
+/// @param destroy Called when an element is removed (may be NULL).
+/// @param equal Used to search the deque (may be NULL).
+/// @return array_deque_t (NULL on failure).
+array_deque_t *array_deque_create(const destroy_ctx *destroy, const equal_ctx *equal);
+
+/// @brief Creates a deque that stores its elements by value.
+/// @param element_size The size in bytes of a single element.
+/// @param destroy Called with the address of an element's slot when it is removed (may be NULL).
+/// @param equal Called with the address of an element's slot and the searched-for data (may be NULL).
+/// @return array_deque_t (NULL on failure).
+array_deque_t *array_deque_create_typed(size_t element_size, const destroy_ctx *destroy, const equal_ctx *equal);
+
+/// @brief Adds an element before the first one.
+/// @param deque The deque to modify.
+/// @param data The data to be added (copied for typed deques).
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t array_deque_push_front(array_deque_t *deque, void *data);
+
+/// @brief Adds an element after the last one.
+/// @param deque The deque to modify.
+/// @param data The data to be added (copied for typed deques).
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t array_deque_push_back(array_deque_t *deque, void *data);
+
+/// @brief Removes the first element.
+/// @param deque The deque to modify.
+/// @param out Receives the element (the stored pointer for pointer deques) without destroying it.
+///        If NULL, the element is destroyed instead.
+/// @return exit_code_t (E_SUCCESS for success, E_LIST_ERROR if the deque is NULL or empty).
+exit_code_t array_deque_pop_front(array_deque_t *deque, void *out);
+
+/// @brief Removes the last element.
+/// @param deque The deque to modify.
+/// @param out Receives the element (the stored pointer for pointer deques) without destroying it.
+///        If NULL, the element is destroyed instead.
+/// @return exit_code_t (E_SUCCESS for success, E_LIST_ERROR if the deque is NULL or empty).
+exit_code_t array_deque_pop_back(array_deque_t *deque, void *out);
+
+/// @brief Gets an element by logical index (0 is the front).
+/// @param deque The deque to read from.
+/// @param index The index of the element.
+/// @return The stored pointer for pointer deques, or the slot address for typed deques (NULL if out
+///         of range). Slot addresses are only valid until the next push.
+void *array_deque_get(array_deque_t *deque, size_t index);
+
+/// @brief Replaces an element by logical index, destroying the old one.
+/// @param deque The deque to modify.
+/// @param index The index of the element.
+/// @param data The new data (copied for typed deques).
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t array_deque_set(array_deque_t *deque, size_t index, void *data);
+
+/// @brief Checks whether the deque holds an element equal to data.
+/// @param deque The deque to search.
+/// @param data The data to look for.
+/// @return true if a match was found.
+bool array_deque_contains(array_deque_t *deque, void *data);
+
+/// @brief Gets the number of elements in the deque.
+/// @param deque The deque to query.
+/// @return The number of elements (0 if the deque is NULL).
+size_t array_deque_size(array_deque_t *deque);
+
+/// @brief Checks whether the deque is empty.
+/// @param deque The deque to query.
+/// @return true if the deque holds no elements.
+bool array_deque_is_empty(array_deque_t *deque);
+
+/// @brief Destroys every element and the deque, and sets the caller's pointer to NULL.
+/// @param deque The address of the deque.
+void array_deque_destroy(array_deque_t **deque);
+
+#endif
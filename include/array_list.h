@@ -5,33 +5,288 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 #include "exit_codes.h"
 #include "utilities/destroy.h"
 #include "utilities/comparisons.h"
+#include "utilities/hash.h"
+#include "utilities/predicate.h"
+#include "frozen_search.h"
 
 #define INITIAL_CAPACITY 5
+#define DEFAULT_GROWTH_FACTOR 2.0
+#define DEFAULT_MMAP_THRESHOLD (64 * 1024 * 1024)
+#define PARALLEL_DESTROY_THRESHOLD 65536 // ranges smaller than this are always destroyed on the calling thread
+#define ARRAY_LIST_MAX_DESTROY_THREADS 64 // destroy_threads is capped at this
 
 typedef struct array_list array_list_t;
 
+// An immutable view of an array list's elements at one point in time, safe to read from any thread
+typedef struct array_list_snapshot array_list_snapshot_t;
+
+/// @brief Create-time settings for an array list. Zeroed fields select the defaults.
+typedef struct array_list_options
+{
+    size_t initial_capacity; // Slots allocated up front (0 selects INITIAL_CAPACITY)
+    double growth_factor;    // Capacity multiplier when full, must be > 1 (0 selects DEFAULT_GROWTH_FACTOR)
+    size_t growth_chunk;     // When non-zero, grow by this many slots instead of multiplying
+    size_t element_size;     // 0 for a pointer list, otherwise the size of an element stored by value
+    size_t mmap_threshold;   // Buffer size in bytes from which growth uses mremap (0 selects DEFAULT_MMAP_THRESHOLD,
+                             // SIZE_MAX disables it). Only used on Linux.
+    const hash_ctx *hash;    // When set, a hash index gives O(1) contains/index_of. Must agree with equal.
+    const compare_ctx *order; // When set, the list is kept sorted by this comparator (see array_list_create_sorted)
+    bool unique;              // Sorted lists only: reject elements that compare equal to one already stored
+    size_t destroy_threads;   // When > 1, large ranges are destroyed by this many threads at once. The destroy
+                              // callbacks must then be thread-safe.
+    bool destroy_in_background; // array_list_destroy hands the elements to a detached thread and returns at once
+} array_list_options_t;
+
 array_list_t *array_list_create(const destroy_ctx *destroy, const equal_ctx *equal);
 
+/// @brief Creates an array list that stores its elements by value, side by side in one buffer.
+/// @param element_size The size in bytes of a single element.
+/// @param destroy Called with the address of an element's slot when it is removed (may be NULL).
+/// @param equal Called with the address of an element's slot and the searched-for data (may be NULL).
+/// @return array_list_t (NULL on failure).
+/// @note insert/set/push copy element_size bytes from the data pointer. array_list_get returns the
+///       address of the element's slot, which is only valid until the next insert or remove.
+array_list_t *array_list_create_typed(size_t element_size, const destroy_ctx *destroy, const equal_ctx *equal);
+
+/// @brief Creates an array list with a custom initial capacity, growth policy and element size.
+/// @param options The settings to use (NULL selects the defaults).
+/// @param destroy Called when an element is removed (may be NULL).
+/// @param equal Used to search the list (may be NULL).
+/// @return array_list_t (NULL on failure or invalid options).
+array_list_t *array_list_create_with_options(const array_list_options_t *options, const destroy_ctx *destroy, const equal_ctx *equal);
+
+/// @brief Creates a pointer list that keeps its elements ordered on every insert.
+/// @param compare Orders two stored pointers.
+/// @param destroy Called on an element when it is removed (may be NULL).
+/// @return array_list_t (NULL on failure).
+/// @note push inserts at the sorted position. push_many sorts the batch and merges it in with one pass
+///       over the list (O(n + k log k)), equal elements landing after stored ones in the batch's order;
+///       with options.unique it keeps the elements before the first duplicate and fails there. A
+///       positional insert or set that would break the order fails with E_OUT_OF_ORDER; with
+///       options.unique, an element equal to one already stored fails with E_KEY_ALREADY_EXISTS. contains, index_of and count use binary
+///       search on sorted lists and do not need an equal_ctx.
+array_list_t *array_list_create_sorted(const compare_ctx *compare, const destroy_ctx *destroy);
+
 exit_code_t array_list_insert(array_list_t *list, size_t index, void *data);
 
 exit_code_t push(array_list_t *list, void *data);
 
+/// @brief Appends several elements with at most one reallocation.
+/// @param list The list to append to.
+/// @param data An array of count elements (void * for pointer lists, values for typed lists).
+/// @param count The number of elements to append.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t array_list_push_many(array_list_t *list, const void *data, size_t count);
+
+/// @brief Inserts several elements at an index with at most one reallocation and one move.
+/// @param list The list to insert into.
+/// @param index The index at which the first element is placed.
+/// @param data An array of count elements (void * for pointer lists, values for typed lists).
+/// @param count The number of elements to insert.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t array_list_insert_range(array_list_t *list, size_t index, const void *data, size_t count);
+
 exit_code_t array_list_remove(array_list_t *list, size_t index);
 
+/// @brief Removes count elements starting at index, destroying them in one pass and closing the gap once.
+/// @param list The list to remove from.
+/// @param index The index of the first element to remove.
+/// @param count The number of elements to remove.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t array_list_remove_range(array_list_t *list, size_t index, size_t count);
+
+/// @brief Copies an element out of the list and removes it without destroying it.
+/// @param list The list to remove from.
+/// @param index The index of the element.
+/// @param out Receives the element (the stored pointer for pointer lists), may be NULL.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t array_list_remove_value(array_list_t *list, size_t index, void *out);
+
+/// @brief Removes and destroys every element the predicate accepts, keeping the others in order.
+///        Runs in one pass, moving each kept element at most once.
+/// @param list The list to filter.
+/// @param predicate Called like equal (slot address for typed lists, stored pointer otherwise).
+/// @param removed Receives the number of elements removed (may be NULL).
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t array_list_remove_if(array_list_t *list, const predicate_ctx *predicate, size_t *removed);
+
+/// @brief Moves every element the predicate accepts in front of every element it rejects, in one pass
+///        of swaps. The order within each group is not kept.
+/// @param list The list to partition.
+/// @param predicate Called like equal (slot address for typed lists, stored pointer otherwise).
+/// @param split Receives the number of accepted elements, which is the index of the first rejected one.
+/// @return exit_code_t (E_SUCCESS for success, E_OUT_OF_ORDER for sorted lists).
+exit_code_t array_list_partition(array_list_t *list, const predicate_ctx *predicate, size_t *split);
+
+/// @brief Applies map to every element in place.
+/// @param list The list to modify.
+/// @param map Called with each slot's address for typed lists, which it updates in place (its return value
+///        is ignored), or with each stored pointer for pointer lists, which is replaced by the non-NULL
+///        pointer it returns. Replaced pointers are not destroyed by the list.
+/// @return exit_code_t (E_SUCCESS for success, E_NULL_POINTER if map returns NULL for a pointer list,
+///         leaving the elements after it unmapped, E_OUT_OF_ORDER for sorted lists).
+exit_code_t array_list_map_inplace(array_list_t *list, const map_ctx *map);
+
+/// @brief Removes and destroys every element equal to the one before it, keeping the first of each run.
+///        Sort first to remove all duplicates. Runs in one pass.
+/// @param list The list to modify. Uses the list's equal, or its order for sorted lists.
+/// @param removed Receives the number of elements removed (may be NULL).
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t array_list_unique(array_list_t *list, size_t *removed);
+
 bool array_list_contains(array_list_t *list, void *data);
 
+/// @brief Finds the first element equal to data.
+/// @param list The list to search.
+/// @param data The data to look for.
+/// @param index Receives the index of the first match.
+/// @return exit_code_t (E_SUCCESS if found, E_KEY_NOT_FOUND if not, anything else is a failure).
+exit_code_t array_list_index_of(array_list_t *list, void *data, size_t *index);
+
+/// @brief Counts the elements equal to data.
+/// @param list The list to search.
+/// @param data The data to look for.
+/// @return The number of matches (0 if list, data or the list's equal is NULL).
+/// @note Pointer lists compared with raw_int_eq_ctx, raw_size_t_eq_ctx or naive_eq_ctx are scanned
+///       with SIMD instead of calling equal per element; the same applies to contains/index_of.
+size_t array_list_count(array_list_t *list, void *data);
+
+/// @brief Finds the first element of a sorted list that does not order before data.
+/// @param list The sorted list to search.
+/// @param data The data to look for.
+/// @param index Receives the position (the list size if every element orders before data).
+/// @return exit_code_t (E_SUCCESS for success, E_INVALID_INPUT if the list is not sorted).
+exit_code_t array_list_lower_bound(array_list_t *list, void *data, size_t *index);
+
+/// @brief Finds the first element of a sorted list that orders after data.
+/// @param list The sorted list to search.
+/// @param data The data to look for.
+/// @param index Receives the position (the list size if no element orders after data).
+/// @return exit_code_t (E_SUCCESS for success, E_INVALID_INPUT if the list is not sorted).
+exit_code_t array_list_upper_bound(array_list_t *list, void *data, size_t *index);
+
+/// @brief Finds the elements of a sorted list that compare equal to data.
+/// @param list The sorted list to search.
+/// @param data The data to look for.
+/// @param first Receives the lower bound.
+/// @param last Receives the upper bound (equal to first if there are no matches).
+/// @return exit_code_t (E_SUCCESS for success, E_INVALID_INPUT if the list is not sorted).
+exit_code_t array_list_equal_range(array_list_t *list, void *data, size_t *first, size_t *last);
+
+/// @brief Sorts the list in place with introsort.
+/// @param list The list to sort.
+/// @param compare Orders two elements; called like equal (slot address for typed lists, stored pointer
+///        otherwise) and always with its own ctx.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+/// @note Sorted lists only accept their own comparator (a no-op); any other fails with E_OUT_OF_ORDER.
+exit_code_t array_list_sort(array_list_t *list, const compare_ctx *compare);
+
+/// @brief Sorts the list in place with a multi-threaded merge sort.
+/// @param list The list to sort.
+/// @param compare Orders two elements, as for array_list_sort. Must be safe to call from several threads.
+/// @param threads The number of threads to use (0 to use one per online CPU).
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+/// @note Lists below PARALLEL_SORT_THRESHOLD elements are sorted on the calling thread.
+exit_code_t array_list_sort_parallel(array_list_t *list, const compare_ctx *compare, size_t threads);
+
+/// @brief Builds a read-only Eytzinger-layout copy of the list for fast repeated lower_bound queries.
+/// @param list The list to copy. It is left unchanged and may be modified or destroyed afterwards.
+/// @param compare Orders an element against a key, called like array_list_sort's comparator.
+/// @return frozen_search_t (NULL on failure). Ranks it reports are positions in the list sorted by compare.
+/// @note A pointer list's frozen copy holds the same pointers; the data must outlive it.
+frozen_search_t *array_list_freeze_search(array_list_t *list, const compare_ctx *compare);
+
 void *array_list_get(array_list_t *list, size_t index);
 
+/// @brief Copies an element out of the list.
+/// @param list The list to read from.
+/// @param index The index of the element.
+/// @param out Receives the element (the stored pointer for pointer lists).
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t array_list_get_value(array_list_t *list, size_t index, void *out);
+
 exit_code_t array_list_set(array_list_t *list, size_t index, void *data);
 
 size_t array_list_size(array_list_t *list);
 
 bool array_list_is_empty(array_list_t *list);
 
+/// @brief Gets the number of elements the list can hold before it has to grow.
+/// @param list The list to query.
+/// @return The capacity of the list (0 if the list is NULL).
+size_t array_list_capacity(array_list_t *list);
+
+/// @brief Grows the list to hold at least capacity elements with a single reallocation.
+/// @param list The list to grow.
+/// @param capacity The number of elements to make room for.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t array_list_reserve(array_list_t *list, size_t capacity);
+
+/// @brief Releases unused capacity so the buffer holds only the current elements.
+/// @param list The list to shrink.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t array_list_shrink_to_fit(array_list_t *list);
+
+/// @brief Takes a read-only snapshot of the list that shares its buffer until the list is next written to.
+/// @param list The list to snapshot. Only the thread that writes to the list may call this.
+/// @return array_list_snapshot_t (NULL on failure), holding one reference for the caller.
+/// @note The first write after a snapshot copies the buffer, unless every reference has been released by then.
+/// @note Element data is shared, not copied: removing a pointer (or an element whose destroy frees memory)
+///       destroys data the snapshot still points at.
+array_list_snapshot_t *array_list_snapshot(array_list_t *list);
+
+/// @brief Adds a reference to a snapshot, for example to hand it to another reader.
+/// @param snapshot A snapshot the caller already holds a reference to.
+/// @return The same snapshot.
+array_list_snapshot_t *array_list_snapshot_retain(array_list_snapshot_t *snapshot);
+
+/// @brief Drops a reference to a snapshot; the last one frees the buffer. Safe to call from any thread.
+/// @param snapshot The snapshot to release. Set to NULL on return.
+void array_list_snapshot_release(array_list_snapshot_t **snapshot);
+
+/// @brief Reads an element of a snapshot.
+/// @param snapshot The snapshot to read from.
+/// @param index The index of the element.
+/// @return The address of the element for typed lists, the stored pointer for pointer lists (NULL if out of bounds).
+const void *array_list_snapshot_get(const array_list_snapshot_t *snapshot, size_t index);
+
+/// @brief Gets the number of elements in a snapshot.
+/// @param snapshot The snapshot to query.
+/// @return The number of elements (0 if the snapshot is NULL).
+size_t array_list_snapshot_size(const array_list_snapshot_t *snapshot);
+
+/// @brief Writes a typed list to a file that array_list_map can later use in place.
+/// @param list The typed list to save. Pointer lists are rejected with E_INVALID_INPUT.
+/// @param path The file to write. It is replaced atomically, so a list mapped from it stays valid.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+/// @note The file holds a header (element size, count, checksum) and then the raw elements, starting on a
+///       page boundary. Elements are stored in the machine's own byte order and layout.
+exit_code_t array_list_save(array_list_t *list, const char *path);
+
+/// @brief Opens a file written by array_list_save as a typed list, mapping it read-only without copying.
+/// @param path The file to map.
+/// @param destroy Destroys elements as they are removed (NULL for none).
+/// @param equal Compares elements (NULL for none).
+/// @return array_list_t (NULL on failure or if the header does not match the file).
+/// @note The first write to the list copies it off the file, which is never modified. The checksum is not
+///       checked here, since that would read every page; use array_list_verify_file for that. Needs a
+///       POSIX mmap; elsewhere this always returns NULL.
+array_list_t *array_list_map(const char *path, const destroy_ctx *destroy, const equal_ctx *equal);
+
+/// @brief Checks that a file written by array_list_save is intact.
+/// @param path The file to check.
+/// @return exit_code_t (E_SUCCESS if the header and checksum match, anything else is considered a failure).
+exit_code_t array_list_verify_file(const char *path);
+
 void array_list_destroy(array_list_t **list);
 
+/// @brief Blocks until every destroy handed to a background thread by array_list_destroy has finished.
+/// @note Call before exit if the destroy callbacks must all run (for example, to flush resources).
+void array_list_wait_for_background_destroys(void);
+
 #endif
\ No newline at end of file
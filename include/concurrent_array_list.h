@@ -0,0 +1,53 @@
+#ifndef CONCURRENT_ARRAY_LIST_H
+#define CONCURRENT_ARRAY_LIST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include "exit_codes.h"
+#include "utilities/destroy.h"
+#include "utilities/comparisons.h"
+
+typedef struct concurrent_array_list concurrent_array_list_t;
+
+/// @brief Creates an append-only array list that many threads can push to without a lock.
+///        Slots are reserved with a fetch-and-add and storage grows in power-of-two segments that
+///        are installed with a compare-and-swap, so elements are never moved once written.
+/// @param destroy Called for every element when the list is destroyed (may be NULL).
+/// @param equal Used to search the list (may be NULL).
+/// @return concurrent_array_list_t (NULL on failure).
+concurrent_array_list_t *concurrent_list_create(const destroy_ctx *destroy, const equal_ctx *equal);
+
+/// @brief Appends an element. Safe to call from any number of threads at once.
+/// @param list The list to append to.
+/// @param data The data to be added.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+/// @note If a segment cannot be allocated the reserved slot is never filled, and elements pushed
+///       after it are not published.
+exit_code_t concurrent_list_push(concurrent_array_list_t *list, void *data);
+
+/// @brief Gets an element of the published prefix. Safe to call while other threads push.
+/// @param list The list to read from.
+/// @param index The index of the element.
+/// @return The element, or NULL if index is not below concurrent_list_size().
+void *concurrent_list_get(concurrent_array_list_t *list, size_t index);
+
+/// @brief Gets the length of the published prefix: every index below it holds a fully written element.
+///        Safe to call while other threads push; the value only ever grows.
+/// @param list The list to query.
+/// @return The number of published elements (0 if the list is NULL).
+size_t concurrent_list_size(concurrent_array_list_t *list);
+
+/// @brief Checks whether the published prefix holds an element equal to data.
+/// @param list The list to search.
+/// @param data The data to look for.
+/// @return true if a match was found.
+bool concurrent_list_contains(concurrent_array_list_t *list, void *data);
+
+/// @brief Destroys every element, releases all segments and the list itself.
+///        Must not run concurrently with any other call on the list.
+/// @param list The address of the list.
+void concurrent_list_destroy(concurrent_array_list_t **list);
+
+#endif
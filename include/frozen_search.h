@@ -0,0 +1,60 @@
+#ifndef FROZEN_SEARCH_H
+#define FROZEN_SEARCH_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "exit_codes.h"
+#include "utilities/comparisons.h"
+
+#define FROZEN_SEARCH_BATCH 8 // lookups a batch search keeps in flight at once
+
+typedef struct frozen_search frozen_search_t;
+
+/// @brief Builds a read-only search structure from sorted elements. The elements are copied into
+///        Eytzinger (breadth-first) order, so the first levels of every search share a few cache
+///        lines and the next levels can be prefetched while the current one is compared.
+/// @param sorted The elements, in ascending order by compare.
+/// @param count The number of elements.
+/// @param element_size The size in bytes of an element stored by value, or 0 for an array of pointers.
+/// @param compare Orders an element (its address, or the stored pointer when element_size is 0) against
+///        a key. The struct is copied; its ctx must outlive the structure.
+/// @return frozen_search_t (NULL on failure).
+/// @note Pointer elements are not owned; the data they point to must outlive the structure.
+frozen_search_t *frozen_search_create(const void *sorted, size_t count, size_t element_size, const compare_ctx *compare);
+
+/// @brief Finds the rank (position in sorted order) of the first element that does not order before key.
+/// @param search The structure to search.
+/// @param key The key to look for.
+/// @param rank Receives the rank (the element count if every element orders before key).
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t frozen_search_lower_bound(frozen_search_t *search, const void *key, size_t *rank);
+
+/// @brief Runs lower_bound for many keys, interleaving up to FROZEN_SEARCH_BATCH searches so their
+///        cache misses overlap.
+/// @param search The structure to search.
+/// @param keys The keys to look for.
+/// @param num_keys The number of keys.
+/// @param ranks Receives one rank per key.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t frozen_search_lower_bound_batch(frozen_search_t *search, const void *const *keys, size_t num_keys,
+                                            size_t *ranks);
+
+/// @brief Checks whether an element compares equal to key.
+/// @param search The structure to search.
+/// @param key The key to look for.
+/// @return true if found, false otherwise (or on NULL input).
+bool frozen_search_contains(frozen_search_t *search, const void *key);
+
+/// @brief Gets the number of elements.
+/// @param search The structure.
+/// @return The number of elements (0 if search is NULL).
+size_t frozen_search_size(frozen_search_t *search);
+
+/// @brief Frees the structure and sets the caller's pointer to NULL.
+/// @param search The structure to destroy.
+void frozen_search_destroy(frozen_search_t **search);
+
+#endif
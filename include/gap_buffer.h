@@ -0,0 +1,87 @@
+#ifndef GAP_BUFFER_H
+#define GAP_BUFFER_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "exit_codes.h"
+#include "utilities/destroy.h"
+#include "utilities/comparisons.h"
+
+#define GAP_BUFFER_INITIAL_CAPACITY 16
+
+typedef struct gap_buffer gap_buffer_t;
+
+/// @brief Creates a gap buffer of pointers. The free slots sit in a gap at the cursor, so inserts and
+///        deletes at the cursor cost O(1) amortized; moving the cursor costs the distance moved.
+/// @param destroy Called when an element is removed (may be NULL).
+/// @param equal Used to search the buffer (may be NULL).
+/// @return gap_buffer_t (NULL on failure).
+gap_buffer_t *gap_buffer_create(const destroy_ctx *destroy, const equal_ctx *equal);
+
+/// @brief Creates a gap buffer that stores its elements by value.
+/// @param element_size The size in bytes of a single element.
+/// @param destroy Called with the address of an element's slot when it is removed (may be NULL).
+/// @param equal Called with the address of an element's slot and the searched-for data (may be NULL).
+/// @return gap_buffer_t (NULL on failure).
+gap_buffer_t *gap_buffer_create_typed(size_t element_size, const destroy_ctx *destroy, const equal_ctx *equal);
+
+/// @brief Moves the cursor, carrying the gap with it.
+/// @param buffer The buffer to modify.
+/// @param position The new cursor position, from 0 (before the first element) to the size.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t gap_buffer_move_cursor(gap_buffer_t *buffer, size_t position);
+
+/// @brief Gets the cursor position.
+/// @param buffer The buffer to query.
+/// @return The number of elements before the cursor (0 if the buffer is NULL).
+size_t gap_buffer_cursor(gap_buffer_t *buffer);
+
+/// @brief Inserts an element at the cursor and moves the cursor past it.
+/// @param buffer The buffer to modify.
+/// @param data The data to be added (copied for typed buffers).
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t gap_buffer_insert(gap_buffer_t *buffer, void *data);
+
+/// @brief Removes and destroys the element just before the cursor (like backspace).
+/// @param buffer The buffer to modify.
+/// @return exit_code_t (E_SUCCESS for success, E_OUT_OF_BOUNDS if the cursor is at the start).
+exit_code_t gap_buffer_delete_before(gap_buffer_t *buffer);
+
+/// @brief Removes and destroys the element just after the cursor (like delete).
+/// @param buffer The buffer to modify.
+/// @return exit_code_t (E_SUCCESS for success, E_OUT_OF_BOUNDS if the cursor is at the end).
+exit_code_t gap_buffer_delete_after(gap_buffer_t *buffer);
+
+/// @brief Gets an element by its logical index, as if the gap were not there.
+/// @param buffer The buffer to read from.
+/// @param index The index of the element.
+/// @return The stored pointer for pointer buffers, or the slot address for typed buffers (NULL if out
+///         of range). Slot addresses are only valid until the next edit or cursor move.
+void *gap_buffer_get(gap_buffer_t *buffer, size_t index);
+
+/// @brief Replaces an element by its logical index, destroying the old one. The cursor does not move.
+/// @param buffer The buffer to modify.
+/// @param index The index of the element.
+/// @param data The new data (copied for typed buffers).
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t gap_buffer_set(gap_buffer_t *buffer, size_t index, void *data);
+
+/// @brief Checks whether the buffer holds an element equal to data.
+/// @param buffer The buffer to search.
+/// @param data The data to look for.
+/// @return true if a match was found.
+bool gap_buffer_contains(gap_buffer_t *buffer, void *data);
+
+/// @brief Gets the number of elements in the buffer.
+/// @param buffer The buffer to query.
+/// @return The number of elements (0 if the buffer is NULL).
+size_t gap_buffer_size(gap_buffer_t *buffer);
+
+/// @brief Destroys every element and the buffer, and sets the caller's pointer to NULL.
+/// @param buffer The address of the buffer.
+void gap_buffer_destroy(gap_buffer_t **buffer);
+
+#endif
@@ -6,15 +6,37 @@
 #include <stdlib.h>
 
 #include "exit_codes.h"
+#include "utilities/comparisons.h"
+#include "utilities/node_pool.h"
 
 typedef struct csll_node csll_node_t;
 typedef struct circular_singly_linked_list circular_singly_linked_list_t;
 
+// Walks a list and edits it in place without rescanning from the head. Cursors live wherever the caller
+// puts them (usually on the stack) and never allocate. Walking goes round and round the list.
+typedef struct csll_cursor
+{
+    circular_singly_linked_list_t *list;
+    csll_node_t *previous; // node before the cursor (NULL at the head)
+    csll_node_t *current;  // node under the cursor (NULL only in an empty list)
+} csll_cursor_t;
+
 /// @brief Creates a singly-linked list container.
 /// @param  void Takes no parameters.
 /// @return circular_singly_linked_list_t (returns a singly-linked list).
 circular_singly_linked_list_t *csll_create(void);
 
+/// @brief Creates a singly-linked list container whose nodes come from a pool it shares with other lists.
+/// @param pool The pool to take nodes from. It must outlive the list, and its nodes must be at least
+///             csll_node_size() bytes.
+/// @return circular_singly_linked_list_t (NULL on failure or if the pool's nodes are too small).
+/// @note csll_create gives each list a pool of its own instead, released in one go when the list is cleared.
+circular_singly_linked_list_t *csll_create_with_pool(node_pool_t *pool);
+
+/// @brief Gets the size of the list's nodes, for creating a pool to share between lists.
+/// @return The size in bytes of one node.
+size_t csll_node_size(void);
+
 /// @brief Adds a node to the front of a linked list.
 /// @param list The list to append.
 /// @param data The data to be added.
@@ -88,6 +110,48 @@ exit_code_t csll_remove_position(circular_singly_linked_list_t *list, size_t pos
 /// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
 exit_code_t csll_print_list(circular_singly_linked_list_t *list, void (*function_ptr)(void *));
 
+/// @brief Puts a cursor on the head of a linked list.
+/// @param list The list to walk.
+/// @param cursor The cursor to set up. It stays valid until the list is edited other than through it.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t csll_cursor_head(circular_singly_linked_list_t *list, csll_cursor_t *cursor);
+
+/// @brief Moves a cursor to the next node; moving on from the tail wraps around to the head.
+/// @param cursor The cursor to move.
+/// @return exit_code_t (E_SUCCESS for success, E_OUT_OF_BOUNDS if the list is empty).
+exit_code_t csll_cursor_next(csll_cursor_t *cursor);
+
+/// @brief Gets the value under a cursor.
+/// @param cursor The cursor to read.
+/// @return The value under the cursor (NULL if the list is empty).
+void *csll_cursor_get(const csll_cursor_t *cursor);
+
+/// @brief Adds a node just before the cursor, which stays where it is. At the head, the node becomes the
+///        new head; in an empty list, the cursor moves onto it.
+/// @param cursor The cursor to insert at.
+/// @param data The data to be added.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t csll_cursor_insert_before(csll_cursor_t *cursor, void *data);
+
+/// @brief Adds a node just after the cursor, which stays where it is.
+/// @param cursor The cursor to insert at. The list must not be empty.
+/// @param data The data to be added.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t csll_cursor_insert_after(csll_cursor_t *cursor, void *data);
+
+/// @brief Removes the node under the cursor and moves the cursor on to the next node, wrapping at the tail.
+/// @param cursor The cursor to remove at. The list must not be empty.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t csll_cursor_erase(csll_cursor_t *cursor);
+
+/// @brief Sorts a linked list in place by relinking its nodes, without allocating.
+/// @param list The list to sort.
+/// @param compare Orders two values, called with the stored data pointers and its own ctx.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+/// @note Stable, and close to linear on nearly sorted lists (see linked_merge_sort).
+/// @note A tail linked back round to the head stays linked back round to the new head.
+exit_code_t csll_sort(circular_singly_linked_list_t *list, const compare_ctx *compare);
+
 /// @brief Clears all nodes from a linked list.
 /// @param list The address of the list.
 void csll_clear_list(circular_singly_linked_list_t **list);
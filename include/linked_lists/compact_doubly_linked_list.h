@@ -0,0 +1,127 @@
+#ifndef COMPACT_DOUBLY_LINKED_LIST_H
+#define COMPACT_DOUBLY_LINKED_LIST_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "exit_codes.h"
+
+#define CDLL_MIN_CAPACITY 8                // nodes in the first array
+#define CDLL_MAX_CAPACITY (UINT32_MAX - 1) // one index is kept back to mark the end of the list
+
+// A compact doubly-linked list keeps every node in one growable array and links them with 32-bit
+// indexes, so a node is 16 bytes with no allocator overhead and neighbours tend to share cache lines.
+// Freed slots go on a free list for reuse. Copying or freeing the whole list is a single memcpy or free.
+typedef struct compact_doubly_linked_list compact_doubly_linked_list_t;
+
+/// @brief Creates a compact doubly-linked list container.
+/// @param  void Takes no parameters.
+/// @return compact_doubly_linked_list_t (returns a compact doubly-linked list).
+compact_doubly_linked_list_t *cdll_create(void);
+
+/// @brief Copies a list, nodes and all, with a single allocation and memcpy.
+/// @param list The list to copy. The values are shared, not copied.
+/// @return compact_doubly_linked_list_t (NULL on failure).
+compact_doubly_linked_list_t *cdll_clone(const compact_doubly_linked_list_t *list);
+
+/// @brief Gets the number of elements in a list.
+/// @param list The list to query.
+/// @return The number of elements (0 if the list is NULL).
+size_t cdll_size(const compact_doubly_linked_list_t *list);
+
+/// @brief Gets the number of nodes a list can hold before its array grows.
+/// @param list The list to query.
+/// @return The capacity in nodes (0 if the list is NULL).
+size_t cdll_capacity(const compact_doubly_linked_list_t *list);
+
+/// @brief Grows a list's node array ahead of time.
+/// @param list The list to grow.
+/// @param capacity The number of nodes to make room for.
+/// @return exit_code_t (E_SUCCESS for success, E_TOO_BIG past CDLL_MAX_CAPACITY, anything else is a failure).
+exit_code_t cdll_reserve(compact_doubly_linked_list_t *list, size_t capacity);
+
+/// @brief Adds a node to the front of a linked list.
+/// @param list The list to append.
+/// @param data The data to be added.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t cdll_push_head(compact_doubly_linked_list_t *list, void *data);
+
+/// @brief Adds a node to the back of a linked list.
+/// @param list The list to append.
+/// @param data The data to be added.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t cdll_push_tail(compact_doubly_linked_list_t *list, void *data);
+
+/// @brief Adds a node at a specific position in a linked list, moving the node there back by one.
+/// @param list The list to append.
+/// @param data The data to be added.
+/// @param position The position at which to insert the node (1 for the head).
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t cdll_push_position(compact_doubly_linked_list_t *list, void *data, size_t position);
+
+/// @brief Gets the value at the head of a linked list.
+/// @param list The list to get the head value from.
+/// @return The value at the head of the list.
+void *cdll_peek_head(compact_doubly_linked_list_t *list);
+
+/// @brief Gets the value at the tail of a linked list.
+/// @param list The list to get the tail value from.
+/// @return The value at the tail of the list.
+void *cdll_peek_tail(compact_doubly_linked_list_t *list);
+
+/// @brief Gets the value at a specific position of a linked list.
+/// @param list The list to get the value from.
+/// @param position The position at which the value is stored (1 for the head).
+/// @return The value at the specific position of the list.
+void *cdll_peek_position(compact_doubly_linked_list_t *list, size_t position);
+
+/// @brief Gets the value at the head of a linked list and then removes the item from the list.
+/// @param list The list to pop the value from.
+/// @return The value at the head of the list.
+void *cdll_pop_head(compact_doubly_linked_list_t *list);
+
+/// @brief Gets the value at the tail of a linked list and then removes the item from the list.
+/// @param list The list to pop the value from.
+/// @return The value at the tail of the list.
+void *cdll_pop_tail(compact_doubly_linked_list_t *list);
+
+/// @brief Gets the value a specific position of a linked list and then removes the item from the list.
+/// @param list The list to pop the value from.
+/// @param position The position at which the value is stored (1 for the head).
+/// @return The value at the specific position of the list.
+void *cdll_pop_position(compact_doubly_linked_list_t *list, size_t position);
+
+/// @brief Removes the first node of a linked list.
+/// @param list The list to remove the first node from.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t cdll_remove_head(compact_doubly_linked_list_t *list);
+
+/// @brief Removes the last node of a linked list.
+/// @param list The list to remove the last node from.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t cdll_remove_tail(compact_doubly_linked_list_t *list);
+
+/// @brief Removes the node at a specific position of a linked list.
+/// @param list The list to remove from.
+/// @param position The position at which the node is to be removed (1 for the head).
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t cdll_remove_position(compact_doubly_linked_list_t *list, size_t position);
+
+/// @brief Prints a linked list.
+/// @param list The list to be printed.
+/// @param function_ptr A function pointer to print a specified data type.
+/// @param reverse Whether to print from the tail to the head.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t cdll_print_list(compact_doubly_linked_list_t *list, void (*function_ptr)(void *), bool reverse);
+
+/// @brief Clears all nodes from a linked list, keeping its node array for reuse.
+/// @param list The address of the list.
+void cdll_clear_list(compact_doubly_linked_list_t **list);
+
+/// @brief Destroys a linked list.
+/// @param list The address of the list
+void cdll_destroy_list(compact_doubly_linked_list_t **list);
+
+#endif
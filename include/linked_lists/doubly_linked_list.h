@@ -6,15 +6,36 @@
 #include <stdlib.h>
 
 #include "exit_codes.h"
+#include "utilities/comparisons.h"
+#include "utilities/node_pool.h"
 
 typedef struct dll_node dll_node_t;
 typedef struct doubly_linked_list doubly_linked_list_t;
 
+// Walks a list in either direction and edits it in place without rescanning from the ends. Cursors live
+// wherever the caller puts them (usually on the stack) and never allocate.
+typedef struct dll_cursor
+{
+    doubly_linked_list_t *list;
+    dll_node_t *current; // node under the cursor (NULL once past the end)
+} dll_cursor_t;
+
 /// @brief Creates a doubly-linked list container.
 /// @param  void Takes no parameters.
 /// @return doubly_linked_list_t (returns a doubly-linked list).
 doubly_linked_list_t *dll_create(void);
 
+/// @brief Creates a doubly-linked list container whose nodes come from a pool it shares with other lists.
+/// @param pool The pool to take nodes from. It must outlive the list, and its nodes must be at least
+///             dll_node_size() bytes.
+/// @return doubly_linked_list_t (NULL on failure or if the pool's nodes are too small).
+/// @note dll_create gives each list a pool of its own instead, released in one go when the list is cleared.
+doubly_linked_list_t *dll_create_with_pool(node_pool_t *pool);
+
+/// @brief Gets the size of the list's nodes, for creating a pool to share between lists.
+/// @return The size in bytes of one node.
+size_t dll_node_size(void);
+
 /// @brief Adds a node to the front of a linked list.
 /// @param list The list to append.
 /// @param data The data to be added.
@@ -89,6 +110,57 @@ exit_code_t dll_remove_position(doubly_linked_list_t *list, size_t position);
 /// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
 exit_code_t dll_print_list(doubly_linked_list_t *list, void (*function_ptr)(void *), bool reverse);
 
+/// @brief Puts a cursor on the head of a linked list.
+/// @param list The list to walk.
+/// @param cursor The cursor to set up. It stays valid until the list is edited other than through it.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t dll_cursor_head(doubly_linked_list_t *list, dll_cursor_t *cursor);
+
+/// @brief Puts a cursor on the tail of a linked list.
+/// @param list The list to walk.
+/// @param cursor The cursor to set up. It stays valid until the list is edited other than through it.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t dll_cursor_tail(doubly_linked_list_t *list, dll_cursor_t *cursor);
+
+/// @brief Moves a cursor to the next node; moving on from the tail leaves it past the end.
+/// @param cursor The cursor to move.
+/// @return exit_code_t (E_SUCCESS for success, E_OUT_OF_BOUNDS if the cursor is already past the end).
+exit_code_t dll_cursor_next(dll_cursor_t *cursor);
+
+/// @brief Moves a cursor to the previous node; from past the end, it moves onto the tail.
+/// @param cursor The cursor to move.
+/// @return exit_code_t (E_SUCCESS for success, E_OUT_OF_BOUNDS if the cursor is on the head or the list is empty).
+exit_code_t dll_cursor_prev(dll_cursor_t *cursor);
+
+/// @brief Gets the value under a cursor.
+/// @param cursor The cursor to read.
+/// @return The value under the cursor (NULL if the cursor is past the end).
+void *dll_cursor_get(const dll_cursor_t *cursor);
+
+/// @brief Adds a node just before the cursor, which stays where it is. Past the end, this appends.
+/// @param cursor The cursor to insert at.
+/// @param data The data to be added.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t dll_cursor_insert_before(dll_cursor_t *cursor, void *data);
+
+/// @brief Adds a node just after the cursor, which stays where it is.
+/// @param cursor The cursor to insert at. It must not be past the end.
+/// @param data The data to be added.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t dll_cursor_insert_after(dll_cursor_t *cursor, void *data);
+
+/// @brief Removes the node under the cursor and moves the cursor on to the next node.
+/// @param cursor The cursor to remove at. It must not be past the end.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t dll_cursor_erase(dll_cursor_t *cursor);
+
+/// @brief Sorts a linked list in place by relinking its nodes, without allocating.
+/// @param list The list to sort.
+/// @param compare Orders two values, called with the stored data pointers and its own ctx.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+/// @note Stable, and close to linear on nearly sorted lists (see linked_merge_sort).
+exit_code_t dll_sort(doubly_linked_list_t *list, const compare_ctx *compare);
+
 /// @brief Clears all nodes from a linked list.
 /// @param list The address of the list.
 void dll_clear_list(doubly_linked_list_t **list);
@@ -0,0 +1,109 @@
+#ifndef INDEXABLE_SKIP_LIST_H
+#define INDEXABLE_SKIP_LIST_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "exit_codes.h"
+
+#define ISL_MAX_LEVEL 16 // enough levels for 4^16 elements at a promotion chance of 1 in 4
+
+// An indexable skip list keeps elements in the order they were put in, like the linked lists, but every
+// link also records how many positions it spans. A positional lookup drops down the levels summing spans,
+// so peeking, inserting and removing at a position are all O(log n) expected instead of O(n).
+typedef struct isl_node isl_node_t;
+typedef struct indexable_skip_list indexable_skip_list_t;
+
+/// @brief Creates an indexable skip list container.
+/// @param  void Takes no parameters.
+/// @return indexable_skip_list_t (returns an indexable skip list).
+indexable_skip_list_t *isl_create(void);
+
+/// @brief Gets the number of elements in a list.
+/// @param list The list to query.
+/// @return The number of elements (0 if the list is NULL).
+size_t isl_size(const indexable_skip_list_t *list);
+
+/// @brief Adds an element to the front of a skip list.
+/// @param list The list to append.
+/// @param data The data to be added.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t isl_push_head(indexable_skip_list_t *list, void *data);
+
+/// @brief Adds an element to the back of a skip list.
+/// @param list The list to append.
+/// @param data The data to be added.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t isl_push_tail(indexable_skip_list_t *list, void *data);
+
+/// @brief Adds an element at a specific position in a skip list, moving the element there back by one.
+/// @param list The list to append.
+/// @param data The data to be added.
+/// @param position The position at which to insert the element (1 for the head).
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t isl_push_position(indexable_skip_list_t *list, void *data, size_t position);
+
+/// @brief Gets the value at the head of a skip list.
+/// @param list The list to get the head value from.
+/// @return The value at the head of the list.
+void *isl_peek_head(indexable_skip_list_t *list);
+
+/// @brief Gets the value at the tail of a skip list.
+/// @param list The list to get the tail value from.
+/// @return The value at the tail of the list.
+void *isl_peek_tail(indexable_skip_list_t *list);
+
+/// @brief Gets the value at a specific position of a skip list.
+/// @param list The list to get the value from.
+/// @param position The position at which the value is stored (1 for the head).
+/// @return The value at the specific position of the list.
+void *isl_peek_position(indexable_skip_list_t *list, size_t position);
+
+/// @brief Gets the value at the head of a skip list and then removes the item from the list.
+/// @param list The list to pop the value from.
+/// @return The value at the head of the list.
+void *isl_pop_head(indexable_skip_list_t *list);
+
+/// @brief Gets the value at the tail of a skip list and then removes the item from the list.
+/// @param list The list to pop the value from.
+/// @return The value at the tail of the list.
+void *isl_pop_tail(indexable_skip_list_t *list);
+
+/// @brief Gets the value a specific position of a skip list and then removes the item from the list.
+/// @param list The list to pop the value from.
+/// @param position The position at which the value is stored (1 for the head).
+/// @return The value at the specific position of the list.
+void *isl_pop_position(indexable_skip_list_t *list, size_t position);
+
+/// @brief Removes the first element of a skip list.
+/// @param list The list to remove the first element from.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t isl_remove_head(indexable_skip_list_t *list);
+
+/// @brief Removes the last element of a skip list.
+/// @param list The list to remove the last element from.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t isl_remove_tail(indexable_skip_list_t *list);
+
+/// @brief Removes the element at a specific position of a skip list.
+/// @param list The list to remove from.
+/// @param position The position at which the element is to be removed (1 for the head).
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t isl_remove_position(indexable_skip_list_t *list, size_t position);
+
+/// @brief Prints a skip list.
+/// @param list The list to be printed.
+/// @param function_ptr A function pointer to print a specified data type.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t isl_print_list(indexable_skip_list_t *list, void (*function_ptr)(void *));
+
+/// @brief Clears all elements from a skip list.
+/// @param list The address of the list.
+void isl_clear_list(indexable_skip_list_t **list);
+
+/// @brief Destroys a skip list.
+/// @param list The address of the list
+void isl_destroy_list(indexable_skip_list_t **list);
+
+#endif
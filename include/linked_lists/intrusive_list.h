@@ -0,0 +1,204 @@
+#ifndef INTRUSIVE_LIST_H
+#define INTRUSIVE_LIST_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "exit_codes.h"
+
+// Intrusive lists link objects through a link struct embedded in the object itself, so the list never
+// allocates and reaching an object from its link costs no extra pointer chase. An object can sit on
+// several lists at once by embedding one link per list. The list structs are public so they can live
+// on the stack or inside other objects; set them up with the matching _init function.
+
+/// @brief Gets the object that embeds a link.
+/// @param ptr The address of the link.
+/// @param type The type of the object.
+/// @param member The name of the link within the object.
+#define CONTAINER_OF(ptr, type, member) ((type *)((char *)(ptr) - offsetof(type, member)))
+
+// SINGLY LINKED
+//***********************************************************************************************
+typedef struct isll_link
+{
+    struct isll_link *next;
+} isll_link_t;
+
+typedef struct intrusive_singly_linked_list
+{
+    isll_link_t *head;
+    isll_link_t *tail;
+    size_t current_size;
+} isll_t;
+
+/// @brief Sets up an empty intrusive singly-linked list.
+/// @param list The list to set up.
+void isll_init(isll_t *list);
+
+/// @brief Links an object in at the front of a list.
+/// @param list The list to append.
+/// @param link The object's link. It must not be on the list already.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t isll_push_head(isll_t *list, isll_link_t *link);
+
+/// @brief Links an object in at the back of a list.
+/// @param list The list to append.
+/// @param link The object's link. It must not be on the list already.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t isll_push_tail(isll_t *list, isll_link_t *link);
+
+/// @brief Links an object in just after another one.
+/// @param list The list to append.
+/// @param previous The link to insert after (NULL to insert at the head).
+/// @param link The object's link. It must not be on the list already.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t isll_insert_after(isll_t *list, isll_link_t *previous, isll_link_t *link);
+
+/// @brief Gets the link at the head of a list.
+/// @param list The list to look at.
+/// @return The head link (NULL if the list is empty).
+isll_link_t *isll_peek_head(const isll_t *list);
+
+/// @brief Gets the link at the tail of a list.
+/// @param list The list to look at.
+/// @return The tail link (NULL if the list is empty).
+isll_link_t *isll_peek_tail(const isll_t *list);
+
+/// @brief Unlinks the object at the head of a list.
+/// @param list The list to pop from.
+/// @return The unlinked link (NULL if the list is empty).
+isll_link_t *isll_pop_head(isll_t *list);
+
+/// @brief Unlinks the object just after another one in O(1).
+/// @param list The list to remove from.
+/// @param previous The link before the one to remove (NULL to remove the head).
+/// @return The unlinked link (NULL if there is nothing after previous).
+isll_link_t *isll_remove_after(isll_t *list, isll_link_t *previous);
+
+// DOUBLY LINKED
+//***********************************************************************************************
+typedef struct idll_link
+{
+    struct idll_link *next;
+    struct idll_link *prev;
+} idll_link_t;
+
+typedef struct intrusive_doubly_linked_list
+{
+    idll_link_t *head;
+    idll_link_t *tail;
+    size_t current_size;
+} idll_t;
+
+/// @brief Sets up an empty intrusive doubly-linked list.
+/// @param list The list to set up.
+void idll_init(idll_t *list);
+
+/// @brief Links an object in at the front of a list.
+/// @param list The list to append.
+/// @param link The object's link. It must not be on the list already.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t idll_push_head(idll_t *list, idll_link_t *link);
+
+/// @brief Links an object in at the back of a list.
+/// @param list The list to append.
+/// @param link The object's link. It must not be on the list already.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t idll_push_tail(idll_t *list, idll_link_t *link);
+
+/// @brief Links an object in just before another one.
+/// @param list The list to append.
+/// @param next The link to insert before. It must be on the list.
+/// @param link The object's link. It must not be on the list already.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t idll_insert_before(idll_t *list, idll_link_t *next, idll_link_t *link);
+
+/// @brief Links an object in just after another one.
+/// @param list The list to append.
+/// @param previous The link to insert after. It must be on the list.
+/// @param link The object's link. It must not be on the list already.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t idll_insert_after(idll_t *list, idll_link_t *previous, idll_link_t *link);
+
+/// @brief Gets the link at the head of a list.
+/// @param list The list to look at.
+/// @return The head link (NULL if the list is empty).
+idll_link_t *idll_peek_head(const idll_t *list);
+
+/// @brief Gets the link at the tail of a list.
+/// @param list The list to look at.
+/// @return The tail link (NULL if the list is empty).
+idll_link_t *idll_peek_tail(const idll_t *list);
+
+/// @brief Unlinks the object at the head of a list.
+/// @param list The list to pop from.
+/// @return The unlinked link (NULL if the list is empty).
+idll_link_t *idll_pop_head(idll_t *list);
+
+/// @brief Unlinks the object at the tail of a list.
+/// @param list The list to pop from.
+/// @return The unlinked link (NULL if the list is empty).
+idll_link_t *idll_pop_tail(idll_t *list);
+
+/// @brief Unlinks an object from anywhere in a list in O(1).
+/// @param list The list to remove from.
+/// @param link The object's link. It must be on the list.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t idll_remove(idll_t *list, idll_link_t *link);
+
+// CIRCULAR SINGLY LINKED
+//***********************************************************************************************
+typedef struct icsll_link
+{
+    struct icsll_link *next;
+} icsll_link_t;
+
+typedef struct intrusive_circular_singly_linked_list
+{
+    icsll_link_t *tail; // the head is always tail->next
+    size_t current_size;
+} icsll_t;
+
+/// @brief Sets up an empty intrusive circular singly-linked list.
+/// @param list The list to set up.
+void icsll_init(icsll_t *list);
+
+/// @brief Links an object in at the front of a list.
+/// @param list The list to append.
+/// @param link The object's link. It must not be on the list already.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t icsll_push_head(icsll_t *list, icsll_link_t *link);
+
+/// @brief Links an object in at the back of a list.
+/// @param list The list to append.
+/// @param link The object's link. It must not be on the list already.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t icsll_push_tail(icsll_t *list, icsll_link_t *link);
+
+/// @brief Gets the link at the head of a list.
+/// @param list The list to look at.
+/// @return The head link (NULL if the list is empty).
+icsll_link_t *icsll_peek_head(const icsll_t *list);
+
+/// @brief Gets the link at the tail of a list.
+/// @param list The list to look at.
+/// @return The tail link (NULL if the list is empty).
+icsll_link_t *icsll_peek_tail(const icsll_t *list);
+
+/// @brief Unlinks the object at the head of a list.
+/// @param list The list to pop from.
+/// @return The unlinked link (NULL if the list is empty).
+icsll_link_t *icsll_pop_head(icsll_t *list);
+
+/// @brief Unlinks the object just after another one in O(1).
+/// @param list The list to remove from.
+/// @param previous The link before the one to remove. It must be on the list.
+/// @return The unlinked link (NULL if the list is empty).
+icsll_link_t *icsll_remove_after(icsll_t *list, icsll_link_t *previous);
+
+/// @brief Moves the head to the tail in O(1), for round-robin use.
+/// @param list The list to rotate.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t icsll_rotate(icsll_t *list);
+
+#endif
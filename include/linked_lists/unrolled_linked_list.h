@@ -0,0 +1,125 @@
+#ifndef UNROLLED_LINKED_LIST_H
+#define UNROLLED_LINKED_LIST_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "exit_codes.h"
+#include "utilities/node_pool.h"
+
+#define ULL_NODE_CAPACITY 14 // elements per node; with its header a node fills two 64-byte cache lines
+
+// An unrolled list keeps up to ULL_NODE_CAPACITY elements in each node, so walking it touches one node per
+// run of elements instead of one per element. Full nodes split in two on insert, and neighbouring nodes
+// merge once a removal leaves them with room for each other's elements.
+typedef struct ull_node ull_node_t;
+typedef struct unrolled_linked_list unrolled_linked_list_t;
+
+/// @brief Creates an unrolled linked list container.
+/// @param  void Takes no parameters.
+/// @return unrolled_linked_list_t (returns an unrolled linked list).
+unrolled_linked_list_t *ull_create(void);
+
+/// @brief Creates an unrolled linked list container whose nodes come from a pool it shares with other lists.
+/// @param pool The pool to take nodes from. It must outlive the list, and its nodes must be at least
+///             ull_node_size() bytes.
+/// @return unrolled_linked_list_t (NULL on failure or if the pool's nodes are too small).
+unrolled_linked_list_t *ull_create_with_pool(node_pool_t *pool);
+
+/// @brief Gets the size of the list's nodes, for creating a pool to share between lists.
+/// @return The size in bytes of one node.
+size_t ull_node_size(void);
+
+/// @brief Gets the number of elements in a list.
+/// @param list The list to query.
+/// @return The number of elements (0 if the list is NULL).
+size_t ull_size(const unrolled_linked_list_t *list);
+
+/// @brief Gets the number of nodes holding a list's elements.
+/// @param list The list to query.
+/// @return The number of nodes (0 if the list is NULL).
+size_t ull_node_count(const unrolled_linked_list_t *list);
+
+/// @brief Adds an element to the front of a linked list.
+/// @param list The list to append.
+/// @param data The data to be added.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t ull_push_head(unrolled_linked_list_t *list, void *data);
+
+/// @brief Adds an element to the back of a linked list.
+/// @param list The list to append.
+/// @param data The data to be added.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t ull_push_tail(unrolled_linked_list_t *list, void *data);
+
+/// @brief Adds an element at a specific position in a linked list, moving the element there back by one.
+/// @param list The list to append.
+/// @param data The data to be added.
+/// @param position The position at which to insert the element (1 for the head).
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t ull_push_position(unrolled_linked_list_t *list, void *data, size_t position);
+
+/// @brief Gets the value at the head of a linked list.
+/// @param list The list to get the head value from.
+/// @return The value at the head of the list.
+void *ull_peek_head(unrolled_linked_list_t *list);
+
+/// @brief Gets the value at the tail of a linked list.
+/// @param list The list to get the tail value from.
+/// @return The value at the tail of the list.
+void *ull_peek_tail(unrolled_linked_list_t *list);
+
+/// @brief Gets the value at a specific position of a linked list.
+/// @param list The list to get the value from.
+/// @param position The position at which the value is stored (1 for the head).
+/// @return The value at the specific position of the list.
+void *ull_peek_position(unrolled_linked_list_t *list, size_t position);
+
+/// @brief Gets the value at the head of a linked list and then removes the item from the list.
+/// @param list The list to pop the value from.
+/// @return The value at the head of the list.
+void *ull_pop_head(unrolled_linked_list_t *list);
+
+/// @brief Gets the value at the tail of a linked list and then removes the item from the list.
+/// @param list The list to pop the value from.
+/// @return The value at the tail of the list.
+void *ull_pop_tail(unrolled_linked_list_t *list);
+
+/// @brief Gets the value a specific position of a linked list and then removes the item from the list.
+/// @param list The list to pop the value from.
+/// @param position The position at which the value is stored (1 for the head).
+/// @return The value at the specific position of the list.
+void *ull_pop_position(unrolled_linked_list_t *list, size_t position);
+
+/// @brief Removes the first element of a linked list.
+/// @param list The list to remove the first element from.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t ull_remove_head(unrolled_linked_list_t *list);
+
+/// @brief Removes the last element of a linked list.
+/// @param list The list to remove the last element from.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t ull_remove_tail(unrolled_linked_list_t *list);
+
+/// @brief Removes the element at a specific position of a linked list.
+/// @param list The list to remove from.
+/// @param position The position at which the element is to be removed (1 for the head).
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t ull_remove_position(unrolled_linked_list_t *list, size_t position);
+
+/// @brief Prints a linked list.
+/// @param list The list to be printed.
+/// @param function_ptr A function pointer to print a specified data type.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t ull_print_list(unrolled_linked_list_t *list, void (*function_ptr)(void *));
+
+/// @brief Clears all elements from a linked list.
+/// @param list The address of the list.
+void ull_clear_list(unrolled_linked_list_t **list);
+
+/// @brief Destroys a linked list.
+/// @param list The address of the list
+void ull_destroy_list(unrolled_linked_list_t **list);
+
+#endif
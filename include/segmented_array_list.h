@@ -0,0 +1,74 @@
+#ifndef SEGMENTED_ARRAY_LIST_H
+#define SEGMENTED_ARRAY_LIST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "exit_codes.h"
+#include "utilities/destroy.h"
+#include "utilities/comparisons.h"
+
+typedef struct segmented_array_list segmented_array_list_t;
+
+/// @brief Creates a segmented array list of pointers. Storage grows in power-of-two segments that are
+///        never moved, so growth never copies and slot addresses stay valid for the life of the list.
+/// @param destroy Called when an element is removed (may be NULL).
+/// @param equal Used to search the list (may be NULL).
+/// @return segmented_array_list_t (NULL on failure).
+segmented_array_list_t *segmented_list_create(const destroy_ctx *destroy, const equal_ctx *equal);
+
+/// @brief Creates a segmented array list that stores its elements by value.
+/// @param element_size The size in bytes of a single element.
+/// @param destroy Called with the address of an element's slot when it is removed (may be NULL).
+/// @param equal Called with the address of an element's slot and the searched-for data (may be NULL).
+/// @return segmented_array_list_t (NULL on failure).
+segmented_array_list_t *segmented_list_create_typed(size_t element_size, const destroy_ctx *destroy, const equal_ctx *equal);
+
+/// @brief Appends an element to the end of the list.
+/// @param list The list to append to.
+/// @param data The data to be added (copied for typed lists).
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t segmented_list_push(segmented_array_list_t *list, void *data);
+
+/// @brief Removes and destroys the last element of the list.
+/// @param list The list to remove from.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t segmented_list_pop(segmented_array_list_t *list);
+
+/// @brief Gets an element of the list.
+/// @param list The list to read from.
+/// @param index The index of the element.
+/// @return The stored pointer for pointer lists, or the slot address for typed lists (NULL if out of range).
+///         Slot addresses never change while the element is in the list.
+void *segmented_list_get(segmented_array_list_t *list, size_t index);
+
+/// @brief Replaces an element of the list, destroying the old one.
+/// @param list The list to modify.
+/// @param index The index of the element.
+/// @param data The new data (copied for typed lists).
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+exit_code_t segmented_list_set(segmented_array_list_t *list, size_t index, void *data);
+
+/// @brief Checks whether the list holds an element equal to data.
+/// @param list The list to search.
+/// @param data The data to look for.
+/// @return true if a match was found.
+bool segmented_list_contains(segmented_array_list_t *list, void *data);
+
+/// @brief Gets the number of elements in the list.
+/// @param list The list to query.
+/// @return The number of elements (0 if the list is NULL).
+size_t segmented_list_size(segmented_array_list_t *list);
+
+/// @brief Checks whether the list is empty.
+/// @param list The list to query.
+/// @return true if the list holds no elements.
+bool segmented_list_is_empty(segmented_array_list_t *list);
+
+/// @brief Destroys every element, releases all segments and the list itself.
+/// @param list The address of the list.
+void segmented_list_destroy(segmented_array_list_t **list);
+
+#endif
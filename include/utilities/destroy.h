@@ -4,11 +4,17 @@
 #include <stdlib.h>
 
 typedef void (*destroy_function)(void *data, const void *context);
+typedef void (*destroy_many_function)(void **items, size_t count, const void *context);
 
 typedef struct
 {
     destroy_function destroy;
     const void *context;
+    destroy_many_function destroy_many; // Optional; array_list destroys whole ranges with one call when set
 } destroy_ctx;
 
+// Either callback may be left NULL. Containers that drop elements one at a time call destroy, or
+// destroy_many with a count of 1 when only that is set, so a ctx with just destroy_many frees
+// everything in every container.
+
 #endif
\ No newline at end of file
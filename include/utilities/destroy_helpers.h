@@ -5,6 +5,7 @@
 #include "destroy.h"
 
 void naive_destroy(void *data, const void *context);
+void naive_destroy_many(void **items, size_t count, const void *context);
 
 extern destroy_ctx naive_destroy_ctx;
 
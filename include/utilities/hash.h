@@ -0,0 +1,14 @@
+#ifndef HASH_H
+#define HASH_H
+
+#include <stddef.h>
+
+typedef size_t (*hash_function)(const void *data, const void *ctx);
+
+typedef struct
+{
+    hash_function hash;
+    const void *ctx;
+} hash_ctx;
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef HASH_HELPERS_H
+#define HASH_HELPERS_H
+
+#include <string.h>
+#include <stdint.h>
+
+#include "hash.h"
+
+// Each hash agrees with the equal_ctx of the same name in comparison_helpers.h
+size_t int_hash(const void *x, const void *ctx);
+size_t str_hash(const void *x, const void *ctx);
+size_t naive_hash(const void *x, const void *ctx);
+size_t raw_int_hash(const void *x, const void *ctx);
+size_t raw_size_t_hash(const void *x, const void *ctx);
+
+extern hash_ctx int_hash_ctx;
+extern hash_ctx raw_int_hash_ctx;
+extern hash_ctx raw_size_t_hash_ctx;
+extern hash_ctx str_hash_ctx;
+extern hash_ctx naive_hash_ctx;
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <stddef.h>
+
+#define NODE_POOL_MIN_SLAB_NODES 8        // nodes in a pool's first slab
+#define NODE_POOL_DEFAULT_SLAB_NODES 1024 // slabs stop doubling at this many nodes unless told otherwise
+
+// A pool hands out fixed-size nodes carved from contiguous slabs. Released nodes go on a free list and
+// are reused before any new slab is allocated; slabs are only returned to the system all at once.
+// A pool is not thread-safe: share one only between lists used from the same thread.
+typedef struct node_pool node_pool_t;
+
+/// @brief Creates a node pool.
+/// @param node_size The size in bytes of one node.
+/// @param max_slab_nodes The most nodes a single slab may hold (0 for NODE_POOL_DEFAULT_SLAB_NODES).
+/// @return node_pool_t (NULL on failure).
+/// @note Slabs start at NODE_POOL_MIN_SLAB_NODES nodes and double up to max_slab_nodes, so small lists
+///       stay small. Nodes are aligned for pointers and pointer-sized integers.
+node_pool_t *node_pool_create(size_t node_size, size_t max_slab_nodes);
+
+/// @brief Takes a zeroed node from the pool.
+/// @param pool The pool to allocate from.
+/// @return A node of the pool's node size (NULL on failure).
+void *node_pool_alloc(node_pool_t *pool);
+
+/// @brief Returns a node to the pool for reuse.
+/// @param pool The pool the node came from.
+/// @param node The node to release (ignored if NULL).
+void node_pool_free(node_pool_t *pool, void *node);
+
+/// @brief Gets the size of the nodes the pool hands out.
+/// @param pool The pool to query.
+/// @return The node size in bytes, after rounding up for alignment (0 if the pool is NULL).
+size_t node_pool_node_size(const node_pool_t *pool);
+
+/// @brief Gets the number of nodes handed out and not yet released.
+/// @param pool The pool to query.
+/// @return The number of nodes in use (0 if the pool is NULL).
+size_t node_pool_in_use(const node_pool_t *pool);
+
+/// @brief Releases every node of the pool at once, freeing all of its slabs.
+/// @param pool The pool to reset. Nodes taken from it before the reset must no longer be used.
+void node_pool_reset(node_pool_t *pool);
+
+/// @brief Destroys a node pool and every node it handed out.
+/// @param pool The address of the pool. Set to NULL on return.
+void node_pool_destroy(node_pool_t **pool);
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef PREDICATE_H
+#define PREDICATE_H
+
+#include <stdbool.h>
+
+typedef bool (*predicate_function)(const void *data, const void *ctx);
+typedef void *(*map_function)(void *data, const void *ctx);
+
+typedef struct
+{
+    predicate_function predicate;
+    const void *ctx;
+} predicate_ctx;
+
+typedef struct
+{
+    map_function map;
+    const void *ctx;
+} map_ctx;
+
+#endif
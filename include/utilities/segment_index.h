@@ -0,0 +1,42 @@
+#ifndef SEGMENT_INDEX_H
+#define SEGMENT_INDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <limits.h>
+
+// Segment k holds 2^(k + SEGMENT_BASE_SHIFT) slots, so the first segment holds 8 slots and
+// every further segment doubles. Together the segments can address every size_t index.
+#define SEGMENT_BASE_SHIFT 3
+#define SEGMENT_COUNT ((sizeof(size_t) * CHAR_BIT) - SEGMENT_BASE_SHIFT)
+
+static inline size_t highest_bit(size_t value)
+{
+#if defined(__GNUC__)
+    return (sizeof(unsigned long long) * CHAR_BIT - 1) - (size_t)__builtin_clzll((unsigned long long)value);
+#else
+    size_t bit = 0;
+    while (value >>= 1)
+    {
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+static inline size_t segment_length(size_t segment)
+{
+    return (size_t)1 << (segment + SEGMENT_BASE_SHIFT);
+}
+
+static inline void segment_locate(size_t index, size_t *segment, size_t *offset)
+{
+    // Shifting the index by the first segment's length makes every segment start at a power of two
+    size_t shifted = index + ((size_t)1 << SEGMENT_BASE_SHIFT);
+    size_t bit = highest_bit(shifted);
+
+    *segment = bit - SEGMENT_BASE_SHIFT;
+    *offset = shifted - ((size_t)1 << bit);
+}
+
+#endif
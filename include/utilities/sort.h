@@ -0,0 +1,46 @@
+#ifndef SORT_H
+#define SORT_H
+
+#include <stddef.h>
+
+#include "exit_codes.h"
+#include "comparisons.h"
+
+// The array sorts work on an array of count elements of size bytes each. The comparator is called with
+// the addresses of two elements and its own ctx, so context-carrying comparators such as inv_comp
+// work unchanged. Neither array sort is stable.
+
+/// @brief Sorts an array in place with introsort (quicksort falling back to heapsort).
+/// @param base The first element.
+/// @param count The number of elements.
+/// @param size The size in bytes of one element.
+/// @param compare Orders two elements.
+void introsort(void *base, size_t count, size_t size, const compare_ctx *compare);
+
+/// @brief Sorts an array with a multi-threaded merge sort.
+/// @param base The first element.
+/// @param count The number of elements.
+/// @param size The size in bytes of one element.
+/// @param compare Orders two elements. Called from several threads at once.
+/// @param threads The number of threads to use (0 to use one per online CPU).
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+/// @note Arrays below PARALLEL_SORT_THRESHOLD elements are sorted with introsort on the calling thread.
+exit_code_t parallel_merge_sort(void *base, size_t count, size_t size, const compare_ctx *compare,
+                                size_t threads);
+
+#define PARALLEL_SORT_THRESHOLD 16384
+
+/// @brief Sorts a NULL-terminated chain of linked nodes by relinking them, without allocating.
+/// @param head The first node of the chain.
+/// @param next_offset The offset of the node's next pointer (offsetof(node_type, next)).
+/// @param data_offset The offset of the node's data pointer (offsetof(node_type, data)).
+/// @param compare Orders two nodes' data pointers, called with its own ctx.
+/// @param tail Receives the last node of the sorted chain (NULL if the chain is empty).
+/// @return The first node of the sorted chain.
+/// @note A stable, bottom-up natural merge sort: existing ascending and strictly descending runs are
+///       taken whole, so nearly sorted chains finish in close to linear time. Only the next pointers
+///       are rewritten; lists with other links (such as prev) must rebuild them afterwards.
+void *linked_merge_sort(void *head, size_t next_offset, size_t data_offset, const compare_ctx *compare,
+                        void **tail);
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef WORD_SEARCH_H
+#define WORD_SEARCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Scans an array of machine words for (word & mask) == (key & mask). On x86-64 the widest of the
+// AVX-512, AVX2 and SSE2 kernels supported by the running CPU is picked at run time; other targets
+// use the scalar loop.
+
+/// @brief Finds the first matching word.
+/// @param words The words to scan.
+/// @param count The number of words.
+/// @param key The word to look for.
+/// @param mask The bits that take part in the comparison.
+/// @return The index of the first match, or count if there is none.
+size_t word_find(const uintptr_t *words, size_t count, uintptr_t key, uintptr_t mask);
+
+/// @brief Counts the matching words.
+/// @param words The words to scan.
+/// @param count The number of words.
+/// @param key The word to look for.
+/// @param mask The bits that take part in the comparison.
+/// @return The number of matches.
+size_t word_count(const uintptr_t *words, size_t count, uintptr_t key, uintptr_t mask);
+
+#endif
@@ -0,0 +1,389 @@
+#include <stdint.h>
+
+#include "array_deque.h"
+
+struct array_deque
+{
+    unsigned char *slots;
+    size_t total_capacity; // always a power of two, so wrapping is a mask
+    size_t head;           // physical slot of the front element
+    size_t current_size;
+    const destroy_ctx *destroy;
+    const equal_ctx *equal;
+    size_t element_size;   // bytes per slot (sizeof(void *) for pointer deques)
+    bool is_typed;         // true if elements are stored by value
+};
+
+static array_deque_t *create_deque(size_t element_size, bool is_typed, const destroy_ctx *destroy, const equal_ctx *equal);
+static exit_code_t grow(array_deque_t *deque);
+static exit_code_t check_push(array_deque_t *deque, void *data);
+static void pop_slot(array_deque_t *deque, size_t physical, void *out);
+static size_t physical_index(array_deque_t *deque, size_t index);
+static void *slot_at(array_deque_t *deque, size_t physical);
+static void *element_at(array_deque_t *deque, size_t physical);
+static void store_element(array_deque_t *deque, size_t physical, void *data);
+static void destroy_element(array_deque_t *deque, size_t physical);
+
+array_deque_t *array_deque_create(const destroy_ctx *destroy, const equal_ctx *equal)
+{
+    return create_deque(sizeof(void *), false, destroy, equal);
+}
+
+array_deque_t *array_deque_create_typed(size_t element_size, const destroy_ctx *destroy, const equal_ctx *equal)
+{
+    array_deque_t *deque = NULL;
+
+    if (0 == element_size)
+    {
+        goto END;
+    }
+
+    deque = create_deque(element_size, true, destroy, equal);
+
+END:
+    return deque;
+}
+
+exit_code_t array_deque_push_front(array_deque_t *deque, void *data)
+{
+    exit_code_t exit_code = check_push(deque, data);
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
+
+    // Step the head back one slot, wrapping below zero
+    deque->head = (deque->head - 1) & (deque->total_capacity - 1);
+    store_element(deque, deque->head, data);
+    deque->current_size++;
+
+END:
+    return exit_code;
+}
+
+exit_code_t array_deque_push_back(array_deque_t *deque, void *data)
+{
+    exit_code_t exit_code = check_push(deque, data);
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
+
+    store_element(deque, physical_index(deque, deque->current_size), data);
+    deque->current_size++;
+
+END:
+    return exit_code;
+}
+
+exit_code_t array_deque_pop_front(array_deque_t *deque, void *out)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if ((NULL == deque) || (0 == deque->current_size))
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    pop_slot(deque, deque->head, out);
+    deque->head = (deque->head + 1) & (deque->total_capacity - 1);
+
+    exit_code = E_SUCCESS;
+
+END:
+    return exit_code;
+}
+
+exit_code_t array_deque_pop_back(array_deque_t *deque, void *out)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if ((NULL == deque) || (0 == deque->current_size))
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    pop_slot(deque, physical_index(deque, deque->current_size - 1), out);
+
+    exit_code = E_SUCCESS;
+
+END:
+    return exit_code;
+}
+
+void *array_deque_get(array_deque_t *deque, size_t index)
+{
+    void *element = NULL;
+
+    if ((NULL == deque) || (index >= deque->current_size))
+    {
+        goto END;
+    }
+
+    element = element_at(deque, physical_index(deque, index));
+
+END:
+    return element;
+}
+
+exit_code_t array_deque_set(array_deque_t *deque, size_t index, void *data)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if (NULL == deque)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    if (index >= deque->current_size)
+    {
+        exit_code = E_OUT_OF_BOUNDS;
+        goto END;
+    }
+
+    if (NULL == data)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    size_t physical = physical_index(deque, index);
+
+    // destroy the data if necessary
+    destroy_element(deque, physical);
+
+    store_element(deque, physical, data);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+bool array_deque_contains(array_deque_t *deque, void *data)
+{
+    bool contains_data = false;
+
+    if ((NULL == deque) || (NULL == data) || (NULL == deque->equal))
+    {
+        goto END;
+    }
+
+    for (size_t index = 0; index < deque->current_size; index++)
+    {
+        if (true == deque->equal->equal(element_at(deque, physical_index(deque, index)), data, deque->equal->ctx))
+        {
+            contains_data = true;
+            break;
+        }
+    }
+
+END:
+    return contains_data;
+}
+
+size_t array_deque_size(array_deque_t *deque)
+{
+    size_t size = 0;
+
+    if (NULL == deque)
+    {
+        goto END;
+    }
+
+    size = deque->current_size;
+
+END:
+    return size;
+}
+
+bool array_deque_is_empty(array_deque_t *deque)
+{
+    bool is_empty = false;
+
+    if (NULL == deque)
+    {
+        goto END;
+    }
+
+    is_empty = (0 == deque->current_size);
+
+END:
+    return is_empty;
+}
+
+void array_deque_destroy(array_deque_t **deque)
+{
+    if ((NULL == deque) || (NULL == *deque))
+    {
+        goto END;
+    }
+
+    // destroy the data if necessary
+    for (size_t index = 0; index < (*deque)->current_size; index++)
+    {
+        destroy_element(*deque, physical_index(*deque, index));
+    }
+
+    free((*deque)->slots);
+    free(*deque);
+    *deque = NULL;
+
+END:
+    return;
+}
+
+array_deque_t *create_deque(size_t element_size, bool is_typed, const destroy_ctx *destroy, const equal_ctx *equal)
+{
+    array_deque_t *deque = calloc(1, sizeof(array_deque_t));
+    if (NULL == deque)
+    {
+        goto END;
+    }
+
+    if (ARRAY_DEQUE_INITIAL_CAPACITY > SIZE_MAX / element_size)
+    {
+        goto FAIL;
+    }
+
+    deque->slots = malloc(ARRAY_DEQUE_INITIAL_CAPACITY * element_size);
+    if (NULL == deque->slots)
+    {
+        goto FAIL;
+    }
+
+    deque->total_capacity = ARRAY_DEQUE_INITIAL_CAPACITY;
+    deque->head = 0;
+    deque->current_size = 0;
+    deque->destroy = destroy;
+    deque->equal = equal;
+    deque->element_size = element_size;
+    deque->is_typed = is_typed;
+    goto END;
+
+FAIL:
+    free(deque);
+    deque = NULL;
+END:
+    return deque;
+}
+
+exit_code_t grow(array_deque_t *deque)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+    size_t old_capacity = deque->total_capacity;
+
+    if (old_capacity > SIZE_MAX / 2 / deque->element_size)
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
+
+    unsigned char *temp = realloc(deque->slots, old_capacity * 2 * deque->element_size);
+    if (NULL == temp)
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
+
+    deque->slots = temp;
+    deque->total_capacity = old_capacity * 2;
+
+    // A full buffer wraps unless head is 0; the wrapped prefix moves up behind the old end
+    memcpy(slot_at(deque, old_capacity), slot_at(deque, 0), deque->head * deque->element_size);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t check_push(array_deque_t *deque, void *data)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if (NULL == deque)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    if (NULL == data)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    exit_code = (deque->current_size == deque->total_capacity) ? grow(deque) : E_SUCCESS;
+
+END:
+    return exit_code;
+}
+
+void pop_slot(array_deque_t *deque, size_t physical, void *out)
+{
+    // Hand the element over (the slot holds the pointer itself for pointer deques), or destroy it
+    if (NULL != out)
+    {
+        memcpy(out, slot_at(deque, physical), deque->element_size);
+    }
+    else
+    {
+        destroy_element(deque, physical);
+    }
+
+    deque->current_size--;
+}
+
+size_t physical_index(array_deque_t *deque, size_t index)
+{
+    return (deque->head + index) & (deque->total_capacity - 1);
+}
+
+void *slot_at(array_deque_t *deque, size_t physical)
+{
+    return deque->slots + (physical * deque->element_size);
+}
+
+void *element_at(array_deque_t *deque, size_t physical)
+{
+    // Typed deques hand out the address of the slot, pointer deques the stored pointer
+    return deque->is_typed ? slot_at(deque, physical) : *(void **)slot_at(deque, physical);
+}
+
+void store_element(array_deque_t *deque, size_t physical, void *data)
+{
+    if (deque->is_typed)
+    {
+        memcpy(slot_at(deque, physical), data, deque->element_size);
+    }
+    else
+    {
+        *(void **)slot_at(deque, physical) = data;
+    }
+}
+
+void destroy_element(array_deque_t *deque, size_t physical)
+{
+    const destroy_ctx *destroy = deque->destroy;
+
+    if (NULL == destroy)
+    {
+        goto END;
+    }
+
+    if (NULL != destroy->destroy)
+    {
+        destroy->destroy(element_at(deque, physical), destroy->context);
+    }
+    else if (NULL != destroy->destroy_many)
+    {
+        // A batch of one, holding the same pointer destroy would have been given
+        void *item = element_at(deque, physical);
+        destroy->destroy_many(&item, 1, destroy->context);
+    }
+
+END:
+    return;
+}
@@ -1,4 +1,41 @@
+#define _GNU_SOURCE // mremap
+
+#include <math.h>
+#include <stddef.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
 #include "array_list.h"
+#include "utilities/comparison_helpers.h"
+#include "utilities/word_search.h"
+#include "utilities/sort.h"
+#include "utilities/swap.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define ARRAY_LIST_HAS_MMAP // files can be mapped and the page size asked for
+#endif
+
+#if defined(__linux__)
+#define ARRAY_LIST_HAS_MREMAP // large buffers grow by remapping
+#endif
+
+#define INDEX_EMPTY SIZE_MAX       // position of an unused index entry
+#define INDEX_MIN_CAPACITY 16
+#define DESTROY_BATCH 256 // slot addresses handed to destroy_many at a time for typed lists
+#define INLINE_BUFFER_SIZE (INITIAL_CAPACITY * sizeof(void *)) // bytes stored inside the list itself
+#define FILE_MAGIC "DSAARRL1"  // first bytes of a file written by array_list_save
+#define FILE_MAGIC_SIZE 8
+#define DEFAULT_PAGE_SIZE 4096 // used where the page size cannot be asked for
+
+typedef struct index_entry
+{
+    size_t hash;     // hash of the element, kept so the table can grow without rehashing
+    size_t position; // index of the element in the list
+} index_entry_t;
 
 struct array_list
 {
@@ -7,32 +44,218 @@ struct array_list
     size_t total_capacity;
     const destroy_ctx *destroy;
     const equal_ctx *equal;
+    size_t element_size; // bytes per slot (sizeof(void *) for pointer lists)
+    bool is_typed;       // true if elements are stored by value
+    double growth_factor;
+    size_t growth_chunk;
+    size_t mmap_threshold; // buffers of at least this many bytes live in an anonymous mapping
+    bool is_mapped;        // true if elements points to a mapping rather than the heap
+    size_t mapped_bytes;   // length of the mapping
+    const hash_ctx *hash;  // set if the list keeps a hash index of its elements
+    index_entry_t *index;  // open-addressed (linear probing) table of element positions
+    size_t index_capacity; // number of entries in the table, always a power of two
+    size_t index_count;    // number of used entries
+    const compare_ctx *order; // set if the list is kept sorted
+    bool is_unique;           // true if a sorted list rejects duplicates
+    bool is_inline;           // true if elements points at inline_buffer
+    size_t destroy_threads;   // threads used to destroy large ranges
+    bool destroy_in_background;
+    array_list_snapshot_t *snapshot; // set while the buffer is shared with snapshots
+    _Alignas(max_align_t) unsigned char inline_buffer[INLINE_BUFFER_SIZE]; // small lists need no second allocation
+};
+
+struct array_list_snapshot
+{
+    atomic_size_t references; // one per holder, plus one while the list still uses the buffer
+    void *elements;
+    size_t current_size;
+    size_t element_size;
+    bool is_typed;
+    bool is_mapped;        // true if elements is a mapping to unmap rather than free
+    size_t mapped_bytes;   // length of the mapping
+    size_t payload_offset; // bytes from the start of the mapping to elements
+    bool is_read_only;     // true for a mapped file, which is copied before every first write
 };
 
-static exit_code_t array_list_reallocate(array_list_t *list);
+// Laid out at the start of a saved list; the elements follow at payload_offset
+typedef struct file_header
+{
+    char magic[FILE_MAGIC_SIZE];
+    uint64_t element_size;
+    uint64_t count;
+    uint64_t checksum;       // 64-bit FNV-1a of the elements
+    uint64_t payload_offset; // a whole number of pages, so the elements start page-aligned
+} file_header_t;
+
+typedef struct destroy_task
+{
+    array_list_t *list;
+    size_t index;
+    size_t count;
+} destroy_task_t;
+
+typedef struct batch
+{
+    array_list_t *list;
+    const void *data; // the caller's elements, laid out as for array_list_insert_range
+} batch_t;
+
+// array_list_destroy calls still running on background threads
+static pthread_mutex_t background_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t background_done = PTHREAD_COND_INITIALIZER;
+static size_t background_destroys = 0;
+
+static exit_code_t array_list_reallocate(array_list_t *list, size_t required_capacity);
+static exit_code_t resize_buffer(array_list_t *list, size_t new_capacity);
+static void release_buffer(array_list_t *list);
+static exit_code_t prepare_write(array_list_t *list);
+static void drop_reference(array_list_snapshot_t *snapshot);
+static uint64_t checksum_bytes(const void *data, size_t num_bytes);
+static size_t get_page_size(void);
+#ifdef ARRAY_LIST_HAS_MMAP
+static void *map_file(const char *path, file_header_t *header, size_t *file_bytes);
+#endif
+#ifdef ARRAY_LIST_HAS_MREMAP
+static exit_code_t resize_mapping(array_list_t *list, size_t num_bytes);
+#endif
 static void clear_list(array_list_t **list);
-static void collapse(array_list_t *list, size_t index);
-static void expand(array_list_t *list, size_t index);
+static void collapse(array_list_t *list, size_t index, size_t count);
+static void expand(array_list_t *list, size_t index, size_t count);
+static exit_code_t check_range_data(array_list_t *list, const void *data, size_t count);
+static void *slot_at(array_list_t *list, size_t index);
+static void *element_at(array_list_t *list, size_t index);
+static void store_element(array_list_t *list, size_t index, void *data);
+static void destroy_element(array_list_t *list, size_t index);
+static void destroy_range(array_list_t *list, size_t index, size_t count);
+static void destroy_range_serial(array_list_t *list, size_t index, size_t count);
+static void *destroy_shard(void *task);
+static void *destroy_in_background(void *list);
+static bool keep_unmatched(array_list_t *list, size_t read, size_t write, const void *ctx);
+static bool keep_distinct(array_list_t *list, size_t read, size_t write, const void *ctx);
+static size_t compact(array_list_t *list, bool (*keep)(array_list_t *, size_t, size_t, const void *), const void *ctx);
+static exit_code_t index_reserve(array_list_t *list, size_t additional);
+static exit_code_t index_resize(array_list_t *list, size_t new_capacity);
+static void index_place(array_list_t *list, size_t hash, size_t position);
+static void index_add(array_list_t *list, size_t position);
+static void index_delete(array_list_t *list, size_t position);
+static void index_shift(array_list_t *list, size_t from, size_t count, bool up);
+static bool index_lookup(array_list_t *list, void *data, size_t *position);
+static bool linear_lookup(array_list_t *list, void *data, size_t *position);
+static size_t index_count_matches(array_list_t *list, void *data);
+static size_t linear_count(array_list_t *list, void *data);
+static bool word_search_mask(array_list_t *list, uintptr_t *mask);
+static void index_rebuild(array_list_t *list);
+static int compare_stored(const void *x, const void *y, const void *ctx);
+static exit_code_t sort_list(array_list_t *list, const compare_ctx *compare, bool parallel, size_t threads);
+static int compare_to(array_list_t *list, size_t index, const void *data);
+static size_t search_bound(array_list_t *list, const void *data, bool upper);
+static exit_code_t check_order(array_list_t *list, size_t index, const void *data, bool replacing);
+static exit_code_t check_range_order(array_list_t *list, size_t index, const void *data, size_t count);
+static const void *range_element(array_list_t *list, const void *data, size_t index);
+static exit_code_t merge_batch(array_list_t *list, const void *data, size_t count);
+static int compare_batch(const void *x, const void *y, const void *ctx);
+static exit_code_t bound_query(array_list_t *list, void *data, size_t *first, size_t *last);
 
 array_list_t *array_list_create(const destroy_ctx *destroy, const equal_ctx *equal)
 {
-    array_list_t *array_list = calloc(1, sizeof(array_list_t));
-    if (NULL == array_list)
+    return array_list_create_with_options(NULL, destroy, equal);
+}
+
+array_list_t *array_list_create_typed(size_t element_size, const destroy_ctx *destroy, const equal_ctx *equal)
+{
+    array_list_t *array_list = NULL;
+
+    if (0 == element_size)
     {
         goto END;
     }
 
-    array_list->elements = calloc(INITIAL_CAPACITY, sizeof(void*));
-    if (NULL == array_list->elements)
+    array_list_options_t options = {0};
+    options.element_size = element_size;
+
+    array_list = array_list_create_with_options(&options, destroy, equal);
+
+END:
+    return array_list;
+}
+
+array_list_t *array_list_create_with_options(const array_list_options_t *options, const destroy_ctx *destroy, const equal_ctx *equal)
+{
+    array_list_t *array_list = NULL;
+    array_list_options_t defaults = {0};
+
+    if (NULL == options)
+    {
+        options = &defaults;
+    }
+
+    // Anything but 0 (the default) must be above 1 or the list would never grow; NaN and negatives included
+    bool is_default_factor = (false == isnan(options->growth_factor)) && !(options->growth_factor < 0.0) &&
+                             !(options->growth_factor > 0.0);
+    if ((false == is_default_factor) && !(options->growth_factor > 1.0))
     {
-        free(array_list);
         goto END;
     }
 
-    array_list->current_size = 0;
-    array_list->total_capacity = INITIAL_CAPACITY;
+    // The hash index needs equal to tell apart elements that share a hash
+    if ((NULL != options->hash) && (NULL == equal))
+    {
+        goto END;
+    }
+
+    // Only a sorted list can find duplicates cheaply enough to reject them
+    if ((true == options->unique) && (NULL == options->order))
+    {
+        goto END;
+    }
+
+    array_list = calloc(1, sizeof(array_list_t));
+    if (NULL == array_list)
+    {
+        goto END;
+    }
+
+    array_list->is_typed = (0 != options->element_size);
+    array_list->element_size = array_list->is_typed ? options->element_size : sizeof(void *);
+    array_list->growth_factor = (options->growth_factor > 0.0) ? options->growth_factor : DEFAULT_GROWTH_FACTOR;
+    array_list->growth_chunk = options->growth_chunk;
+    array_list->mmap_threshold = (0 != options->mmap_threshold) ? options->mmap_threshold : DEFAULT_MMAP_THRESHOLD;
     array_list->destroy = destroy;
     array_list->equal = equal;
+    array_list->hash = options->hash;
+    array_list->order = options->order;
+    array_list->is_unique = options->unique;
+    array_list->destroy_threads = options->destroy_threads;
+    array_list->destroy_in_background = options->destroy_in_background;
+    array_list->current_size = 0;
+
+    size_t initial_capacity = (0 != options->initial_capacity) ? options->initial_capacity : INITIAL_CAPACITY;
+
+    // Allocate through the same path as growth so large lists start out mapped
+    if (E_SUCCESS != resize_buffer(array_list, initial_capacity))
+    {
+        free(array_list);
+        array_list = NULL;
+        goto END;
+    }
+
+END:
+    return array_list;
+}
+
+array_list_t *array_list_create_sorted(const compare_ctx *compare, const destroy_ctx *destroy)
+{
+    array_list_t *array_list = NULL;
+
+    if ((NULL == compare) || (NULL == compare->compare))
+    {
+        goto END;
+    }
+
+    array_list_options_t options = {0};
+    options.order = compare;
+
+    array_list = array_list_create_with_options(&options, destroy, NULL);
 
 END:
     return array_list;
@@ -60,20 +283,46 @@ exit_code_t array_list_insert(array_list_t *list, size_t index, void *data)
         goto END;
     }
 
+    exit_code = check_order(list, index, data, false);
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
+
+    exit_code = prepare_write(list);
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
+
     // Check if space needs to be reallocated
     if (list->current_size == list->total_capacity)
     {
-        exit_code = array_list_reallocate(list);
+        exit_code = array_list_reallocate(list, list->current_size + 1);
         if (E_SUCCESS != exit_code)
         {
             goto END;
         }
     }
 
+    exit_code = index_reserve(list, 1);
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
+
     // Make space for the new data
-    expand(list, index);
+    expand(list, index, 1);
+
+    store_element(list, index, data);
+    list->current_size++;
 
-    list->elements[list->current_size++] = data;
+    // Keep the hash index in step
+    if (index + 1 < list->current_size)
+    {
+        index_shift(list, index, 1, true);
+    }
+    index_add(list, index);
     
     exit_code = E_SUCCESS;
 END:
@@ -96,8 +345,11 @@ exit_code_t push(array_list_t *list, void *data)
         goto END;
     }
 
-    exit_code = array_list_insert(list, list->current_size, data);
-    if (NULL == exit_code)
+    // Sorted lists place the element after any equal ones
+    size_t index = (NULL != list->order) ? search_bound(list, data, true) : list->current_size;
+
+    exit_code = array_list_insert(list, index, data);
+    if (E_SUCCESS != exit_code)
     {
         goto END;
     }
@@ -107,27 +359,36 @@ END:
     return exit_code;
 }
 
-void *array_list_get(array_list_t *list, size_t index)
+exit_code_t array_list_push_many(array_list_t *list, const void *data, size_t count)
 {
-    void *element = NULL;
+    exit_code_t exit_code = E_DEFAULT_ERROR;
 
     if (NULL == list)
     {
+        exit_code = E_LIST_ERROR;
         goto END;
     }
 
-    if (index >= list->current_size)
+    if (NULL == list->order)
+    {
+        exit_code = array_list_insert_range(list, list->current_size, data, count);
+        goto END;
+    }
+
+    exit_code = check_range_data(list, data, count);
+    if ((E_SUCCESS != exit_code) || (0 == count))
     {
         goto END;
     }
 
-    element = list->elements[index];
+    // Sorted lists sort the batch and merge it in, rather than searching and shifting per element
+    exit_code = merge_batch(list, data, count);
 
 END:
-    return element;
+    return exit_code;
 }
 
-exit_code_t array_list_set(array_list_t *list, size_t index, void *data)
+exit_code_t array_list_insert_range(array_list_t *list, size_t index, const void *data, size_t count)
 {
     exit_code_t exit_code = E_DEFAULT_ERROR;
 
@@ -137,32 +398,68 @@ exit_code_t array_list_set(array_list_t *list, size_t index, void *data)
         goto END;
     }
 
-    if (index >= list->current_size)
+    if (index > list->current_size)
     {
         exit_code = E_OUT_OF_BOUNDS;
         goto END;
     }
 
-    if (NULL == data)
+    exit_code = check_range_data(list, data, count);
+    if ((E_SUCCESS != exit_code) || (0 == count))
     {
-        exit_code = E_NULL_POINTER;
         goto END;
     }
 
-    // destroy the data if necessary
-    if (list->destroy)
+    exit_code = check_range_order(list, index, data, count);
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
+
+    exit_code = prepare_write(list);
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
+
+    // Grow once for the whole batch
+    if (list->total_capacity - list->current_size < count)
+    {
+        exit_code = array_list_reallocate(list, list->current_size + count);
+        if (E_SUCCESS != exit_code)
+        {
+            goto END;
+        }
+    }
+
+    exit_code = index_reserve(list, count);
+    if (E_SUCCESS != exit_code)
     {
-        list->destroy->destroy(list->elements[index], list->destroy->context);
+        goto END;
     }
 
-    list->elements[index] = data;
+    // Make space for the whole batch with a single move
+    expand(list, index, count);
+
+    memcpy(slot_at(list, index), data, count * list->element_size);
+    list->current_size += count;
+
+    // Keep the hash index in step
+    if (index + count < list->current_size)
+    {
+        index_shift(list, index, count, true);
+    }
+    for (size_t position = index; position < index + count; position++)
+    {
+        index_add(list, position);
+    }
 
     exit_code = E_SUCCESS;
 END:
     return exit_code;
 }
 
-exit_code_t array_list_remove(array_list_t *list, size_t index)
+exit_code_t array_list_remove_range(array_list_t *list, size_t index, size_t count)
 {
     exit_code_t exit_code = E_DEFAULT_ERROR;
 
@@ -172,64 +469,91 @@ exit_code_t array_list_remove(array_list_t *list, size_t index)
         goto END;
     }
 
-    if (index >= list->current_size)
+    if ((index > list->current_size) || (count > list->current_size - index))
     {
         exit_code = E_OUT_OF_BOUNDS;
         goto END;
     }
 
-    // destroy the data if necessary
-    if (list->destroy)
+    exit_code = prepare_write(list);
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
+
+    // drop the elements from the hash index while they can still be hashed
+    for (size_t position = index; position < index + count; position++)
     {
-        list->destroy->destroy(list->elements[index], list->destroy->context);
+        index_delete(list, position);
     }
 
-    // close the empty gap
-    collapse(list, index);
+    // destroy the data if necessary
+    destroy_range(list, index, count);
+
+    // close the empty gap with a single move
+    collapse(list, index, count);
+
+    // Keep the hash index in step; removing from the end moves nothing
+    if (index < list->current_size)
+    {
+        index_shift(list, index + count, count, false);
+    }
 
     exit_code = E_SUCCESS;
 END:
     return exit_code;
 }
 
-size_t array_list_size(array_list_t *list)
+void *array_list_get(array_list_t *list, size_t index)
 {
-    int size = -1; // Set fail state
+    void *element = NULL;
 
-    if (list == NULL)
+    if (NULL == list)
     {
         goto END;
     }
 
-    size = (int)list->current_size;
+    if (index >= list->current_size)
+    {
+        goto END;
+    }
+
+    element = element_at(list, index);
 
 END:
-    return size;
+    return element;
 }
 
-bool array_list_contains(array_list_t *list, void *data)
+exit_code_t array_list_get_value(array_list_t *list, size_t index, void *out)
 {
-    bool contains_data = false;
+    exit_code_t exit_code = E_DEFAULT_ERROR;
 
-    if ((NULL == list) || (NULL == data))
+    if (NULL == list)
     {
+        exit_code = E_LIST_ERROR;
         goto END;
     }
 
-    // Check if the the data is in the list
-    for (size_t idx = 0; idx < list->current_size; idx++)
+    if (index >= list->current_size)
     {
-        if (true == list->equal->equal(list->elements[idx], data, list->equal->ctx))
-        {
-            contains_data = true;
-        }
+        exit_code = E_OUT_OF_BOUNDS;
+        goto END;
+    }
+
+    if (NULL == out)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
     }
 
+    memcpy(out, slot_at(list, index), list->element_size);
+
+    exit_code = E_SUCCESS;
 END:
-    return contains_data;
+    return exit_code;
 }
 
-exit_code_t array_list_reallocate(array_list_t *list)
+exit_code_t array_list_set(array_list_t *list, size_t index, void *data)
 {
     exit_code_t exit_code = E_DEFAULT_ERROR;
 
@@ -239,102 +563,2239 @@ exit_code_t array_list_reallocate(array_list_t *list)
         goto END;
     }
 
-    // Attempt to double the size of the array list
-    void **temp = realloc(list->elements, (list->total_capacity * 2) * (sizeof(*list->elements)));
-    if (NULL == temp)
+    if (index >= list->current_size)
     {
-        exit_code = E_CMR_FAILURE;
-        list->current_size--;
+        exit_code = E_OUT_OF_BOUNDS;
         goto END;
     }
 
-    list->total_capacity *= 2;  // update the capacity
-    list->elements = temp;
+    if (NULL == data)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    exit_code = check_order(list, index, data, true);
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
+
+    exit_code = prepare_write(list);
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
+
+    index_delete(list, index);
+
+    // destroy the data if necessary
+    destroy_element(list, index);
+
+    store_element(list, index, data);
+    index_add(list, index);
 
     exit_code = E_SUCCESS;
 END:
     return exit_code;
 }
 
-bool array_list_is_empty(array_list_t *list)
+exit_code_t array_list_remove(array_list_t *list, size_t index)
 {
-    bool is_empty = false;
+    exit_code_t exit_code = E_DEFAULT_ERROR;
 
     if (NULL == list)
     {
+        exit_code = E_LIST_ERROR;
         goto END;
     }
 
-    if (list->current_size == 0)
+    if (index >= list->current_size)
     {
-        is_empty = true;
+        exit_code = E_OUT_OF_BOUNDS;
+        goto END;
     }
 
-END:
-    return is_empty;
-}
-
-void array_list_destroy(array_list_t **list)
-{
-    if (NULL == list)
+    exit_code = prepare_write(list);
+    if (E_SUCCESS != exit_code)
     {
         goto END;
     }
 
-    clear_list(list);
+    index_delete(list, index);
 
-    free(*list);
-    list = NULL;
+    // destroy the data if necessary
+    destroy_element(list, index);
+
+    // close the empty gap
+    collapse(list, index, 1);
+
+    // Keep the hash index in step; removing from the end moves nothing
+    if (index < list->current_size)
+    {
+        index_shift(list, index + 1, 1, false);
+    }
 
+    exit_code = E_SUCCESS;
 END:
-    return;
+    return exit_code;
 }
 
-void clear_list(array_list_t **list)
+exit_code_t array_list_remove_value(array_list_t *list, size_t index, void *out)
 {
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
     if (NULL == list)
     {
+        exit_code = E_LIST_ERROR;
         goto END;
     }
 
-    // destroy the data if necessary
-    if ((*list)->destroy)
+    if (index >= list->current_size)
     {
-        for (size_t idx = 0; idx < (*list)->current_size; idx++)
-        {
-            (*list)->destroy->destroy((*list)->elements[idx], (*list)->destroy->context);
-        }
+        exit_code = E_OUT_OF_BOUNDS;
+        goto END;
     }
 
-    free((*list)->elements);
-    (*list)->elements = NULL;
+    exit_code = prepare_write(list);
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
 
-END:
-    return;
-}
+    index_delete(list, index);
 
-void collapse(array_list_t *list, size_t index)
-{
-    void *dst = list->elements + index;     // current element
-    void *src = list->elements + index + 1; // next element
+    // hand the element over to the caller instead of destroying it
+    if (NULL != out)
+    {
+        memcpy(out, slot_at(list, index), list->element_size);
+    }
 
-    list->current_size--; // shorten the list by 1 element
+    // close the empty gap
+    collapse(list, index, 1);
 
-    // number of bytes to be copied
-    size_t num_bytes = (list->current_size - index) * sizeof(*list->elements);
+    // Keep the hash index in step; removing from the end moves nothing
+    if (index < list->current_size)
+    {
+        index_shift(list, index + 1, 1, false);
+    }
 
-    // shift the next element forward
-    memmove(dst, src, num_bytes);
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
 }
 
-void expand(array_list_t *list, size_t index)
+exit_code_t array_list_remove_if(array_list_t *list, const predicate_ctx *predicate, size_t *removed)
 {
-    void *dst = list->elements + index + 1; // next element
-    void *src = list->elements + index;     // current element
+    exit_code_t exit_code = E_DEFAULT_ERROR;
 
-    // number of bytes to be copied
-    size_t num_bytes = (list->current_size - index) * sizeof(*list->elements);
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
 
-    // shift the current element backward
-    memmove(dst, src, num_bytes);
-}
\ No newline at end of file
+    if ((NULL == predicate) || (NULL == predicate->predicate))
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    exit_code = prepare_write(list);
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
+
+    size_t count = compact(list, keep_unmatched, predicate);
+    if (NULL != removed)
+    {
+        *removed = count;
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t array_list_partition(array_list_t *list, const predicate_ctx *predicate, size_t *split)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    if ((NULL == predicate) || (NULL == predicate->predicate) || (NULL == split))
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    if (NULL != list->order)
+    {
+        exit_code = E_OUT_OF_ORDER;
+        goto END;
+    }
+
+    exit_code = prepare_write(list);
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
+
+    // Accepted elements grow from the front, rejected ones from the back; each element is tested once
+    size_t front = 0;
+    size_t back = list->current_size;
+    while (front < back)
+    {
+        if (true == predicate->predicate(element_at(list, front), predicate->ctx))
+        {
+            front++;
+        }
+        else
+        {
+            back--;
+            swap(slot_at(list, front), slot_at(list, back), list->element_size);
+        }
+    }
+
+    *split = front;
+    index_rebuild(list);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t array_list_map_inplace(array_list_t *list, const map_ctx *map)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    if ((NULL == map) || (NULL == map->map))
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // The new values could land anywhere in the order
+    if (NULL != list->order)
+    {
+        exit_code = E_OUT_OF_ORDER;
+        goto END;
+    }
+
+    exit_code = prepare_write(list);
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
+
+    for (size_t idx = 0; idx < list->current_size; idx++)
+    {
+        void *mapped = map->map(element_at(list, idx), map->ctx);
+
+        if (false == list->is_typed)
+        {
+            if (NULL == mapped)
+            {
+                exit_code = E_NULL_POINTER;
+                break;
+            }
+            list->elements[idx] = mapped;
+        }
+    }
+
+    // Values changed, so their hashes did too
+    index_rebuild(list);
+
+END:
+    return exit_code;
+}
+
+exit_code_t array_list_unique(array_list_t *list, size_t *removed)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    if ((NULL == list->equal) && (NULL == list->order))
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    exit_code = prepare_write(list);
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
+
+    size_t count = compact(list, keep_distinct, NULL);
+    if (NULL != removed)
+    {
+        *removed = count;
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+size_t array_list_size(array_list_t *list)
+{
+    int size = -1; // Set fail state
+
+    if (list == NULL)
+    {
+        goto END;
+    }
+
+    size = (int)list->current_size;
+
+END:
+    return size;
+}
+
+size_t array_list_capacity(array_list_t *list)
+{
+    size_t capacity = 0;
+
+    if (NULL == list)
+    {
+        goto END;
+    }
+
+    capacity = list->total_capacity;
+
+END:
+    return capacity;
+}
+
+exit_code_t array_list_reserve(array_list_t *list, size_t capacity)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // Never shrinks; only grows to exactly the requested capacity
+    if (capacity <= list->total_capacity)
+    {
+        exit_code = E_SUCCESS;
+        goto END;
+    }
+
+    exit_code = prepare_write(list);
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
+
+    exit_code = resize_buffer(list, capacity);
+
+END:
+    return exit_code;
+}
+
+exit_code_t array_list_shrink_to_fit(array_list_t *list)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // Keep at least one slot so the buffer is never a zero-sized allocation
+    size_t new_capacity = (0 != list->current_size) ? list->current_size : 1;
+
+    if (new_capacity >= list->total_capacity)
+    {
+        exit_code = E_SUCCESS;
+        goto END;
+    }
+
+    exit_code = prepare_write(list);
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
+
+    exit_code = resize_buffer(list, new_capacity);
+
+END:
+    return exit_code;
+}
+
+bool array_list_contains(array_list_t *list, void *data)
+{
+    bool contains_data = false;
+    size_t position = 0;
+
+    if ((NULL == list) || (NULL == data) || ((NULL == list->equal) && (NULL == list->order)))
+    {
+        goto END;
+    }
+
+    // Check if the the data is in the list
+    if (NULL != list->order)
+    {
+        position = search_bound(list, data, false);
+        contains_data = (position < list->current_size) && (0 == compare_to(list, position, data));
+    }
+    else if (NULL != list->hash)
+    {
+        contains_data = index_lookup(list, data, &position);
+    }
+    else
+    {
+        contains_data = linear_lookup(list, data, &position);
+    }
+
+END:
+    return contains_data;
+}
+
+exit_code_t array_list_index_of(array_list_t *list, void *data, size_t *index)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+    bool found = false;
+
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    if ((NULL == data) || (NULL == index) || ((NULL == list->equal) && (NULL == list->order)))
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    if (NULL != list->order)
+    {
+        *index = search_bound(list, data, false);
+        found = (*index < list->current_size) && (0 == compare_to(list, *index, data));
+    }
+    else if (NULL != list->hash)
+    {
+        found = index_lookup(list, data, index);
+    }
+    else
+    {
+        found = linear_lookup(list, data, index);
+    }
+
+    exit_code = found ? E_SUCCESS : E_KEY_NOT_FOUND;
+END:
+    return exit_code;
+}
+
+exit_code_t array_list_sort(array_list_t *list, const compare_ctx *compare)
+{
+    return sort_list(list, compare, false, 0);
+}
+
+exit_code_t array_list_sort_parallel(array_list_t *list, const compare_ctx *compare, size_t threads)
+{
+    return sort_list(list, compare, true, threads);
+}
+
+exit_code_t array_list_lower_bound(array_list_t *list, void *data, size_t *index)
+{
+    return bound_query(list, data, index, NULL);
+}
+
+exit_code_t array_list_upper_bound(array_list_t *list, void *data, size_t *index)
+{
+    return bound_query(list, data, NULL, index);
+}
+
+exit_code_t array_list_equal_range(array_list_t *list, void *data, size_t *first, size_t *last)
+{
+    exit_code_t exit_code = E_NULL_POINTER;
+
+    if ((NULL != first) && (NULL != last))
+    {
+        exit_code = bound_query(list, data, first, last);
+    }
+
+    return exit_code;
+}
+
+frozen_search_t *array_list_freeze_search(array_list_t *list, const compare_ctx *compare)
+{
+    frozen_search_t *search = NULL;
+    void *sorted = NULL;
+
+    if ((NULL == list) || (NULL == compare) || (NULL == compare->compare))
+    {
+        goto END;
+    }
+
+    size_t frozen_size = list->is_typed ? list->element_size : 0;
+
+    // A list already in this order can be laid out directly
+    if ((compare == list->order) || (list->current_size < 2))
+    {
+        search = frozen_search_create(list->elements, list->current_size, frozen_size, compare);
+        goto END;
+    }
+
+    sorted = malloc(list->current_size * list->element_size);
+    if (NULL == sorted)
+    {
+        goto END;
+    }
+
+    memcpy(sorted, list->elements, list->current_size * list->element_size);
+
+    compare_ctx stored = {compare_stored, compare};
+    introsort(sorted, list->current_size, list->element_size, list->is_typed ? compare : &stored);
+
+    search = frozen_search_create(sorted, list->current_size, frozen_size, compare);
+
+END:
+    free(sorted);
+    return search;
+}
+
+size_t array_list_count(array_list_t *list, void *data)
+{
+    size_t matches = 0;
+
+    if ((NULL == list) || (NULL == data) || ((NULL == list->equal) && (NULL == list->order)))
+    {
+        goto END;
+    }
+
+    if (NULL != list->order)
+    {
+        matches = search_bound(list, data, true) - search_bound(list, data, false);
+    }
+    else if (NULL != list->hash)
+    {
+        matches = index_count_matches(list, data);
+    }
+    else
+    {
+        matches = linear_count(list, data);
+    }
+
+END:
+    return matches;
+}
+
+exit_code_t array_list_reallocate(array_list_t *list, size_t required_capacity)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // Apply the growth policy until the required capacity fits, then reallocate once
+    size_t new_capacity = list->total_capacity;
+    while (new_capacity < required_capacity)
+    {
+        size_t grown = 0;
+
+        if (SIZE_MAX == new_capacity)
+        {
+            exit_code = E_CMR_FAILURE;
+            goto END;
+        }
+
+        // Saturate instead of wrapping; resize_buffer rejects sizes that cannot be allocated
+        if (0 != list->growth_chunk)
+        {
+            grown = (list->growth_chunk < SIZE_MAX - new_capacity) ? new_capacity + list->growth_chunk : SIZE_MAX;
+        }
+        else
+        {
+            double scaled = (double)new_capacity * list->growth_factor;
+            grown = (scaled < (double)SIZE_MAX) ? (size_t)scaled : SIZE_MAX;
+        }
+
+        // Always make progress, even for tiny capacities and factors close to 1
+        if (grown <= new_capacity)
+        {
+            grown = new_capacity + 1;
+        }
+
+        new_capacity = grown;
+    }
+
+    exit_code = resize_buffer(list, new_capacity);
+
+END:
+    return exit_code;
+}
+
+exit_code_t resize_buffer(array_list_t *list, size_t new_capacity)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if (new_capacity > SIZE_MAX / list->element_size)
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
+
+    size_t num_bytes = new_capacity * list->element_size;
+
+#ifdef ARRAY_LIST_HAS_MREMAP
+    // Large buffers are remapped by the kernel instead of being copied by realloc
+    if ((true == list->is_mapped) || (num_bytes >= list->mmap_threshold))
+    {
+        exit_code = resize_mapping(list, num_bytes);
+        goto END;
+    }
+#endif
+
+    // Small buffers live inside the list; moving back in from the heap frees the heap copy
+    if (num_bytes <= INLINE_BUFFER_SIZE)
+    {
+        if (false == list->is_inline)
+        {
+            if (NULL != list->elements)
+            {
+                memcpy(list->inline_buffer, list->elements, list->current_size * list->element_size);
+                free(list->elements);
+            }
+            list->elements = (void **)list->inline_buffer;
+            list->is_inline = true;
+        }
+
+        list->total_capacity = new_capacity; // the growth policy sees the same capacities either way
+        exit_code = E_SUCCESS;
+        goto END;
+    }
+
+    void **temp = NULL;
+    if (true == list->is_inline)
+    {
+        // Spill to the heap; realloc cannot move memory it does not own
+        temp = malloc(num_bytes);
+        if (NULL != temp)
+        {
+            memcpy(temp, list->inline_buffer, list->current_size * list->element_size);
+            list->is_inline = false;
+        }
+    }
+    else
+    {
+        temp = realloc(list->elements, num_bytes);
+    }
+
+    if (NULL == temp)
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
+
+    list->total_capacity = new_capacity;  // update the capacity
+    list->elements = temp;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+#ifdef ARRAY_LIST_HAS_MREMAP
+exit_code_t resize_mapping(array_list_t *list, size_t num_bytes)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+    void *mapping = MAP_FAILED;
+
+    // Mappings come in whole pages, so round up and use the slack as capacity
+    size_t page_size = get_page_size();
+    if (num_bytes > SIZE_MAX - page_size)
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
+
+    size_t mapped_bytes = ((num_bytes + page_size - 1) / page_size) * page_size;
+
+    if (true == list->is_mapped)
+    {
+        mapping = mremap(list->elements, list->mapped_bytes, mapped_bytes, MREMAP_MAYMOVE);
+        if (MAP_FAILED == mapping)
+        {
+            exit_code = E_CMR_FAILURE;
+            goto END;
+        }
+    }
+    else
+    {
+        // Crossing the threshold costs one last copy out of the heap
+        mapping = mmap(NULL, mapped_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (MAP_FAILED == mapping)
+        {
+            exit_code = E_CMR_FAILURE;
+            goto END;
+        }
+
+        if (NULL != list->elements)
+        {
+            memcpy(mapping, list->elements, list->current_size * list->element_size);
+        }
+
+        if (false == list->is_inline)
+        {
+            free(list->elements);
+        }
+        list->is_inline = false;
+    }
+
+    list->elements = mapping;
+    list->is_mapped = true;
+    list->mapped_bytes = mapped_bytes;
+    list->total_capacity = mapped_bytes / list->element_size;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+#endif
+
+bool array_list_is_empty(array_list_t *list)
+{
+    bool is_empty = false;
+
+    if (NULL == list)
+    {
+        goto END;
+    }
+
+    if (list->current_size == 0)
+    {
+        is_empty = true;
+    }
+
+END:
+    return is_empty;
+}
+
+void array_list_destroy(array_list_t **list)
+{
+    if ((NULL == list) || (NULL == *list))
+    {
+        goto END;
+    }
+
+    // Only worth a thread if there is something to destroy; if it cannot start, destroy here
+    if ((true == (*list)->destroy_in_background) && (NULL != (*list)->destroy) && (0 != (*list)->current_size))
+    {
+        pthread_t thread;
+
+        pthread_mutex_lock(&background_lock);
+        background_destroys++;
+        pthread_mutex_unlock(&background_lock);
+
+        if (0 == pthread_create(&thread, NULL, destroy_in_background, *list))
+        {
+            pthread_detach(thread);
+            *list = NULL;
+            goto END;
+        }
+
+        pthread_mutex_lock(&background_lock);
+        background_destroys--;
+        pthread_mutex_unlock(&background_lock);
+    }
+
+    clear_list(list);
+
+    free(*list);
+    *list = NULL;
+
+END:
+    return;
+}
+
+void array_list_wait_for_background_destroys(void)
+{
+    pthread_mutex_lock(&background_lock);
+    while (0 != background_destroys)
+    {
+        pthread_cond_wait(&background_done, &background_lock);
+    }
+    pthread_mutex_unlock(&background_lock);
+}
+
+array_list_snapshot_t *array_list_snapshot(array_list_t *list)
+{
+    array_list_snapshot_t *snapshot = NULL;
+
+    if (NULL == list)
+    {
+        goto END;
+    }
+
+    // Nothing has been written since the last snapshot, so it still matches the list
+    if (NULL != list->snapshot)
+    {
+        snapshot = array_list_snapshot_retain(list->snapshot);
+        goto END;
+    }
+
+    snapshot = calloc(1, sizeof(array_list_snapshot_t));
+    if (NULL == snapshot)
+    {
+        goto END;
+    }
+
+    snapshot->current_size = list->current_size;
+    snapshot->element_size = list->element_size;
+    snapshot->is_typed = list->is_typed;
+
+    // The inline buffer lives inside the list, so the snapshot gets its own (small) copy of it
+    if (true == list->is_inline)
+    {
+        snapshot->elements = malloc(INLINE_BUFFER_SIZE);
+        if (NULL == snapshot->elements)
+        {
+            free(snapshot);
+            snapshot = NULL;
+            goto END;
+        }
+
+        memcpy(snapshot->elements, list->elements, list->current_size * list->element_size);
+        atomic_init(&snapshot->references, 1);
+        goto END;
+    }
+
+    // Share the buffer; the list copies it before its next write
+    snapshot->elements = list->elements;
+    snapshot->is_mapped = list->is_mapped;
+    snapshot->mapped_bytes = list->mapped_bytes;
+    atomic_init(&snapshot->references, 2);
+    list->snapshot = snapshot;
+
+END:
+    return snapshot;
+}
+
+array_list_snapshot_t *array_list_snapshot_retain(array_list_snapshot_t *snapshot)
+{
+    if (NULL != snapshot)
+    {
+        // A new reference can only come from an existing one, so no ordering is needed
+        atomic_fetch_add_explicit(&snapshot->references, 1, memory_order_relaxed);
+    }
+
+    return snapshot;
+}
+
+void array_list_snapshot_release(array_list_snapshot_t **snapshot)
+{
+    if ((NULL == snapshot) || (NULL == *snapshot))
+    {
+        goto END;
+    }
+
+    drop_reference(*snapshot);
+    *snapshot = NULL;
+
+END:
+    return;
+}
+
+const void *array_list_snapshot_get(const array_list_snapshot_t *snapshot, size_t index)
+{
+    const void *element = NULL;
+
+    if ((NULL == snapshot) || (index >= snapshot->current_size))
+    {
+        goto END;
+    }
+
+    const unsigned char *slot = (const unsigned char *)snapshot->elements + (index * snapshot->element_size);
+    element = snapshot->is_typed ? (const void *)slot : *(void *const *)slot;
+
+END:
+    return element;
+}
+
+size_t array_list_snapshot_size(const array_list_snapshot_t *snapshot)
+{
+    size_t size = 0;
+
+    if (NULL == snapshot)
+    {
+        goto END;
+    }
+
+    size = snapshot->current_size;
+
+END:
+    return size;
+}
+
+exit_code_t array_list_save(array_list_t *list, const char *path)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+    FILE *file = NULL;
+    char *temp_path = NULL;
+    unsigned char *header_page = NULL;
+
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    if (NULL == path)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // Stored pointers mean nothing to the next process
+    if (false == list->is_typed)
+    {
+        exit_code = E_INVALID_INPUT;
+        goto END;
+    }
+
+    size_t payload_offset = get_page_size();
+    size_t num_bytes = list->current_size * list->element_size;
+
+    file_header_t header = {FILE_MAGIC, list->element_size, list->current_size,
+                            checksum_bytes(list->elements, num_bytes), payload_offset};
+
+    header_page = calloc(1, payload_offset);
+    temp_path = malloc(strlen(path) + sizeof(".tmp"));
+    if ((NULL == header_page) || (NULL == temp_path))
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
+    memcpy(header_page, &header, sizeof(file_header_t));
+
+    // Write beside the target and rename over it, so a list mapped from path never sees a half-written file
+    sprintf(temp_path, "%s.tmp", path);
+    file = fopen(temp_path, "wb");
+    if (NULL == file)
+    {
+        exit_code = E_FILE_NOT_WRITEABLE;
+        goto END;
+    }
+
+    if ((1 != fwrite(header_page, payload_offset, 1, file)) ||
+        ((0 != num_bytes) && (1 != fwrite(list->elements, num_bytes, 1, file))))
+    {
+        exit_code = E_FILE_NOT_WRITEABLE;
+        goto END;
+    }
+
+    int closed = fclose(file);
+    file = NULL;
+    if ((0 != closed) || (0 != rename(temp_path, path)))
+    {
+        exit_code = E_FILE_NOT_WRITEABLE;
+        goto END;
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    if (NULL != file)
+    {
+        fclose(file);
+    }
+    if ((E_SUCCESS != exit_code) && (NULL != temp_path))
+    {
+        remove(temp_path);
+    }
+    free(temp_path);
+    free(header_page);
+    return exit_code;
+}
+
+array_list_t *array_list_map(const char *path, const destroy_ctx *destroy, const equal_ctx *equal)
+{
+    array_list_t *list = NULL;
+
+#ifdef ARRAY_LIST_HAS_MMAP
+    file_header_t header = {0};
+    size_t file_bytes = 0;
+    array_list_snapshot_t *file = NULL;
+
+    void *mapping = map_file(path, &header, &file_bytes);
+    if (NULL == mapping)
+    {
+        goto END;
+    }
+
+    list = array_list_create_typed((size_t)header.element_size, destroy, equal);
+    file = calloc(1, sizeof(array_list_snapshot_t));
+    if ((NULL == list) || (NULL == file))
+    {
+        munmap(mapping, file_bytes);
+        array_list_destroy(&list);
+        free(file);
+        goto END;
+    }
+
+    // The list reads straight out of the page cache; its first write moves it to a private copy
+    file->elements = (unsigned char *)mapping + header.payload_offset;
+    file->current_size = (size_t)header.count;
+    file->element_size = (size_t)header.element_size;
+    file->is_typed = true;
+    file->is_mapped = true;
+    file->mapped_bytes = file_bytes;
+    file->payload_offset = (size_t)header.payload_offset;
+    file->is_read_only = true;
+    atomic_init(&file->references, 1);
+
+    release_buffer(list);
+    list->elements = file->elements;
+    list->current_size = file->current_size;
+    list->total_capacity = file->current_size;
+    list->snapshot = file;
+
+END:
+#else
+    (void)path;
+    (void)destroy;
+    (void)equal;
+#endif
+    return list;
+}
+
+exit_code_t array_list_verify_file(const char *path)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if (NULL == path)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+#ifdef ARRAY_LIST_HAS_MMAP
+    file_header_t header = {0};
+    size_t file_bytes = 0;
+
+    void *mapping = map_file(path, &header, &file_bytes);
+    if (NULL == mapping)
+    {
+        exit_code = E_FILE_NOT_READABLE;
+        goto END;
+    }
+
+    uint64_t checksum = checksum_bytes((unsigned char *)mapping + header.payload_offset,
+                                       (size_t)(header.count * header.element_size));
+    exit_code = (checksum == header.checksum) ? E_SUCCESS : E_INVALID_INPUT;
+
+    munmap(mapping, file_bytes);
+#else
+    exit_code = E_FILE_NOT_READABLE;
+#endif
+
+END:
+    return exit_code;
+}
+
+void clear_list(array_list_t **list)
+{
+    if (NULL == list)
+    {
+        goto END;
+    }
+
+    // destroy the data if necessary
+    destroy_range(*list, 0, (*list)->current_size);
+
+    // A buffer still shared with snapshots is left to its last reader
+    if (NULL != (*list)->snapshot)
+    {
+        drop_reference((*list)->snapshot);
+        (*list)->snapshot = NULL;
+        (*list)->elements = NULL;
+        (*list)->is_mapped = false;
+        (*list)->mapped_bytes = 0;
+        (*list)->total_capacity = 0;
+    }
+    else
+    {
+        release_buffer(*list);
+    }
+
+    free((*list)->index);
+    (*list)->index = NULL;
+    (*list)->index_capacity = 0;
+    (*list)->index_count = 0;
+
+END:
+    return;
+}
+
+void collapse(array_list_t *list, size_t index, size_t count)
+{
+    void *dst = slot_at(list, index);         // first removed element
+    void *src = slot_at(list, index + count); // first element after the gap
+
+    list->current_size -= count; // shorten the list by count elements
+
+    // number of bytes to be copied
+    size_t num_bytes = (list->current_size - index) * list->element_size;
+
+    // shift the trailing elements forward
+    memmove(dst, src, num_bytes);
+}
+
+void expand(array_list_t *list, size_t index, size_t count)
+{
+    void *dst = slot_at(list, index + count); // first element after the gap
+    void *src = slot_at(list, index);         // current element
+
+    // number of bytes to be copied
+    size_t num_bytes = (list->current_size - index) * list->element_size;
+
+    // shift the trailing elements backward
+    memmove(dst, src, num_bytes);
+}
+
+exit_code_t check_range_data(array_list_t *list, const void *data, size_t count)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if ((NULL == data) && (0 != count))
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    if (count > (SIZE_MAX / list->element_size) - list->current_size)
+    {
+        exit_code = E_OUT_OF_BOUNDS;
+        goto END;
+    }
+
+    // Pointer lists reject NULL elements, as array_list_insert does
+    if (false == list->is_typed)
+    {
+        void *const *items = data;
+        for (size_t idx = 0; idx < count; idx++)
+        {
+            if (NULL == items[idx])
+            {
+                exit_code = E_NULL_POINTER;
+                goto END;
+            }
+        }
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+void release_buffer(array_list_t *list)
+{
+#ifdef ARRAY_LIST_HAS_MMAP
+    if (true == list->is_mapped)
+    {
+        munmap(list->elements, list->mapped_bytes);
+        list->is_mapped = false;
+        list->mapped_bytes = 0;
+    }
+    else
+#endif
+    if (false == list->is_inline)
+    {
+        free(list->elements);
+    }
+
+    list->is_inline = false;
+    list->elements = NULL;
+    list->total_capacity = 0;
+}
+
+exit_code_t prepare_write(array_list_t *list)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+    array_list_snapshot_t *snapshot = list->snapshot;
+
+    if (NULL == snapshot)
+    {
+        exit_code = E_SUCCESS;
+        goto END;
+    }
+
+    // Every reader has let go, and none can come back without the list, so take the buffer back as it is
+    if ((false == snapshot->is_read_only) &&
+        (1 == atomic_load_explicit(&snapshot->references, memory_order_acquire)))
+    {
+        free(snapshot);
+        list->snapshot = NULL;
+        exit_code = E_SUCCESS;
+        goto END;
+    }
+
+    // Readers still hold the buffer, or it is a read-only file; allocate a fresh one and copy into it
+    void **elements = list->elements;
+    bool is_mapped = list->is_mapped;
+    size_t mapped_bytes = list->mapped_bytes;
+    size_t capacity = list->total_capacity;
+    list->elements = NULL;
+    list->is_mapped = false;
+    list->mapped_bytes = 0;
+    list->total_capacity = 0;
+
+    exit_code = resize_buffer(list, capacity);
+    if (E_SUCCESS != exit_code)
+    {
+        list->elements = elements;
+        list->is_mapped = is_mapped;
+        list->mapped_bytes = mapped_bytes;
+        list->total_capacity = capacity;
+        goto END;
+    }
+
+    memcpy(list->elements, snapshot->elements, list->current_size * list->element_size);
+
+    list->snapshot = NULL;
+    drop_reference(snapshot);
+
+END:
+    return exit_code;
+}
+
+void drop_reference(array_list_snapshot_t *snapshot)
+{
+    // The last holder frees the buffer, after every other holder's reads
+    if (1 != atomic_fetch_sub_explicit(&snapshot->references, 1, memory_order_acq_rel))
+    {
+        goto END;
+    }
+
+#ifdef ARRAY_LIST_HAS_MMAP
+    if (true == snapshot->is_mapped)
+    {
+        munmap((unsigned char *)snapshot->elements - snapshot->payload_offset, snapshot->mapped_bytes);
+    }
+    else
+#endif
+    {
+        free(snapshot->elements);
+    }
+
+    free(snapshot);
+
+END:
+    return;
+}
+
+uint64_t checksum_bytes(const void *data, size_t num_bytes)
+{
+    const unsigned char *bytes = data;
+
+    // 64-bit FNV-1a
+    uint64_t hash = UINT64_C(0xcbf29ce484222325);
+    for (size_t idx = 0; idx < num_bytes; idx++)
+    {
+        hash ^= bytes[idx];
+        hash *= UINT64_C(0x100000001b3);
+    }
+
+    return hash;
+}
+
+size_t get_page_size(void)
+{
+    size_t page_size = DEFAULT_PAGE_SIZE;
+
+#ifdef ARRAY_LIST_HAS_MMAP
+    long queried = sysconf(_SC_PAGESIZE);
+    if (queried > 0)
+    {
+        page_size = (size_t)queried;
+    }
+#endif
+
+    return page_size;
+}
+
+#ifdef ARRAY_LIST_HAS_MMAP
+void *map_file(const char *path, file_header_t *header, size_t *file_bytes)
+{
+    void *mapping = NULL;
+    struct stat info = {0};
+    int fd = -1;
+
+    if (NULL == path)
+    {
+        goto END;
+    }
+
+    fd = open(path, O_RDONLY);
+    if ((-1 == fd) || (0 != fstat(fd, &info)) || ((size_t)info.st_size < sizeof(file_header_t)))
+    {
+        goto END;
+    }
+
+    if ((ssize_t)sizeof(file_header_t) != pread(fd, header, sizeof(file_header_t), 0))
+    {
+        goto END;
+    }
+
+    // Reject anything whose header does not describe exactly this file, with the elements page-aligned after it
+    size_t size = (size_t)info.st_size;
+    if ((0 != memcmp(header->magic, FILE_MAGIC, FILE_MAGIC_SIZE)) || (0 == header->element_size) ||
+        (header->payload_offset < sizeof(file_header_t)) || (0 != header->payload_offset % get_page_size()) ||
+        (header->payload_offset > size) ||
+        (header->count > (size - header->payload_offset) / header->element_size) ||
+        (header->payload_offset + header->count * header->element_size != size))
+    {
+        goto END;
+    }
+
+    mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (MAP_FAILED == mapping)
+    {
+        mapping = NULL;
+        goto END;
+    }
+
+    *file_bytes = size;
+
+END:
+    if (-1 != fd)
+    {
+        close(fd);
+    }
+    return mapping;
+}
+#endif
+
+void *slot_at(array_list_t *list, size_t index)
+{
+    return (unsigned char *)list->elements + (index * list->element_size);
+}
+
+void *element_at(array_list_t *list, size_t index)
+{
+    // Typed lists hand out the address of the slot, pointer lists the stored pointer
+    return list->is_typed ? slot_at(list, index) : list->elements[index];
+}
+
+void store_element(array_list_t *list, size_t index, void *data)
+{
+    if (list->is_typed)
+    {
+        memcpy(slot_at(list, index), data, list->element_size);
+    }
+    else
+    {
+        list->elements[index] = data;
+    }
+}
+
+void destroy_element(array_list_t *list, size_t index)
+{
+    const destroy_ctx *destroy = list->destroy;
+
+    if (NULL == destroy)
+    {
+        goto END;
+    }
+
+    if (NULL != destroy->destroy)
+    {
+        destroy->destroy(element_at(list, index), destroy->context);
+    }
+    else if (NULL != destroy->destroy_many)
+    {
+        // A batch of one; typed lists hand over the slot address like destroy_range does
+        void *item = element_at(list, index);
+        destroy->destroy_many(&item, 1, destroy->context);
+    }
+
+END:
+    return;
+}
+
+void destroy_range(array_list_t *list, size_t index, size_t count)
+{
+    destroy_task_t tasks[ARRAY_LIST_MAX_DESTROY_THREADS] = {0};
+    pthread_t threads[ARRAY_LIST_MAX_DESTROY_THREADS];
+    bool started[ARRAY_LIST_MAX_DESTROY_THREADS] = {0};
+
+    if ((NULL == list->destroy) || ((NULL == list->destroy->destroy) && (NULL == list->destroy->destroy_many)))
+    {
+        goto END;
+    }
+
+    size_t num_threads = list->destroy_threads;
+    if (num_threads > ARRAY_LIST_MAX_DESTROY_THREADS)
+    {
+        num_threads = ARRAY_LIST_MAX_DESTROY_THREADS;
+    }
+
+    if ((num_threads < 2) || (count < PARALLEL_DESTROY_THRESHOLD))
+    {
+        destroy_range_serial(list, index, count);
+        goto END;
+    }
+
+    // Split the range into one shard per thread; the calling thread takes the first
+    for (size_t shard = 0; shard < num_threads; shard++)
+    {
+        size_t first = index + (count / num_threads) * shard + (count % num_threads) * shard / num_threads;
+        size_t next = index + (count / num_threads) * (shard + 1) + (count % num_threads) * (shard + 1) / num_threads;
+
+        tasks[shard] = (destroy_task_t){list, first, next - first};
+    }
+
+    for (size_t shard = 1; shard < num_threads; shard++)
+    {
+        started[shard] = (0 == pthread_create(&threads[shard], NULL, destroy_shard, &tasks[shard]));
+    }
+
+    destroy_shard(&tasks[0]);
+
+    for (size_t shard = 1; shard < num_threads; shard++)
+    {
+        if (true == started[shard])
+        {
+            pthread_join(threads[shard], NULL);
+        }
+        else
+        {
+            destroy_shard(&tasks[shard]);
+        }
+    }
+
+END:
+    return;
+}
+
+void destroy_range_serial(array_list_t *list, size_t index, size_t count)
+{
+    const destroy_ctx *destroy = list->destroy;
+
+    if (NULL == destroy->destroy_many)
+    {
+        for (size_t idx = index; idx < index + count; idx++)
+        {
+            destroy->destroy(element_at(list, idx), destroy->context);
+        }
+    }
+    else if (false == list->is_typed)
+    {
+        // The slots already are the array of items
+        destroy->destroy_many(list->elements + index, count, destroy->context);
+    }
+    else
+    {
+        void *items[DESTROY_BATCH];
+
+        for (size_t first = index; first < index + count; first += DESTROY_BATCH)
+        {
+            size_t batch = (index + count - first < DESTROY_BATCH) ? index + count - first : DESTROY_BATCH;
+            for (size_t idx = 0; idx < batch; idx++)
+            {
+                items[idx] = slot_at(list, first + idx);
+            }
+            destroy->destroy_many(items, batch, destroy->context);
+        }
+    }
+}
+
+void *destroy_shard(void *task)
+{
+    destroy_task_t *shard = task;
+
+    destroy_range_serial(shard->list, shard->index, shard->count);
+
+    return NULL;
+}
+
+void *destroy_in_background(void *list)
+{
+    array_list_t *detached = list;
+
+    clear_list(&detached);
+    free(detached);
+
+    pthread_mutex_lock(&background_lock);
+    background_destroys--;
+    pthread_cond_broadcast(&background_done);
+    pthread_mutex_unlock(&background_lock);
+
+    return NULL;
+}
+
+exit_code_t index_reserve(array_list_t *list, size_t additional)
+{
+    exit_code_t exit_code = E_SUCCESS;
+
+    if (NULL == list->hash)
+    {
+        goto END;
+    }
+
+    if (additional > (SIZE_MAX / 2) - list->index_count)
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
+
+    // Keep the table at most half full so probe sequences stay short
+    size_t required = (list->index_count + additional) * 2;
+    if (required <= list->index_capacity)
+    {
+        goto END;
+    }
+
+    size_t new_capacity = (0 != list->index_capacity) ? list->index_capacity : INDEX_MIN_CAPACITY;
+    while (new_capacity < required)
+    {
+        new_capacity *= 2;
+    }
+
+    exit_code = index_resize(list, new_capacity);
+
+END:
+    return exit_code;
+}
+
+exit_code_t index_resize(array_list_t *list, size_t new_capacity)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if (new_capacity > SIZE_MAX / sizeof(index_entry_t))
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
+
+    index_entry_t *old_index = list->index;
+    size_t old_capacity = list->index_capacity;
+
+    list->index = malloc(new_capacity * sizeof(index_entry_t));
+    if (NULL == list->index)
+    {
+        list->index = old_index;
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
+
+    for (size_t slot = 0; slot < new_capacity; slot++)
+    {
+        list->index[slot].position = INDEX_EMPTY;
+    }
+
+    list->index_capacity = new_capacity;
+    list->index_count = 0;
+
+    // Move the old entries across using their stored hashes
+    for (size_t slot = 0; slot < old_capacity; slot++)
+    {
+        if (INDEX_EMPTY != old_index[slot].position)
+        {
+            index_place(list, old_index[slot].hash, old_index[slot].position);
+        }
+    }
+
+    free(old_index);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+void index_place(array_list_t *list, size_t hash, size_t position)
+{
+    size_t mask = list->index_capacity - 1;
+    size_t slot = hash & mask;
+
+    while (INDEX_EMPTY != list->index[slot].position)
+    {
+        slot = (slot + 1) & mask;
+    }
+
+    list->index[slot].hash = hash;
+    list->index[slot].position = position;
+    list->index_count++;
+}
+
+void index_add(array_list_t *list, size_t position)
+{
+    if (NULL == list->hash)
+    {
+        goto END;
+    }
+
+    // index_reserve has already made room
+    index_place(list, list->hash->hash(element_at(list, position), list->hash->ctx), position);
+
+END:
+    return;
+}
+
+void index_delete(array_list_t *list, size_t position)
+{
+    if ((NULL == list->hash) || (0 == list->index_count))
+    {
+        goto END;
+    }
+
+    size_t mask = list->index_capacity - 1;
+    size_t slot = list->hash->hash(element_at(list, position), list->hash->ctx) & mask;
+
+    while (position != list->index[slot].position)
+    {
+        if (INDEX_EMPTY == list->index[slot].position)
+        {
+            goto END;
+        }
+
+        slot = (slot + 1) & mask;
+    }
+
+    // Backward-shift deletion: pull later entries of the probe run into the hole
+    size_t hole = slot;
+    size_t next = slot;
+    while (true)
+    {
+        next = (next + 1) & mask;
+        if (INDEX_EMPTY == list->index[next].position)
+        {
+            break;
+        }
+
+        // Entries whose home lies cyclically in (hole, next] are already reachable and stay put
+        size_t home = list->index[next].hash & mask;
+        bool reachable = (hole <= next) ? ((hole < home) && (home <= next)) : ((hole < home) || (home <= next));
+        if (reachable)
+        {
+            continue;
+        }
+
+        list->index[hole] = list->index[next];
+        hole = next;
+    }
+
+    list->index[hole].position = INDEX_EMPTY;
+    list->index_count--;
+
+END:
+    return;
+}
+
+void index_shift(array_list_t *list, size_t from, size_t count, bool up)
+{
+    if ((NULL == list->hash) || (0 == list->index_count))
+    {
+        goto END;
+    }
+
+    // Elements behind an insert or remove moved, so their stored positions move with them
+    for (size_t slot = 0; slot < list->index_capacity; slot++)
+    {
+        size_t position = list->index[slot].position;
+        if ((INDEX_EMPTY != position) && (position >= from))
+        {
+            list->index[slot].position = up ? position + count : position - count;
+        }
+    }
+
+END:
+    return;
+}
+
+bool index_lookup(array_list_t *list, void *data, size_t *position)
+{
+    bool found = false;
+
+    if (0 == list->index_count)
+    {
+        goto END;
+    }
+
+    size_t hash = list->hash->hash(data, list->hash->ctx);
+    size_t mask = list->index_capacity - 1;
+    size_t slot = hash & mask;
+
+    // Duplicates share a probe run; report the lowest position among them
+    while (INDEX_EMPTY != list->index[slot].position)
+    {
+        index_entry_t *entry = &list->index[slot];
+
+        if ((hash == entry->hash) && ((false == found) || (entry->position < *position)) &&
+            (true == list->equal->equal(element_at(list, entry->position), data, list->equal->ctx)))
+        {
+            *position = entry->position;
+            found = true;
+        }
+
+        slot = (slot + 1) & mask;
+    }
+
+END:
+    return found;
+}
+
+bool linear_lookup(array_list_t *list, void *data, size_t *position)
+{
+    bool found = false;
+    uintptr_t mask = 0;
+
+    if (true == word_search_mask(list, &mask))
+    {
+        size_t idx = word_find((const uintptr_t *) list->elements, list->current_size, (uintptr_t) data, mask);
+        if (idx < list->current_size)
+        {
+            *position = idx;
+            found = true;
+        }
+        goto END;
+    }
+
+    for (size_t idx = 0; idx < list->current_size; idx++)
+    {
+        if (true == list->equal->equal(element_at(list, idx), data, list->equal->ctx))
+        {
+            *position = idx;
+            found = true;
+            break;
+        }
+    }
+
+END:
+    return found;
+}
+
+size_t index_count_matches(array_list_t *list, void *data)
+{
+    size_t matches = 0;
+
+    if (0 == list->index_count)
+    {
+        goto END;
+    }
+
+    size_t hash = list->hash->hash(data, list->hash->ctx);
+    size_t mask = list->index_capacity - 1;
+    size_t slot = hash & mask;
+
+    // Every equal element lives in the probe run that starts at the key's home slot
+    while (INDEX_EMPTY != list->index[slot].position)
+    {
+        index_entry_t *entry = &list->index[slot];
+
+        if ((hash == entry->hash) &&
+            (true == list->equal->equal(element_at(list, entry->position), data, list->equal->ctx)))
+        {
+            matches++;
+        }
+
+        slot = (slot + 1) & mask;
+    }
+
+END:
+    return matches;
+}
+
+size_t linear_count(array_list_t *list, void *data)
+{
+    size_t matches = 0;
+    uintptr_t mask = 0;
+
+    if (true == word_search_mask(list, &mask))
+    {
+        matches = word_count((const uintptr_t *) list->elements, list->current_size, (uintptr_t) data, mask);
+        goto END;
+    }
+
+    for (size_t idx = 0; idx < list->current_size; idx++)
+    {
+        if (true == list->equal->equal(element_at(list, idx), data, list->equal->ctx))
+        {
+            matches++;
+        }
+    }
+
+END:
+    return matches;
+}
+
+bool word_search_mask(array_list_t *list, uintptr_t *mask)
+{
+    bool can_search = false;
+
+    // Only pointer lists compared by the stored word itself can skip the equal callback
+    if ((true == list->is_typed) || (eq_from_comp != list->equal->equal))
+    {
+        goto END;
+    }
+
+    if (&raw_int_comp_ctx == list->equal->ctx)
+    {
+        *mask = (uintptr_t) UINT32_MAX; // raw ints only compare the low 32 bits
+        can_search = (sizeof(int) == sizeof(uint32_t));
+    }
+    else if ((&raw_size_t_comp_ctx == list->equal->ctx) || (&naive_comp_ctx == list->equal->ctx))
+    {
+        *mask = UINTPTR_MAX;
+        can_search = true;
+    }
+
+END:
+    return can_search;
+}
+
+void index_rebuild(array_list_t *list)
+{
+    if (NULL == list->hash)
+    {
+        goto END;
+    }
+
+    // Same number of elements, so the table keeps its capacity
+    for (size_t slot = 0; slot < list->index_capacity; slot++)
+    {
+        list->index[slot].position = INDEX_EMPTY;
+    }
+    list->index_count = 0;
+
+    for (size_t idx = 0; idx < list->current_size; idx++)
+    {
+        index_add(list, idx);
+    }
+
+END:
+    return;
+}
+
+int compare_stored(const void *x, const void *y, const void *ctx)
+{
+    // The sort hands over slot addresses; pointer lists compare what the slots hold
+    const compare_ctx *compare = ctx;
+    return compare->compare(*(void *const *)x, *(void *const *)y, compare->ctx);
+}
+
+exit_code_t sort_list(array_list_t *list, const compare_ctx *compare, bool parallel, size_t threads)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    if ((NULL == compare) || (NULL == compare->compare))
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // Re-sorting a sorted list by anything but its own order would break it
+    if (NULL != list->order)
+    {
+        exit_code = (compare == list->order) ? E_SUCCESS : E_OUT_OF_ORDER;
+        goto END;
+    }
+
+    exit_code = prepare_write(list);
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
+
+    compare_ctx stored = {compare_stored, compare};
+    const compare_ctx *element_compare = list->is_typed ? compare : &stored;
+
+    if (true == parallel)
+    {
+        exit_code = parallel_merge_sort(list->elements, list->current_size, list->element_size, element_compare,
+                                        threads);
+    }
+    else
+    {
+        introsort(list->elements, list->current_size, list->element_size, element_compare);
+        exit_code = E_SUCCESS;
+    }
+
+    if (E_SUCCESS == exit_code)
+    {
+        index_rebuild(list);
+    }
+
+END:
+    return exit_code;
+}
+
+int compare_to(array_list_t *list, size_t index, const void *data)
+{
+    return list->order->compare(element_at(list, index), data, list->order->ctx);
+}
+
+size_t search_bound(array_list_t *list, const void *data, bool upper)
+{
+    size_t base = 0;
+    size_t length = list->current_size;
+
+    // The answer lies in [base, base + length]. Halving with a select instead of an if/else keeps
+    // the loop free of unpredictable branches; the compiler turns it into a conditional move.
+    while (length > 1)
+    {
+        size_t half = length / 2;
+        int result = compare_to(list, base + half, data);
+        base = (upper ? (result <= 0) : (result < 0)) ? base + half : base;
+        length -= half;
+    }
+
+    if (1 == length)
+    {
+        int result = compare_to(list, base, data);
+        base += upper ? (result <= 0) : (result < 0);
+    }
+
+    return base;
+}
+
+exit_code_t check_order(array_list_t *list, size_t index, const void *data, bool replacing)
+{
+    exit_code_t exit_code = E_SUCCESS;
+    size_t next = replacing ? index + 1 : index;
+
+    if (NULL == list->order)
+    {
+        goto END;
+    }
+
+    // Unique lists treat a tie with a neighbour as a duplicate, the others just need the order kept
+    if (index > 0)
+    {
+        int result = compare_to(list, index - 1, data);
+        if ((result > 0) || ((0 == result) && (true == list->is_unique)))
+        {
+            exit_code = (result > 0) ? E_OUT_OF_ORDER : E_KEY_ALREADY_EXISTS;
+            goto END;
+        }
+    }
+
+    if (next < list->current_size)
+    {
+        int result = compare_to(list, next, data);
+        if ((result < 0) || ((0 == result) && (true == list->is_unique)))
+        {
+            exit_code = (result < 0) ? E_OUT_OF_ORDER : E_KEY_ALREADY_EXISTS;
+            goto END;
+        }
+    }
+
+END:
+    return exit_code;
+}
+
+exit_code_t check_range_order(array_list_t *list, size_t index, const void *data, size_t count)
+{
+    exit_code_t exit_code = E_SUCCESS;
+
+    if (NULL == list->order)
+    {
+        goto END;
+    }
+
+    // The batch must be in order itself and fit between its neighbours at either end
+    for (size_t idx = 1; idx < count; idx++)
+    {
+        int result = list->order->compare(range_element(list, data, idx - 1), range_element(list, data, idx),
+                                          list->order->ctx);
+        if ((result > 0) || ((0 == result) && (true == list->is_unique)))
+        {
+            exit_code = (result > 0) ? E_OUT_OF_ORDER : E_KEY_ALREADY_EXISTS;
+            goto END;
+        }
+    }
+
+    exit_code = check_order(list, index, range_element(list, data, 0), false);
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
+
+    exit_code = check_order(list, index, range_element(list, data, count - 1), false);
+
+END:
+    return exit_code;
+}
+
+const void *range_element(array_list_t *list, const void *data, size_t index)
+{
+    // Matches element_at: the item's address for typed lists, the pointer it holds otherwise
+    const char *item = (const char *)data + (index * list->element_size);
+    return list->is_typed ? (const void *)item : *(void *const *)item;
+}
+
+exit_code_t merge_batch(array_list_t *list, const void *data, size_t count)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+    exit_code_t result = E_SUCCESS; // what the batch reports once the accepted elements are in
+
+    // 1. Order the batch by position, ties kept in the caller's order, so it merges stably
+    size_t *order = malloc(count * sizeof(size_t));
+    if (NULL == order)
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        order[idx] = idx;
+    }
+
+    batch_t batch = {list, data};
+    compare_ctx batch_compare = {compare_batch, &batch};
+    introsort(order, count, sizeof(size_t), &batch_compare);
+
+    // 2. Unique lists stop at the first element, in the caller's order, that is already stored or
+    //    repeats an earlier one; everything before it still goes in
+    size_t accepted = count;
+    if (true == list->is_unique)
+    {
+        for (size_t idx = 0; idx < count; idx++)
+        {
+            const void *item = range_element(list, data, order[idx]);
+            size_t position = search_bound(list, item, false);
+            bool stored = (position < list->current_size) && (0 == compare_to(list, position, item));
+            bool repeated = (idx > 0) &&
+                            (0 == list->order->compare(range_element(list, data, order[idx - 1]), item,
+                                                       list->order->ctx));
+
+            if (((true == stored) || (true == repeated)) && (order[idx] < accepted))
+            {
+                accepted = order[idx];
+                result = E_KEY_ALREADY_EXISTS;
+            }
+        }
+    }
+
+    size_t kept = 0;
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        if (order[idx] < accepted)
+        {
+            order[kept++] = order[idx];
+        }
+    }
+
+    if (0 == kept)
+    {
+        exit_code = result;
+        goto END;
+    }
+
+    // 3. Make room for every accepted element at once
+    exit_code = prepare_write(list);
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
+
+    if (list->total_capacity - list->current_size < kept)
+    {
+        exit_code = array_list_reallocate(list, list->current_size + kept);
+        if (E_SUCCESS != exit_code)
+        {
+            goto END;
+        }
+    }
+
+    exit_code = index_reserve(list, kept);
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
+
+    // 4. Merge from the back, so each stored element moves once; ties go after the stored ones, as push does
+    size_t read = list->current_size;
+    size_t write = list->current_size + kept;
+    size_t remaining = kept;
+    while (remaining > 0)
+    {
+        const void *item = range_element(list, data, order[remaining - 1]);
+        write--;
+
+        if ((read > 0) && (compare_to(list, read - 1, item) > 0))
+        {
+            read--;
+            memcpy(slot_at(list, write), slot_at(list, read), list->element_size);
+        }
+        else
+        {
+            store_element(list, write, (void *)item);
+            remaining--;
+        }
+    }
+
+    list->current_size += kept;
+    index_rebuild(list);
+
+    exit_code = result;
+END:
+    free(order);
+    return exit_code;
+}
+
+int compare_batch(const void *x, const void *y, const void *ctx)
+{
+    const batch_t *batch = ctx;
+    size_t first = *(const size_t *)x;
+    size_t second = *(const size_t *)y;
+
+    int result = batch->list->order->compare(range_element(batch->list, batch->data, first),
+                                             range_element(batch->list, batch->data, second),
+                                             batch->list->order->ctx);
+    if (0 == result)
+    {
+        result = (first > second) - (first < second);
+    }
+
+    return result;
+}
+
+exit_code_t bound_query(array_list_t *list, void *data, size_t *first, size_t *last)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    if ((NULL == data) || ((NULL == first) && (NULL == last)))
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    if (NULL == list->order)
+    {
+        exit_code = E_INVALID_INPUT;
+        goto END;
+    }
+
+    if (NULL != first)
+    {
+        *first = search_bound(list, data, false);
+    }
+
+    if (NULL != last)
+    {
+        *last = search_bound(list, data, true);
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+bool keep_unmatched(array_list_t *list, size_t read, size_t write, const void *ctx)
+{
+    const predicate_ctx *predicate = ctx;
+    (void) write;
+
+    return false == predicate->predicate(element_at(list, read), predicate->ctx);
+}
+
+bool keep_distinct(array_list_t *list, size_t read, size_t write, const void *ctx)
+{
+    bool keep = true;
+    (void) ctx;
+
+    // write - 1 is the last element kept so far
+    if (0 == write)
+    {
+        goto END;
+    }
+
+    if (NULL != list->order)
+    {
+        keep = (0 != list->order->compare(element_at(list, write - 1), element_at(list, read), list->order->ctx));
+    }
+    else
+    {
+        keep = (false == list->equal->equal(element_at(list, write - 1), element_at(list, read), list->equal->ctx));
+    }
+
+END:
+    return keep;
+}
+
+size_t compact(array_list_t *list, bool (*keep)(array_list_t *, size_t, size_t, const void *), const void *ctx)
+{
+    size_t write = 0;
+    size_t run_start = 0;
+    bool in_run = false;
+
+    for (size_t read = 0; read < list->current_size; read++)
+    {
+        if (true == keep(list, read, write, ctx))
+        {
+            // A run of dropped elements ends here; destroy it before any of its slots are overwritten
+            if (true == in_run)
+            {
+                destroy_range(list, run_start, read - run_start);
+                in_run = false;
+            }
+
+            if (write != read)
+            {
+                memcpy(slot_at(list, write), slot_at(list, read), list->element_size);
+            }
+            write++;
+        }
+        else if (false == in_run)
+        {
+            run_start = read;
+            in_run = true;
+        }
+    }
+
+    if (true == in_run)
+    {
+        destroy_range(list, run_start, list->current_size - run_start);
+    }
+
+    size_t removed = list->current_size - write;
+    list->current_size = write;
+
+    // Positions moved, so the hash index is rebuilt rather than patched
+    if (0 != removed)
+    {
+        index_rebuild(list);
+    }
+
+    return removed;
+}
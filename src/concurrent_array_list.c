@@ -0,0 +1,235 @@
+#include <stdatomic.h>
+
+#include "concurrent_array_list.h"
+#include "utilities/segment_index.h"
+
+// A NULL slot has been reserved but not written yet, which is why NULL data is rejected
+typedef _Atomic(void *) slot_t;
+
+struct concurrent_array_list
+{
+    _Atomic(slot_t *) segments[SEGMENT_COUNT]; // segment k holds segment_length(k) slots
+    atomic_size_t reserved;                    // slots handed out to pushers
+    atomic_size_t published;                   // every slot below this index has been written
+    const destroy_ctx *destroy;
+    const equal_ctx *equal;
+};
+
+static slot_t *get_segment(concurrent_array_list_t *list, size_t segment);
+static slot_t *find_slot(concurrent_array_list_t *list, size_t index);
+static void advance_published(concurrent_array_list_t *list);
+
+concurrent_array_list_t *concurrent_list_create(const destroy_ctx *destroy, const equal_ctx *equal)
+{
+    concurrent_array_list_t *list = calloc(1, sizeof(concurrent_array_list_t));
+    if (NULL == list)
+    {
+        goto END;
+    }
+
+    for (size_t segment = 0; segment < SEGMENT_COUNT; segment++)
+    {
+        atomic_init(&list->segments[segment], NULL);
+    }
+
+    atomic_init(&list->reserved, 0);
+    atomic_init(&list->published, 0);
+    list->destroy = destroy;
+    list->equal = equal;
+
+END:
+    return list;
+}
+
+exit_code_t concurrent_list_push(concurrent_array_list_t *list, void *data)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    if (NULL == data)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // 1. Reserve a slot; this is the only point where pushers contend
+    size_t index = atomic_fetch_add_explicit(&list->reserved, 1, memory_order_relaxed);
+
+    size_t segment = 0;
+    size_t offset = 0;
+    segment_locate(index, &segment, &offset);
+
+    // 2. Find or install the segment holding the slot
+    slot_t *slots = get_segment(list, segment);
+    if (NULL == slots)
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
+
+    // 3. Write the element, then help move the published prefix past every written slot
+    atomic_store(&slots[offset], data);
+    advance_published(list);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+void *concurrent_list_get(concurrent_array_list_t *list, size_t index)
+{
+    void *element = NULL;
+
+    if ((NULL == list) || (index >= atomic_load(&list->published)))
+    {
+        goto END;
+    }
+
+    element = atomic_load_explicit(find_slot(list, index), memory_order_acquire);
+
+END:
+    return element;
+}
+
+size_t concurrent_list_size(concurrent_array_list_t *list)
+{
+    size_t size = 0;
+
+    if (NULL == list)
+    {
+        goto END;
+    }
+
+    size = atomic_load(&list->published);
+
+END:
+    return size;
+}
+
+bool concurrent_list_contains(concurrent_array_list_t *list, void *data)
+{
+    bool contains_data = false;
+
+    if ((NULL == list) || (NULL == data) || (NULL == list->equal))
+    {
+        goto END;
+    }
+
+    size_t size = atomic_load(&list->published);
+
+    for (size_t index = 0; index < size; index++)
+    {
+        void *element = atomic_load_explicit(find_slot(list, index), memory_order_acquire);
+
+        if (true == list->equal->equal(element, data, list->equal->ctx))
+        {
+            contains_data = true;
+            break;
+        }
+    }
+
+END:
+    return contains_data;
+}
+
+void concurrent_list_destroy(concurrent_array_list_t **list)
+{
+    if ((NULL == list) || (NULL == *list))
+    {
+        goto END;
+    }
+
+    size_t size = atomic_load(&(*list)->published);
+
+    // destroy the data if necessary
+    if ((NULL != (*list)->destroy) && (NULL != (*list)->destroy->destroy))
+    {
+        for (size_t index = 0; index < size; index++)
+        {
+            void *element = atomic_load(find_slot(*list, index));
+            (*list)->destroy->destroy(element, (*list)->destroy->context);
+        }
+    }
+
+    for (size_t segment = 0; segment < SEGMENT_COUNT; segment++)
+    {
+        free(atomic_load(&(*list)->segments[segment]));
+    }
+
+    free(*list);
+    *list = NULL;
+
+END:
+    return;
+}
+
+slot_t *get_segment(concurrent_array_list_t *list, size_t segment)
+{
+    slot_t *slots = atomic_load_explicit(&list->segments[segment], memory_order_acquire);
+    if (NULL != slots)
+    {
+        goto END;
+    }
+
+    // calloc leaves every slot NULL, which marks it as not yet written
+    slot_t *new_slots = calloc(segment_length(segment), sizeof(slot_t));
+    if (NULL == new_slots)
+    {
+        goto END;
+    }
+
+    // Several pushers may race to install the same segment; the losers free their copy
+    slot_t *expected = NULL;
+    if (atomic_compare_exchange_strong_explicit(&list->segments[segment], &expected, new_slots,
+                                                memory_order_acq_rel, memory_order_acquire))
+    {
+        slots = new_slots;
+    }
+    else
+    {
+        free(new_slots);
+        slots = expected;
+    }
+
+END:
+    return slots;
+}
+
+slot_t *find_slot(concurrent_array_list_t *list, size_t index)
+{
+    size_t segment = 0;
+    size_t offset = 0;
+    segment_locate(index, &segment, &offset);
+
+    slot_t *slots = atomic_load_explicit(&list->segments[segment], memory_order_acquire);
+
+    return (NULL == slots) ? NULL : &slots[offset];
+}
+
+void advance_published(concurrent_array_list_t *list)
+{
+    // Every pusher runs this after writing its slot. The sequentially consistent store above and
+    // the loads here guarantee that whichever of two racing pushers looks last sees both slots,
+    // so the prefix never stalls behind a slot that has been written.
+    size_t published = atomic_load(&list->published);
+
+    while (published < atomic_load(&list->reserved))
+    {
+        slot_t *slot = find_slot(list, published);
+        if ((NULL == slot) || (NULL == atomic_load(slot)))
+        {
+            break;
+        }
+
+        // On failure published is reloaded and the walk continues from wherever another thread got to
+        if (atomic_compare_exchange_weak(&list->published, &published, published + 1))
+        {
+            published++;
+        }
+    }
+}
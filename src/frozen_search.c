@@ -0,0 +1,238 @@
+#include <stdint.h>
+
+#include "frozen_search.h"
+
+#define CACHE_LINE_SIZE 64
+#define PREFETCH_LEVELS 4 // the 2^4 descendants four levels down sit side by side
+
+struct frozen_search
+{
+    unsigned char *slots;  // slot k (1-based) holds node k; node k's children are 2k and 2k+1
+    size_t *ranks;         // ranks[k] is node k's position in sorted order
+    size_t count;
+    size_t element_size;   // bytes per slot (sizeof(void *) for pointer elements)
+    bool is_typed;         // true if elements are stored by value
+    compare_ctx compare;
+};
+
+static size_t fill(frozen_search_t *search, const unsigned char *sorted, size_t next, size_t node);
+static const void *element_at(frozen_search_t *search, size_t node);
+static void prefetch_descendants(frozen_search_t *search, size_t node);
+static size_t descend(frozen_search_t *search, const void *key);
+static size_t strip_right_turns(size_t node);
+
+frozen_search_t *frozen_search_create(const void *sorted, size_t count, size_t element_size, const compare_ctx *compare)
+{
+    frozen_search_t *search = NULL;
+
+    if (((NULL == sorted) && (0 != count)) || (NULL == compare) || (NULL == compare->compare))
+    {
+        goto END;
+    }
+
+    search = calloc(1, sizeof(frozen_search_t));
+    if (NULL == search)
+    {
+        goto END;
+    }
+
+    search->is_typed = (0 != element_size);
+    search->element_size = search->is_typed ? element_size : sizeof(void *);
+    search->count = count;
+    search->compare = *compare;
+
+    if ((count >= SIZE_MAX / search->element_size) || (count >= SIZE_MAX / sizeof(size_t)))
+    {
+        goto FAIL;
+    }
+
+    // Slot 0 is unused, so every node index maps straight onto its slot
+    size_t num_bytes = (count + 1) * search->element_size;
+    num_bytes = (num_bytes + CACHE_LINE_SIZE - 1) & ~((size_t)CACHE_LINE_SIZE - 1);
+
+    search->slots = aligned_alloc(CACHE_LINE_SIZE, num_bytes);
+    search->ranks = malloc((count + 1) * sizeof(size_t));
+    if ((NULL == search->slots) || (NULL == search->ranks))
+    {
+        goto FAIL;
+    }
+
+    fill(search, sorted, 0, 1);
+    goto END;
+
+FAIL:
+    frozen_search_destroy(&search);
+END:
+    return search;
+}
+
+exit_code_t frozen_search_lower_bound(frozen_search_t *search, const void *key, size_t *rank)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if ((NULL == search) || (NULL == key) || (NULL == rank))
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    size_t node = descend(search, key);
+    *rank = (0 == node) ? search->count : search->ranks[node];
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t frozen_search_lower_bound_batch(frozen_search_t *search, const void *const *keys, size_t num_keys,
+                                            size_t *ranks)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if ((NULL == search) || (NULL == keys) || (NULL == ranks))
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    for (size_t start = 0; start < num_keys; start += FROZEN_SEARCH_BATCH)
+    {
+        size_t nodes[FROZEN_SEARCH_BATCH] = {0};
+        size_t batch = (num_keys - start < FROZEN_SEARCH_BATCH) ? num_keys - start : FROZEN_SEARCH_BATCH;
+
+        for (size_t idx = 0; idx < batch; idx++)
+        {
+            if (NULL == keys[start + idx])
+            {
+                exit_code = E_NULL_POINTER;
+                goto END;
+            }
+            nodes[idx] = 1;
+        }
+
+        // Step every search in the batch one level at a time so their misses are outstanding together
+        bool active = true;
+        while (true == active)
+        {
+            active = false;
+            for (size_t idx = 0; idx < batch; idx++)
+            {
+                size_t node = nodes[idx];
+                if (node <= search->count)
+                {
+                    prefetch_descendants(search, node);
+                    int result = search->compare.compare(element_at(search, node), keys[start + idx],
+                                                         search->compare.ctx);
+                    nodes[idx] = (2 * node) + (result < 0);
+                    active = true;
+                }
+            }
+        }
+
+        for (size_t idx = 0; idx < batch; idx++)
+        {
+            size_t node = strip_right_turns(nodes[idx]);
+            ranks[start + idx] = (0 == node) ? search->count : search->ranks[node];
+        }
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+bool frozen_search_contains(frozen_search_t *search, const void *key)
+{
+    bool contains_key = false;
+
+    if ((NULL == search) || (NULL == key))
+    {
+        goto END;
+    }
+
+    size_t node = descend(search, key);
+    contains_key = (0 != node) && (0 == search->compare.compare(element_at(search, node), key, search->compare.ctx));
+
+END:
+    return contains_key;
+}
+
+size_t frozen_search_size(frozen_search_t *search)
+{
+    return (NULL == search) ? 0 : search->count;
+}
+
+void frozen_search_destroy(frozen_search_t **search)
+{
+    if ((NULL == search) || (NULL == *search))
+    {
+        goto END;
+    }
+
+    free((*search)->slots);
+    free((*search)->ranks);
+    free(*search);
+    *search = NULL;
+
+END:
+    return;
+}
+
+// HELPER FUNCTIONS
+
+size_t fill(frozen_search_t *search, const unsigned char *sorted, size_t next, size_t node)
+{
+    // An in-order walk of the implicit tree visits the nodes in sorted order
+    if (node <= search->count)
+    {
+        next = fill(search, sorted, next, 2 * node);
+
+        memcpy(search->slots + (node * search->element_size), sorted + (next * search->element_size),
+               search->element_size);
+        search->ranks[node] = next;
+        next++;
+
+        next = fill(search, sorted, next, (2 * node) + 1);
+    }
+
+    return next;
+}
+
+const void *element_at(frozen_search_t *search, size_t node)
+{
+    const unsigned char *slot = search->slots + (node * search->element_size);
+    return search->is_typed ? (const void *)slot : *(void *const *)slot;
+}
+
+void prefetch_descendants(frozen_search_t *search, size_t node)
+{
+    // Addresses are formed as integers since the block may lie past the end of the tree
+    uintptr_t block = (uintptr_t)search->slots + ((node << PREFETCH_LEVELS) * search->element_size);
+    size_t block_bytes = ((size_t)1 << PREFETCH_LEVELS) * search->element_size;
+
+    for (size_t offset = 0; (offset < block_bytes) && (offset < 4 * CACHE_LINE_SIZE); offset += CACHE_LINE_SIZE)
+    {
+        __builtin_prefetch((const void *)(block + offset));
+    }
+}
+
+size_t descend(frozen_search_t *search, const void *key)
+{
+    size_t node = 1;
+
+    // Walk down without branching on the result: left child, plus one when the node orders before key
+    while (node <= search->count)
+    {
+        prefetch_descendants(search, node);
+        node = (2 * node) + (search->compare.compare(element_at(search, node), key, search->compare.ctx) < 0);
+    }
+
+    return strip_right_turns(node);
+}
+
+size_t strip_right_turns(size_t node)
+{
+    // The walk ended below the tree; dropping the trailing right turns (1 bits) and the last left turn
+    // gives the lower bound's node, or 0 if every element orders before the key
+    return node >> (__builtin_ctzll(~(unsigned long long)node) + 1);
+}
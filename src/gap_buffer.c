@@ -0,0 +1,406 @@
+#include <stdint.h>
+
+#include "gap_buffer.h"
+
+struct gap_buffer
+{
+    unsigned char *slots;
+    size_t total_capacity;
+    size_t gap_start;      // the cursor: elements [0, gap_start) sit before the gap
+    size_t gap_end;        // elements after the cursor start here and run to total_capacity
+    const destroy_ctx *destroy;
+    const equal_ctx *equal;
+    size_t element_size;   // bytes per slot (sizeof(void *) for pointer buffers)
+    bool is_typed;         // true if elements are stored by value
+};
+
+static gap_buffer_t *create_buffer(size_t element_size, bool is_typed, const destroy_ctx *destroy, const equal_ctx *equal);
+static exit_code_t grow(gap_buffer_t *buffer);
+static size_t physical_index(gap_buffer_t *buffer, size_t index);
+static void *slot_at(gap_buffer_t *buffer, size_t physical);
+static void *element_at(gap_buffer_t *buffer, size_t physical);
+static void store_element(gap_buffer_t *buffer, size_t physical, void *data);
+static void destroy_element(gap_buffer_t *buffer, size_t physical);
+
+gap_buffer_t *gap_buffer_create(const destroy_ctx *destroy, const equal_ctx *equal)
+{
+    return create_buffer(sizeof(void *), false, destroy, equal);
+}
+
+gap_buffer_t *gap_buffer_create_typed(size_t element_size, const destroy_ctx *destroy, const equal_ctx *equal)
+{
+    gap_buffer_t *buffer = NULL;
+
+    if (0 == element_size)
+    {
+        goto END;
+    }
+
+    buffer = create_buffer(element_size, true, destroy, equal);
+
+END:
+    return buffer;
+}
+
+exit_code_t gap_buffer_move_cursor(gap_buffer_t *buffer, size_t position)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if (NULL == buffer)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    if (position > gap_buffer_size(buffer))
+    {
+        exit_code = E_OUT_OF_BOUNDS;
+        goto END;
+    }
+
+    // Only the elements between the old and new cursor cross the gap
+    if (position < buffer->gap_start)
+    {
+        size_t count = buffer->gap_start - position;
+        memmove(slot_at(buffer, buffer->gap_end - count), slot_at(buffer, position), count * buffer->element_size);
+        buffer->gap_start -= count;
+        buffer->gap_end -= count;
+    }
+    else if (position > buffer->gap_start)
+    {
+        size_t count = position - buffer->gap_start;
+        memmove(slot_at(buffer, buffer->gap_start), slot_at(buffer, buffer->gap_end), count * buffer->element_size);
+        buffer->gap_start += count;
+        buffer->gap_end += count;
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+size_t gap_buffer_cursor(gap_buffer_t *buffer)
+{
+    return (NULL == buffer) ? 0 : buffer->gap_start;
+}
+
+exit_code_t gap_buffer_insert(gap_buffer_t *buffer, void *data)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if (NULL == buffer)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    if (NULL == data)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    if (buffer->gap_start == buffer->gap_end)
+    {
+        exit_code = grow(buffer);
+        if (E_SUCCESS != exit_code)
+        {
+            goto END;
+        }
+    }
+
+    store_element(buffer, buffer->gap_start, data);
+    buffer->gap_start++;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t gap_buffer_delete_before(gap_buffer_t *buffer)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if (NULL == buffer)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    if (0 == buffer->gap_start)
+    {
+        exit_code = E_OUT_OF_BOUNDS;
+        goto END;
+    }
+
+    // The slot simply joins the gap
+    buffer->gap_start--;
+    destroy_element(buffer, buffer->gap_start);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t gap_buffer_delete_after(gap_buffer_t *buffer)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if (NULL == buffer)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    if (buffer->gap_end == buffer->total_capacity)
+    {
+        exit_code = E_OUT_OF_BOUNDS;
+        goto END;
+    }
+
+    destroy_element(buffer, buffer->gap_end);
+    buffer->gap_end++;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+void *gap_buffer_get(gap_buffer_t *buffer, size_t index)
+{
+    void *element = NULL;
+
+    if ((NULL == buffer) || (index >= gap_buffer_size(buffer)))
+    {
+        goto END;
+    }
+
+    element = element_at(buffer, physical_index(buffer, index));
+
+END:
+    return element;
+}
+
+exit_code_t gap_buffer_set(gap_buffer_t *buffer, size_t index, void *data)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if (NULL == buffer)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    if (index >= gap_buffer_size(buffer))
+    {
+        exit_code = E_OUT_OF_BOUNDS;
+        goto END;
+    }
+
+    if (NULL == data)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    size_t physical = physical_index(buffer, index);
+
+    // destroy the data if necessary
+    destroy_element(buffer, physical);
+
+    store_element(buffer, physical, data);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+bool gap_buffer_contains(gap_buffer_t *buffer, void *data)
+{
+    bool contains_data = false;
+
+    if ((NULL == buffer) || (NULL == data) || (NULL == buffer->equal))
+    {
+        goto END;
+    }
+
+    // Scan both halves, skipping the gap
+    for (size_t physical = 0; physical < buffer->total_capacity; physical++)
+    {
+        if (physical == buffer->gap_start)
+        {
+            physical = buffer->gap_end;
+            if (physical == buffer->total_capacity)
+            {
+                break;
+            }
+        }
+
+        if (true == buffer->equal->equal(element_at(buffer, physical), data, buffer->equal->ctx))
+        {
+            contains_data = true;
+            break;
+        }
+    }
+
+END:
+    return contains_data;
+}
+
+size_t gap_buffer_size(gap_buffer_t *buffer)
+{
+    size_t size = 0;
+
+    if (NULL == buffer)
+    {
+        goto END;
+    }
+
+    size = buffer->total_capacity - (buffer->gap_end - buffer->gap_start);
+
+END:
+    return size;
+}
+
+void gap_buffer_destroy(gap_buffer_t **buffer)
+{
+    if ((NULL == buffer) || (NULL == *buffer))
+    {
+        goto END;
+    }
+
+    // destroy the data if necessary
+    size_t size = gap_buffer_size(*buffer);
+    for (size_t index = 0; index < size; index++)
+    {
+        destroy_element(*buffer, physical_index(*buffer, index));
+    }
+
+    free((*buffer)->slots);
+    free(*buffer);
+    *buffer = NULL;
+
+END:
+    return;
+}
+
+gap_buffer_t *create_buffer(size_t element_size, bool is_typed, const destroy_ctx *destroy, const equal_ctx *equal)
+{
+    gap_buffer_t *buffer = calloc(1, sizeof(gap_buffer_t));
+    if (NULL == buffer)
+    {
+        goto END;
+    }
+
+    if (GAP_BUFFER_INITIAL_CAPACITY > SIZE_MAX / element_size)
+    {
+        goto FAIL;
+    }
+
+    buffer->slots = malloc(GAP_BUFFER_INITIAL_CAPACITY * element_size);
+    if (NULL == buffer->slots)
+    {
+        goto FAIL;
+    }
+
+    // The whole buffer starts out as gap
+    buffer->total_capacity = GAP_BUFFER_INITIAL_CAPACITY;
+    buffer->gap_start = 0;
+    buffer->gap_end = GAP_BUFFER_INITIAL_CAPACITY;
+    buffer->destroy = destroy;
+    buffer->equal = equal;
+    buffer->element_size = element_size;
+    buffer->is_typed = is_typed;
+    goto END;
+
+FAIL:
+    free(buffer);
+    buffer = NULL;
+END:
+    return buffer;
+}
+
+exit_code_t grow(gap_buffer_t *buffer)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if (buffer->total_capacity > SIZE_MAX / 2 / buffer->element_size)
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
+
+    size_t new_capacity = buffer->total_capacity * 2;
+    unsigned char *temp = realloc(buffer->slots, new_capacity * buffer->element_size);
+    if (NULL == temp)
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
+
+    // Slide the elements after the cursor to the new end; the gap takes the new space
+    size_t tail = buffer->total_capacity - buffer->gap_end;
+    size_t new_gap_end = new_capacity - tail;
+    memmove(temp + (new_gap_end * buffer->element_size), temp + (buffer->gap_end * buffer->element_size),
+            tail * buffer->element_size);
+
+    buffer->slots = temp;
+    buffer->gap_end = new_gap_end;
+    buffer->total_capacity = new_capacity;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+size_t physical_index(gap_buffer_t *buffer, size_t index)
+{
+    return (index < buffer->gap_start) ? index : index + (buffer->gap_end - buffer->gap_start);
+}
+
+void *slot_at(gap_buffer_t *buffer, size_t physical)
+{
+    return buffer->slots + (physical * buffer->element_size);
+}
+
+void *element_at(gap_buffer_t *buffer, size_t physical)
+{
+    // Typed buffers hand out the address of the slot, pointer buffers the stored pointer
+    return buffer->is_typed ? slot_at(buffer, physical) : *(void **)slot_at(buffer, physical);
+}
+
+void store_element(gap_buffer_t *buffer, size_t physical, void *data)
+{
+    if (buffer->is_typed)
+    {
+        memcpy(slot_at(buffer, physical), data, buffer->element_size);
+    }
+    else
+    {
+        *(void **)slot_at(buffer, physical) = data;
+    }
+}
+
+void destroy_element(gap_buffer_t *buffer, size_t physical)
+{
+    const destroy_ctx *destroy = buffer->destroy;
+
+    if (NULL == destroy)
+    {
+        goto END;
+    }
+
+    if (NULL != destroy->destroy)
+    {
+        destroy->destroy(element_at(buffer, physical), destroy->context);
+    }
+    else if (NULL != destroy->destroy_many)
+    {
+        // A batch of one, holding the same pointer destroy would have been given
+        void *item = element_at(buffer, physical);
+        destroy->destroy_many(&item, 1, destroy->context);
+    }
+
+END:
+    return;
+}
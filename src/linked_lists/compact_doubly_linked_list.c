@@ -0,0 +1,647 @@
+#include <string.h>
+
+#include "linked_lists/compact_doubly_linked_list.h"
+
+#define NIL UINT32_MAX // index marking the end of the list and of the free list
+
+typedef struct cdll_node
+{
+    void *data;
+    uint32_t next; // on the free list, the next free slot
+    uint32_t prev;
+} cdll_node_t;
+
+struct compact_doubly_linked_list
+{
+    cdll_node_t *nodes;
+    uint32_t capacity;
+    uint32_t used;      // slots below this have been handed out at least once
+    uint32_t head;
+    uint32_t tail;
+    uint32_t free_head; // released slots, handed out again before fresh ones
+    size_t current_size;
+};
+
+/// @brief Takes a slot for a new node, growing the array if every slot is in use.
+/// @param list The list to take the slot from.
+/// @param data The data to be added.
+/// @param index Receives the index of the slot.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+static exit_code_t create_new_node(compact_doubly_linked_list_t *list, void *data, uint32_t *index);
+
+/// @brief Links a node in after another one, or at the head if previous is NIL.
+static void link_after(compact_doubly_linked_list_t *list, uint32_t previous, uint32_t index);
+
+/// @brief Unlinks a node and puts its slot on the free list.
+/// @return The value the node held.
+static void *unlink_node(compact_doubly_linked_list_t *list, uint32_t index);
+
+/// @brief Finds the node at a position, walking in from whichever end is nearer.
+static uint32_t index_at_pos(const compact_doubly_linked_list_t *list, size_t position);
+
+static exit_code_t resize_nodes(compact_doubly_linked_list_t *list, size_t capacity);
+
+compact_doubly_linked_list_t *cdll_create(void)
+{
+    compact_doubly_linked_list_t *list = NULL;
+
+    // 1. Create the list; the node array is allocated on the first push
+    list = calloc(1, sizeof(compact_doubly_linked_list_t));
+
+    // 2. Check if memory allocation was successful
+    if (NULL != list)
+    {
+        list->nodes = NULL;
+        list->capacity = 0;
+        list->used = 0;
+        list->head = NIL;
+        list->tail = NIL;
+        list->free_head = NIL;
+        list->current_size = 0;
+    }
+
+    return list;
+}
+
+compact_doubly_linked_list_t *cdll_clone(const compact_doubly_linked_list_t *list)
+{
+    compact_doubly_linked_list_t *clone = NULL;
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        goto END;
+    }
+
+    // 2. Create the copy
+    clone = cdll_create();
+    if (NULL == clone)
+    {
+        goto END;
+    }
+
+    // 3. Indexes mean nothing points into the array, so every slot in use copies across as it is
+    if (0 != list->used)
+    {
+        clone->nodes = malloc((size_t)list->used * sizeof(cdll_node_t));
+        if (NULL == clone->nodes)
+        {
+            cdll_destroy_list(&clone);
+            goto END;
+        }
+
+        memcpy(clone->nodes, list->nodes, (size_t)list->used * sizeof(cdll_node_t));
+    }
+
+    clone->capacity = list->used;
+    clone->used = list->used;
+    clone->head = list->head;
+    clone->tail = list->tail;
+    clone->free_head = list->free_head;
+    clone->current_size = list->current_size;
+
+END:
+    return clone;
+}
+
+size_t cdll_size(const compact_doubly_linked_list_t *list)
+{
+    return (NULL != list) ? list->current_size : 0;
+}
+
+size_t cdll_capacity(const compact_doubly_linked_list_t *list)
+{
+    return (NULL != list) ? list->capacity : 0;
+}
+
+exit_code_t cdll_reserve(compact_doubly_linked_list_t *list, size_t capacity)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check if the array already has room
+    if (capacity <= list->capacity)
+    {
+        exit_code = E_SUCCESS;
+        goto END;
+    }
+
+    exit_code = resize_nodes(list, capacity);
+
+END:
+    return exit_code;
+}
+
+exit_code_t cdll_push_head(compact_doubly_linked_list_t *list, void *data)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+    uint32_t index = NIL;
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check if data exists
+    if (NULL == data)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    exit_code = create_new_node(list, data, &index); // Create a new node
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
+
+    // 3. Insert node at the front of the list
+    link_after(list, NIL, index);
+
+END:
+    return exit_code;
+}
+
+exit_code_t cdll_push_tail(compact_doubly_linked_list_t *list, void *data)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+    uint32_t index = NIL;
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check if data exists
+    if (NULL == data)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    exit_code = create_new_node(list, data, &index); // Create a new node
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
+
+    // 3. Insert node at the back of the list
+    link_after(list, list->tail, index);
+
+END:
+    return exit_code;
+}
+
+exit_code_t cdll_push_position(compact_doubly_linked_list_t *list, void *data, size_t position)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+    uint32_t index = NIL;
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check if data exists
+    if (NULL == data)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // 3. Check if position is out of range
+    if ((position > list->current_size) || (position == 0))
+    {
+        exit_code = E_OUT_OF_BOUNDS;
+        goto END;
+    }
+
+    exit_code = create_new_node(list, data, &index); // Create a new node
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
+
+    // 4. Insert node in front of the node currently at the position
+    uint32_t current = index_at_pos(list, position);
+    link_after(list, list->nodes[current].prev, index);
+
+END:
+    return exit_code;
+}
+
+void *cdll_peek_head(compact_doubly_linked_list_t *list)
+{
+    void *data = NULL;
+
+    // Check if list exists or is empty
+    if ((NULL == list) || (NIL == list->head))
+    {
+        goto END;
+    }
+
+    data = list->nodes[list->head].data;
+
+END:
+    return data;
+}
+
+void *cdll_peek_tail(compact_doubly_linked_list_t *list)
+{
+    void *data = NULL;
+
+    // Check if list exists or is empty
+    if ((NULL == list) || (NIL == list->tail))
+    {
+        goto END;
+    }
+
+    data = list->nodes[list->tail].data;
+
+END:
+    return data;
+}
+
+void *cdll_peek_position(compact_doubly_linked_list_t *list, size_t position)
+{
+    void *data = NULL;
+
+    // 1. Check if list exists or is empty
+    if ((NULL == list) || (NIL == list->head))
+    {
+        goto END;
+    }
+
+    // 2. Check if position is out of range
+    if ((position > list->current_size) || (position == 0))
+    {
+        goto END;
+    }
+
+    data = list->nodes[index_at_pos(list, position)].data;
+
+END:
+    return data;
+}
+
+void *cdll_pop_head(compact_doubly_linked_list_t *list)
+{
+    void *data = NULL;
+
+    // Check if list exists or is empty
+    if ((NULL == list) || (NIL == list->head))
+    {
+        goto END;
+    }
+
+    data = unlink_node(list, list->head);
+
+END:
+    return data;
+}
+
+void *cdll_pop_tail(compact_doubly_linked_list_t *list)
+{
+    void *data = NULL;
+
+    // Check if list exists or is empty
+    if ((NULL == list) || (NIL == list->tail))
+    {
+        goto END;
+    }
+
+    data = unlink_node(list, list->tail);
+
+END:
+    return data;
+}
+
+void *cdll_pop_position(compact_doubly_linked_list_t *list, size_t position)
+{
+    void *data = NULL;
+
+    // 1. Check if list exists or is empty
+    if ((NULL == list) || (NIL == list->head))
+    {
+        goto END;
+    }
+
+    // 2. Check if position is out of range
+    if ((position > list->current_size) || (position == 0))
+    {
+        goto END;
+    }
+
+    data = unlink_node(list, index_at_pos(list, position));
+
+END:
+    return data;
+}
+
+exit_code_t cdll_remove_head(compact_doubly_linked_list_t *list)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // set the fail state
+
+    // 1. Check if list does not exist or is empty
+    if ((NULL == list) || (NIL == list->head))
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    unlink_node(list, list->head);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t cdll_remove_tail(compact_doubly_linked_list_t *list)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // set the fail state
+
+    // 1. Check if list does not exist or is empty
+    if ((NULL == list) || (NIL == list->tail))
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    unlink_node(list, list->tail);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t cdll_remove_position(compact_doubly_linked_list_t *list, size_t position)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if list does not exist or is empty
+    if ((NULL == list) || (NIL == list->head))
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check if position is out of range
+    if ((position > list->current_size) || (position == 0))
+    {
+        exit_code = E_OUT_OF_BOUNDS;
+        goto END;
+    }
+
+    unlink_node(list, index_at_pos(list, position));
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t cdll_print_list(compact_doubly_linked_list_t *list, void (*function_ptr)(void *), bool reverse)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check for NULL function pointer
+    if (NULL == function_ptr)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // 3. Print the list in the requested direction
+    uint32_t current = (true == reverse) ? list->tail : list->head;
+
+    while (NIL != current)
+    {
+        (*function_ptr)(list->nodes[current].data);
+
+        current = (true == reverse) ? list->nodes[current].prev : list->nodes[current].next;
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+void cdll_clear_list(compact_doubly_linked_list_t **list)
+{
+    // 1. Check if list is empty
+    if ((NULL == list) || (NULL == *list))
+    {
+        goto END;
+    }
+
+    // 2. Every slot becomes fresh again; the array itself is kept
+    (*list)->used = 0;
+    (*list)->head = NIL;
+    (*list)->tail = NIL;
+    (*list)->free_head = NIL;
+    (*list)->current_size = 0;
+
+END:
+    return;
+}
+
+void cdll_destroy_list(compact_doubly_linked_list_t **list)
+{
+    // 1. Check if list is empty
+    if ((NULL == list) || (NULL == *list))
+    {
+        goto END;
+    }
+
+    // 2. Free the whole node array at once
+    free((*list)->nodes);
+
+    // 3. Destroy the list container
+    free(*list);
+    *list = NULL;
+
+END:
+    return;
+}
+
+// HELPER FUNCTIONS
+
+exit_code_t create_new_node(compact_doubly_linked_list_t *list, void *data, uint32_t *index)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    // 1. Reuse a released slot if there is one
+    if (NIL != list->free_head)
+    {
+        *index = list->free_head;
+        list->free_head = list->nodes[*index].next;
+    }
+    else
+    {
+        // 2. Otherwise take a fresh slot, doubling the array once they run out
+        if (list->used == list->capacity)
+        {
+            size_t capacity = (0 == list->capacity) ? CDLL_MIN_CAPACITY : (size_t)list->capacity * 2;
+            if (capacity > CDLL_MAX_CAPACITY)
+            {
+                capacity = CDLL_MAX_CAPACITY;
+            }
+
+            if (capacity == list->capacity)
+            {
+                exit_code = E_TOO_BIG;
+                goto END;
+            }
+
+            exit_code = resize_nodes(list, capacity);
+            if (E_SUCCESS != exit_code)
+            {
+                goto END;
+            }
+        }
+
+        *index = list->used;
+        list->used += 1;
+    }
+
+    list->nodes[*index].data = data;
+    list->nodes[*index].next = NIL;
+    list->nodes[*index].prev = NIL;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+void link_after(compact_doubly_linked_list_t *list, uint32_t previous, uint32_t index)
+{
+    cdll_node_t *node = &list->nodes[index];
+
+    node->prev = previous;
+    node->next = (NIL == previous) ? list->head : list->nodes[previous].next;
+
+    if (NIL == previous)
+    {
+        list->head = index;
+    }
+    else
+    {
+        list->nodes[previous].next = index;
+    }
+
+    if (NIL == node->next)
+    {
+        list->tail = index;
+    }
+    else
+    {
+        list->nodes[node->next].prev = index;
+    }
+
+    list->current_size += 1;
+}
+
+void *unlink_node(compact_doubly_linked_list_t *list, uint32_t index)
+{
+    cdll_node_t *node = &list->nodes[index];
+    void *data = node->data;
+
+    // 1. Join the neighbours to each other, or move the head or tail past the node
+    if (NIL == node->prev)
+    {
+        list->head = node->next;
+    }
+    else
+    {
+        list->nodes[node->prev].next = node->next;
+    }
+
+    if (NIL == node->next)
+    {
+        list->tail = node->prev;
+    }
+    else
+    {
+        list->nodes[node->next].prev = node->prev;
+    }
+
+    // 2. Release the slot
+    node->data = NULL;
+    node->prev = NIL;
+    node->next = list->free_head;
+    list->free_head = index;
+
+    list->current_size -= 1;
+
+    return data;
+}
+
+uint32_t index_at_pos(const compact_doubly_linked_list_t *list, size_t position)
+{
+    uint32_t current = NIL;
+
+    if (position <= list->current_size / 2)
+    {
+        // Start searching from the head
+        current = list->head;
+        for (size_t current_pos = 1; current_pos < position; current_pos++)
+        {
+            current = list->nodes[current].next;
+        }
+    }
+    else
+    {
+        // Start searching from the tail
+        current = list->tail;
+        for (size_t current_pos = list->current_size; current_pos > position; current_pos--)
+        {
+            current = list->nodes[current].prev;
+        }
+    }
+
+    return current;
+}
+
+exit_code_t resize_nodes(compact_doubly_linked_list_t *list, size_t capacity)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if (capacity > CDLL_MAX_CAPACITY)
+    {
+        exit_code = E_TOO_BIG;
+        goto END;
+    }
+
+    // Links are indexes, so moving the array leaves every one of them valid
+    cdll_node_t *nodes = realloc(list->nodes, capacity * sizeof(cdll_node_t));
+    if (NULL == nodes)
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
+
+    list->nodes = nodes;
+    list->capacity = (uint32_t)capacity;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
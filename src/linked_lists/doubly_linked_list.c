@@ -1,4 +1,7 @@
+#include <stddef.h>
+
 #include "linked_lists/doubly_linked_list.h"
+#include "utilities/sort.h"
 
 struct dll_node
 {
@@ -12,6 +15,8 @@ struct doubly_linked_list
     dll_node_t *head;
     dll_node_t *tail;
     size_t current_size;
+    node_pool_t *pool; // supplies every node of the list
+    bool owns_pool;    // true if the pool was created for this list alone
 };
 
 typedef struct results
@@ -21,28 +26,70 @@ typedef struct results
 } results_t;
 
 /// @brief Creates a new node
+/// @param list The list whose pool supplies the node.
 /// @param data The data to be added.
 /// @return new_dll_node_t
-static dll_node_t *create_new_node(void *data);
+static dll_node_t *create_new_node(doubly_linked_list_t *list, void *data);
 
-static exit_code_t get_nodes_at_pos(results_t **results_p, doubly_linked_list_t *list, size_t position);
+static exit_code_t get_nodes_at_pos(results_t *results, doubly_linked_list_t *list, size_t position);
 
 doubly_linked_list_t *dll_create(void)
 {
-    // 1. Create the list
-    doubly_linked_list_t *list = calloc(1, sizeof(doubly_linked_list_t));
+    doubly_linked_list_t *list = NULL;
+
+    // 1. Create a pool for this list alone
+    node_pool_t *pool = node_pool_create(sizeof(dll_node_t), 0);
+    if (NULL == pool)
+    {
+        goto END;
+    }
+
+    // 2. Create the list around it
+    list = dll_create_with_pool(pool);
+    if (NULL == list)
+    {
+        node_pool_destroy(&pool);
+        goto END;
+    }
+
+    list->owns_pool = true;
+
+END:
+    return list;
+}
+
+doubly_linked_list_t *dll_create_with_pool(node_pool_t *pool)
+{
+    doubly_linked_list_t *list = NULL;
+
+    // 1. Check if pool exists and its nodes are big enough
+    if ((NULL == pool) || (node_pool_node_size(pool) < sizeof(dll_node_t)))
+    {
+        goto END;
+    }
 
-    // 2. Check if memory allocation was successful
+    // 2. Create the list
+    list = calloc(1, sizeof(doubly_linked_list_t));
+
+    // 3. Check if memory allocation was successful
     if (NULL != list)
     {
         list->current_size = 0;
         list->head = NULL;
         list->tail = NULL;
+        list->pool = pool;
+        list->owns_pool = false;
     }
 
+END:
     return list;
 }
 
+size_t dll_node_size(void)
+{
+    return sizeof(dll_node_t);
+}
+
 exit_code_t dll_push_head(doubly_linked_list_t *list, void *data)
 {
     exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
@@ -61,7 +108,12 @@ exit_code_t dll_push_head(doubly_linked_list_t *list, void *data)
         goto END;
     }
 
-    dll_node_t *new_node = create_new_node(data); // Create a new node
+    dll_node_t *new_node = create_new_node(list, data); // Create a new node
+    if (NULL == new_node)
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
 
     // 3. Determine links based on whether or not list is empty
     if (NULL == list->head)
@@ -104,7 +156,12 @@ exit_code_t dll_push_tail(doubly_linked_list_t *list, void *data)
         goto END;
     }
 
-    dll_node_t *new_node = create_new_node(data); // Create a new node
+    dll_node_t *new_node = create_new_node(list, data); // Create a new node
+    if (NULL == new_node)
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
 
     // 3. Determine links based on whether or not list is empty
     if (NULL == list->head)
@@ -154,7 +211,12 @@ exit_code_t dll_push_position(doubly_linked_list_t *list, void *data, size_t pos
         goto END;
     }
 
-    dll_node_t *new_node = create_new_node(data); // Create a new node
+    dll_node_t *new_node = create_new_node(list, data); // Create a new node
+    if (NULL == new_node)
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
 
     // 4. Determine links based on whether or not list is empty
     if (NULL == list->head)
@@ -165,25 +227,20 @@ exit_code_t dll_push_position(doubly_linked_list_t *list, void *data, size_t pos
     }    
     else
     {
-        results_t *results = NULL;
+        results_t results = {NULL, NULL};
         exit_code = get_nodes_at_pos(&results, list, position);
         if (E_SUCCESS != exit_code)
         {
-            free(results);
-            results = NULL;
             goto END;
         }
         
-        results->current_node->prev->next = new_node;
-        new_node->prev = results->current_node->prev;
-
-        new_node->next = results->current_node;
-        results->current_node->prev = new_node;
+        results.current_node->prev->next = new_node;
+        new_node->prev = results.current_node->prev;
 
-        results->current_node = new_node;
+        new_node->next = results.current_node;
+        results.current_node->prev = new_node;
 
-        free(results);
-        results = NULL;
+        results.current_node = new_node;
     }
 
     // 4. Increment the size of the list
@@ -242,19 +299,14 @@ void *dll_peek_position(doubly_linked_list_t *list, size_t position)
         goto END;
     }
 
-    results_t *results = NULL;
+    results_t results = {NULL, NULL};
     exit_code_t exit_code = get_nodes_at_pos(&results, list, position);
     if (E_SUCCESS != exit_code)
     {
-        free(results);
-        results = NULL;
         goto END;
     }
 
-    data = results->current_node->data;
-
-    free(results);
-    results = NULL;
+    data = results.current_node->data;
 
 END:
     return data;
@@ -310,20 +362,16 @@ void *dll_pop_position(doubly_linked_list_t *list, size_t position)
         goto END;
     }
 
-    results_t *results = NULL;
+    results_t results = {NULL, NULL};
     exit_code_t exit_code = get_nodes_at_pos(&results, list, position);
     if (E_SUCCESS != exit_code)
     {
-        free(results);
-        results = NULL;
         goto END;
     }
         
-    data = results->current_node->data;
+    data = results.current_node->data;
     dll_remove_position(list, position);
 
-    free(results);
-
 END:
     return data;
 }
@@ -342,14 +390,14 @@ exit_code_t dll_remove_head(doubly_linked_list_t *list)
     // 3. Check if there is only one node in the list
     if (NULL == list->head->next)
     {
-        free(list->head);
+        node_pool_free(list->pool, list->head);
         list->head = NULL;
     }
     else
     {
         dll_node_t *temp = list->head->next;
 
-        free(list->head);
+        node_pool_free(list->pool, list->head);
         list->head = NULL;
 
         list->head = temp;
@@ -376,14 +424,14 @@ exit_code_t dll_remove_tail(doubly_linked_list_t *list)
     // 3. Check if there is only one node in the list
     if (NULL == list->tail->prev)
     {
-        free(list->tail);
+        node_pool_free(list->pool, list->tail);
         list->tail = NULL;
     }
     else
     {
         dll_node_t *temp = list->tail->prev;
 
-        free(list->tail);
+        node_pool_free(list->pool, list->tail);
         list->tail = NULL;
 
         list->tail = temp;
@@ -431,20 +479,17 @@ exit_code_t dll_remove_position(doubly_linked_list_t *list, size_t position)
         return exit_code;  
     }
 
-    results_t *results = NULL;
+    results_t results = {NULL, NULL};
     exit_code = get_nodes_at_pos(&results, list, position);
     if (E_SUCCESS != exit_code)
     {
-        free(results);
-        results = NULL;
         goto END;
     }
 
-    results->current_node->prev->next = results->current_node->next;
-    results->current_node->next->prev = results->current_node->prev->next;
+    results.current_node->prev->next = results.current_node->next;
+    results.current_node->next->prev = results.current_node->prev->next;
 
-    free(results->current_node);
-    free(results);
+    node_pool_free(list->pool, results.current_node);
     
     // 4. Increment the size of the list
     list->current_size -= 1;
@@ -513,15 +558,22 @@ void dll_clear_list(doubly_linked_list_t **list)
         goto END;
     }
 
-    dll_node_t *current_node = (*list)->head;
-    dll_node_t *next_node = NULL;
-
-    // 2. Clear out all the nodes in the list
-    while (NULL != current_node)
+    // 2. Clear out all the nodes in the list, all at once if no other list shares the pool
+    if (true == (*list)->owns_pool)
     {
-        next_node = current_node->next;
-        free(current_node);
-        current_node = next_node;
+        node_pool_reset((*list)->pool);
+    }
+    else
+    {
+        dll_node_t *current_node = (*list)->head;
+        dll_node_t *next_node = NULL;
+
+        while (NULL != current_node)
+        {
+            next_node = current_node->next;
+            node_pool_free((*list)->pool, current_node);
+            current_node = next_node;
+        }
     }
 
     (*list)->head = NULL;
@@ -543,7 +595,13 @@ void dll_destroy_list(doubly_linked_list_t **list)
     // 2. Clear out all the nodes
     dll_clear_list(list);
 
-    // 3. Destroy the list container
+    // 3. Destroy the pool if no other list uses it
+    if (true == (*list)->owns_pool)
+    {
+        node_pool_destroy(&(*list)->pool);
+    }
+
+    // 4. Destroy the list container
     free(*list);
     *list = NULL;
 
@@ -551,10 +609,336 @@ END:
     return;
 }
 
-dll_node_t *create_new_node(void *data)
+exit_code_t dll_cursor_head(doubly_linked_list_t *list, dll_cursor_t *cursor)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check if cursor exists
+    if (NULL == cursor)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    cursor->list = list;
+    cursor->current = list->head;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t dll_cursor_tail(doubly_linked_list_t *list, dll_cursor_t *cursor)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check if cursor exists
+    if (NULL == cursor)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    cursor->list = list;
+    cursor->current = list->tail;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t dll_cursor_next(dll_cursor_t *cursor)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if cursor exists
+    if ((NULL == cursor) || (NULL == cursor->list))
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // 2. Check if cursor is past the end
+    if (NULL == cursor->current)
+    {
+        exit_code = E_OUT_OF_BOUNDS;
+        goto END;
+    }
+
+    cursor->current = cursor->current->next;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t dll_cursor_prev(dll_cursor_t *cursor)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if cursor exists
+    if ((NULL == cursor) || (NULL == cursor->list))
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // 2. Step back onto the tail from past the end
+    if (NULL == cursor->current)
+    {
+        if (NULL == cursor->list->tail)
+        {
+            exit_code = E_OUT_OF_BOUNDS;
+            goto END;
+        }
+
+        cursor->current = cursor->list->tail;
+        exit_code = E_SUCCESS;
+        goto END;
+    }
+
+    // 3. Check if cursor is on the head
+    if (NULL == cursor->current->prev)
+    {
+        exit_code = E_OUT_OF_BOUNDS;
+        goto END;
+    }
+
+    cursor->current = cursor->current->prev;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+void *dll_cursor_get(const dll_cursor_t *cursor)
+{
+    void *data = NULL;
+
+    // Check if cursor exists or is past the end
+    if ((NULL == cursor) || (NULL == cursor->current))
+    {
+        goto END;
+    }
+
+    data = cursor->current->data;
+
+END:
+    return data;
+}
+
+exit_code_t dll_cursor_insert_before(dll_cursor_t *cursor, void *data)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if cursor and data exist
+    if ((NULL == cursor) || (NULL == cursor->list) || (NULL == data))
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    doubly_linked_list_t *list = cursor->list;
+
+    dll_node_t *new_node = create_new_node(list, data); // Create a new node
+    if (NULL == new_node)
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
+
+    // 2. Past the end, the node goes after the tail; otherwise it goes before the cursor
+    new_node->prev = (NULL == cursor->current) ? list->tail : cursor->current->prev;
+    new_node->next = cursor->current;
+
+    if (NULL == new_node->prev)
+    {
+        list->head = new_node;
+    }
+    else
+    {
+        new_node->prev->next = new_node;
+    }
+
+    if (NULL == cursor->current)
+    {
+        list->tail = new_node;
+    }
+    else
+    {
+        cursor->current->prev = new_node;
+    }
+
+    // 3. Increment the size of the list
+    list->current_size += 1;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t dll_cursor_insert_after(dll_cursor_t *cursor, void *data)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if cursor and data exist
+    if ((NULL == cursor) || (NULL == cursor->list) || (NULL == data))
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // 2. Check if cursor is past the end
+    if (NULL == cursor->current)
+    {
+        exit_code = E_OUT_OF_BOUNDS;
+        goto END;
+    }
+
+    doubly_linked_list_t *list = cursor->list;
+
+    dll_node_t *new_node = create_new_node(list, data); // Create a new node
+    if (NULL == new_node)
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
+
+    // 3. Link the node in after the cursor
+    new_node->prev = cursor->current;
+    new_node->next = cursor->current->next;
+
+    if (NULL == new_node->next)
+    {
+        list->tail = new_node;
+    }
+    else
+    {
+        new_node->next->prev = new_node;
+    }
+    cursor->current->next = new_node;
+
+    // 4. Increment the size of the list
+    list->current_size += 1;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t dll_cursor_erase(dll_cursor_t *cursor)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if cursor exists
+    if ((NULL == cursor) || (NULL == cursor->list))
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // 2. Check if cursor is past the end
+    if (NULL == cursor->current)
+    {
+        exit_code = E_OUT_OF_BOUNDS;
+        goto END;
+    }
+
+    doubly_linked_list_t *list = cursor->list;
+    dll_node_t *erased = cursor->current;
+
+    // 3. Unlink the node from both of its neighbours
+    if (NULL == erased->prev)
+    {
+        list->head = erased->next;
+    }
+    else
+    {
+        erased->prev->next = erased->next;
+    }
+
+    if (NULL == erased->next)
+    {
+        list->tail = erased->prev;
+    }
+    else
+    {
+        erased->next->prev = erased->prev;
+    }
+
+    cursor->current = erased->next;
+    node_pool_free(list->pool, erased);
+
+    // 4. Decrement the size of the list
+    list->current_size -= 1;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t dll_sort(doubly_linked_list_t *list, const compare_ctx *compare)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check if comparator exists
+    if ((NULL == compare) || (NULL == compare->compare))
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // Lists of fewer than two nodes are already sorted
+    if (list->current_size < 2)
+    {
+        exit_code = E_SUCCESS;
+        goto END;
+    }
+
+    // 3. Relink the nodes in order
+    void *tail = NULL;
+    list->head = linked_merge_sort(list->head, offsetof(dll_node_t, next), offsetof(dll_node_t, data), compare,
+                                   &tail);
+    list->tail = tail;
+
+    // 4. The sort only relinks next pointers, so rebuild the prev pointers in one pass
+    dll_node_t *previous_node = NULL;
+    for (dll_node_t *current_node = list->head; NULL != current_node; current_node = current_node->next)
+    {
+        current_node->prev = previous_node;
+        previous_node = current_node;
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+dll_node_t *create_new_node(doubly_linked_list_t *list, void *data)
 {
     // 1. Allocate memory for new node
-    dll_node_t *new_node = calloc(1, sizeof(dll_node_t));
+    dll_node_t *new_node = node_pool_alloc(list->pool);
     if (NULL != new_node)
     {
         new_node->data = data;
@@ -565,17 +949,10 @@ dll_node_t *create_new_node(void *data)
     return new_node;
 }
 
-exit_code_t get_nodes_at_pos(results_t **results_p, doubly_linked_list_t *list, size_t position)
+exit_code_t get_nodes_at_pos(results_t *results, doubly_linked_list_t *list, size_t position)
 {
     exit_code_t exit_code = E_DEFAULT_ERROR;
 
-    results_t *results = calloc(1, sizeof(results_t));
-    if (NULL == results)
-    {
-        exit_code = E_NULL_POINTER;
-        goto END;
-    }
-
 	results->previous_node = NULL;
 	results->current_node = NULL;
 
@@ -618,7 +995,6 @@ exit_code_t get_nodes_at_pos(results_t **results_p, doubly_linked_list_t *list,
         }
     }
 
-    *results_p = results;
     exit_code = E_SUCCESS;
 END:
     return exit_code;
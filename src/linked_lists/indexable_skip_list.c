@@ -0,0 +1,602 @@
+#include <stdint.h>
+
+#include "linked_lists/indexable_skip_list.h"
+
+typedef struct isl_link
+{
+    isl_node_t *next;
+    size_t width; // positions from this node to next (only meaningful while next is not NULL)
+} isl_link_t;
+
+struct isl_node
+{
+    void *data;
+    size_t levels;       // links in the tower
+    isl_link_t links[];  // links[0] is the plain linked list, higher levels skip ahead
+};
+
+struct indexable_skip_list
+{
+    isl_node_t *header;  // sentinel at position 0 with a full tower of links
+    isl_node_t *tail;
+    size_t current_size;
+    size_t level;        // levels in use, at least 1
+    uint64_t random;     // xorshift state for picking tower heights
+};
+
+/// @brief Creates a new node with a tower of the given height
+/// @param levels The number of links in the tower.
+/// @param data The data to be added.
+/// @return new_isl_node_t
+static isl_node_t *create_new_node(size_t levels, void *data);
+
+/// @brief Picks a tower height, each level above the first with a 1 in 4 chance.
+static size_t random_level(indexable_skip_list_t *list);
+
+/// @brief Finds, on every level in use, the last node before a position.
+/// @param list The list to search.
+/// @param position The position to search for (1 for the head).
+/// @param update Receives the node found on each level.
+/// @param ranks Receives the position of each of those nodes (0 for the header). May be NULL.
+static void find_predecessors(indexable_skip_list_t *list, size_t position, isl_node_t **update, size_t *ranks);
+
+static exit_code_t insert_at(indexable_skip_list_t *list, void *data, size_t position);
+
+static void *remove_at(indexable_skip_list_t *list, size_t position);
+
+indexable_skip_list_t *isl_create(void)
+{
+    indexable_skip_list_t *list = NULL;
+
+    // 1. Create the list
+    list = calloc(1, sizeof(indexable_skip_list_t));
+    if (NULL == list)
+    {
+        goto END;
+    }
+
+    // 2. Create the header with a full tower, so the list can grow to any level without reallocating it
+    list->header = create_new_node(ISL_MAX_LEVEL, NULL);
+    if (NULL == list->header)
+    {
+        free(list);
+        list = NULL;
+        goto END;
+    }
+
+    list->tail = NULL;
+    list->current_size = 0;
+    list->level = 1;
+    list->random = UINT64_C(0x9E3779B97F4A7C15) ^ (uint64_t)(uintptr_t)list;
+
+END:
+    return list;
+}
+
+size_t isl_size(const indexable_skip_list_t *list)
+{
+    return (NULL != list) ? list->current_size : 0;
+}
+
+exit_code_t isl_push_head(indexable_skip_list_t *list, void *data)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check if data exists
+    if (NULL == data)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    exit_code = insert_at(list, data, 1);
+
+END:
+    return exit_code;
+}
+
+exit_code_t isl_push_tail(indexable_skip_list_t *list, void *data)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check if data exists
+    if (NULL == data)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    exit_code = insert_at(list, data, list->current_size + 1);
+
+END:
+    return exit_code;
+}
+
+exit_code_t isl_push_position(indexable_skip_list_t *list, void *data, size_t position)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check if data exists
+    if (NULL == data)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // 3. Check if position is out of range
+    if ((position > list->current_size) || (position == 0))
+    {
+        exit_code = E_OUT_OF_BOUNDS;
+        goto END;
+    }
+
+    exit_code = insert_at(list, data, position);
+
+END:
+    return exit_code;
+}
+
+void *isl_peek_head(indexable_skip_list_t *list)
+{
+    void *data = NULL;
+
+    // Check if list exists or is empty
+    if ((NULL == list) || (NULL == list->tail))
+    {
+        goto END;
+    }
+
+    data = list->header->links[0].next->data;
+
+END:
+    return data;
+}
+
+void *isl_peek_tail(indexable_skip_list_t *list)
+{
+    void *data = NULL;
+
+    // Check if list exists or is empty
+    if ((NULL == list) || (NULL == list->tail))
+    {
+        goto END;
+    }
+
+    data = list->tail->data;
+
+END:
+    return data;
+}
+
+void *isl_peek_position(indexable_skip_list_t *list, size_t position)
+{
+    void *data = NULL;
+
+    // 1. Check if list exists or is empty
+    if ((NULL == list) || (NULL == list->tail))
+    {
+        goto END;
+    }
+
+    // 2. Check if position is out of range
+    if ((position > list->current_size) || (position == 0))
+    {
+        goto END;
+    }
+
+    // 3. Drop down the levels, taking every link that does not pass the position
+    isl_node_t *current_node = list->header;
+    size_t traversed = 0;
+
+    for (size_t level = list->level; level > 0; level--)
+    {
+        isl_link_t *link = &current_node->links[level - 1];
+
+        while ((NULL != link->next) && (traversed + link->width <= position))
+        {
+            traversed += link->width;
+            current_node = link->next;
+            link = &current_node->links[level - 1];
+        }
+
+        if (traversed == position)
+        {
+            break;
+        }
+    }
+
+    data = current_node->data;
+
+END:
+    return data;
+}
+
+void *isl_pop_head(indexable_skip_list_t *list)
+{
+    void *data = NULL;
+
+    // Check if list exists or is empty
+    if ((NULL == list) || (NULL == list->tail))
+    {
+        goto END;
+    }
+
+    data = remove_at(list, 1);
+
+END:
+    return data;
+}
+
+void *isl_pop_tail(indexable_skip_list_t *list)
+{
+    void *data = NULL;
+
+    // Check if list exists or is empty
+    if ((NULL == list) || (NULL == list->tail))
+    {
+        goto END;
+    }
+
+    data = remove_at(list, list->current_size);
+
+END:
+    return data;
+}
+
+void *isl_pop_position(indexable_skip_list_t *list, size_t position)
+{
+    void *data = NULL;
+
+    // 1. Check if list exists or is empty
+    if ((NULL == list) || (NULL == list->tail))
+    {
+        goto END;
+    }
+
+    // 2. Check if position is out of range
+    if ((position > list->current_size) || (position == 0))
+    {
+        goto END;
+    }
+
+    data = remove_at(list, position);
+
+END:
+    return data;
+}
+
+exit_code_t isl_remove_head(indexable_skip_list_t *list)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // set the fail state
+
+    // 1. Check if list does not exist or is empty
+    if ((NULL == list) || (NULL == list->tail))
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    remove_at(list, 1);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t isl_remove_tail(indexable_skip_list_t *list)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // set the fail state
+
+    // 1. Check if list does not exist or is empty
+    if ((NULL == list) || (NULL == list->tail))
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    remove_at(list, list->current_size);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t isl_remove_position(indexable_skip_list_t *list, size_t position)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if list does not exist or is empty
+    if ((NULL == list) || (NULL == list->tail))
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check if position is out of range
+    if ((position > list->current_size) || (position == 0))
+    {
+        exit_code = E_OUT_OF_BOUNDS;
+        goto END;
+    }
+
+    remove_at(list, position);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t isl_print_list(indexable_skip_list_t *list, void (*function_ptr)(void *))
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check for NULL function pointer
+    if (NULL == function_ptr)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // 3. Print the list along the bottom level
+    for (isl_node_t *current_node = list->header->links[0].next; NULL != current_node;
+         current_node = current_node->links[0].next)
+    {
+        (*function_ptr)(current_node->data);
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+void isl_clear_list(indexable_skip_list_t **list)
+{
+    // 1. Check if list is empty
+    if ((NULL == list) || (NULL == *list))
+    {
+        goto END;
+    }
+
+    // 2. Free every node along the bottom level
+    isl_node_t *current_node = (*list)->header->links[0].next;
+    isl_node_t *next_node = NULL;
+
+    while (NULL != current_node)
+    {
+        next_node = current_node->links[0].next;
+        free(current_node);
+        current_node = next_node;
+    }
+
+    // 3. Unlink the header on every level
+    for (size_t level = 0; level < ISL_MAX_LEVEL; level++)
+    {
+        (*list)->header->links[level].next = NULL;
+        (*list)->header->links[level].width = 0;
+    }
+
+    (*list)->tail = NULL;
+    (*list)->current_size = 0;
+    (*list)->level = 1;
+
+END:
+    return;
+}
+
+void isl_destroy_list(indexable_skip_list_t **list)
+{
+    // 1. Check if list is empty
+    if ((NULL == list) || (NULL == *list))
+    {
+        goto END;
+    }
+
+    // 2. Clear out all the nodes
+    isl_clear_list(list);
+
+    // 3. Destroy the header and the list container
+    free((*list)->header);
+    free(*list);
+    *list = NULL;
+
+END:
+    return;
+}
+
+// HELPER FUNCTIONS
+
+isl_node_t *create_new_node(size_t levels, void *data)
+{
+    // 1. Allocate memory for the node and its tower of links
+    isl_node_t *new_node = calloc(1, sizeof(isl_node_t) + (levels * sizeof(isl_link_t)));
+    if (NULL == new_node)
+    {
+        goto END;
+    }
+
+    // 2. Initialize the node (calloc has already cleared every link)
+    new_node->data = data;
+    new_node->levels = levels;
+
+END:
+    return new_node;
+}
+
+size_t random_level(indexable_skip_list_t *list)
+{
+    // xorshift64: plenty for tower heights and keeps each list's sequence independent of rand()
+    uint64_t bits = list->random;
+    bits ^= bits << 13;
+    bits ^= bits >> 7;
+    bits ^= bits << 17;
+    list->random = bits;
+
+    size_t levels = 1;
+    while ((levels < ISL_MAX_LEVEL) && (0 == (bits & 3)))
+    {
+        levels++;
+        bits >>= 2;
+    }
+
+    return levels;
+}
+
+void find_predecessors(indexable_skip_list_t *list, size_t position, isl_node_t **update, size_t *ranks)
+{
+    isl_node_t *current_node = list->header;
+    size_t traversed = 0;
+
+    for (size_t level = list->level; level > 0; level--)
+    {
+        isl_link_t *link = &current_node->links[level - 1];
+
+        while ((NULL != link->next) && (traversed + link->width < position))
+        {
+            traversed += link->width;
+            current_node = link->next;
+            link = &current_node->links[level - 1];
+        }
+
+        update[level - 1] = current_node;
+        if (NULL != ranks)
+        {
+            ranks[level - 1] = traversed;
+        }
+    }
+}
+
+exit_code_t insert_at(indexable_skip_list_t *list, void *data, size_t position)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+    isl_node_t *update[ISL_MAX_LEVEL] = {NULL};
+    size_t ranks[ISL_MAX_LEVEL];
+
+    // 1. Create the node with a random tower
+    size_t levels = random_level(list);
+    isl_node_t *new_node = create_new_node(levels, data);
+    if (NULL == new_node)
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
+
+    // 2. Find the node before the position on each level, starting any new levels at the header
+    find_predecessors(list, position, update, ranks);
+
+    for (size_t level = list->level; level < levels; level++)
+    {
+        update[level] = list->header;
+        ranks[level] = 0;
+    }
+
+    if (levels > list->level)
+    {
+        list->level = levels;
+    }
+
+    // 3. Splice the node in on its own levels, splitting the span it lands in
+    for (size_t level = 0; level < levels; level++)
+    {
+        isl_link_t *link = &update[level]->links[level];
+        size_t distance = position - ranks[level]; // from the predecessor to the new node
+
+        new_node->links[level].next = link->next;
+        if (NULL != link->next)
+        {
+            new_node->links[level].width = link->width - distance + 1;
+        }
+
+        link->next = new_node;
+        link->width = distance;
+    }
+
+    // 4. Links passing over the node on higher levels now span one more position
+    for (size_t level = levels; level < list->level; level++)
+    {
+        if (NULL != update[level]->links[level].next)
+        {
+            update[level]->links[level].width += 1;
+        }
+    }
+
+    if (NULL == new_node->links[0].next)
+    {
+        list->tail = new_node;
+    }
+
+    list->current_size += 1;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+void *remove_at(indexable_skip_list_t *list, size_t position)
+{
+    isl_node_t *update[ISL_MAX_LEVEL] = {NULL};
+
+    // 1. Find the node before the position on each level
+    find_predecessors(list, position, update, NULL);
+    isl_node_t *target = update[0]->links[0].next;
+    void *data = target->data;
+
+    // 2. Unlink the node where it has a link, and shorten the links passing over it elsewhere
+    for (size_t level = 0; level < list->level; level++)
+    {
+        isl_link_t *link = &update[level]->links[level];
+
+        if (link->next == target)
+        {
+            link->next = target->links[level].next;
+            link->width = (NULL != link->next) ? link->width + target->links[level].width - 1 : 0;
+        }
+        else if (NULL != link->next)
+        {
+            link->width -= 1;
+        }
+    }
+
+    // 3. Drop levels left with nothing on them
+    while ((list->level > 1) && (NULL == list->header->links[list->level - 1].next))
+    {
+        list->level -= 1;
+    }
+
+    if (list->tail == target)
+    {
+        list->tail = (list->header != update[0]) ? update[0] : NULL;
+    }
+
+    free(target);
+    list->current_size -= 1;
+
+    return data;
+}
@@ -0,0 +1,523 @@
+#include "linked_lists/intrusive_list.h"
+
+// SINGLY LINKED
+
+void isll_init(isll_t *list)
+{
+    if (NULL == list)
+    {
+        goto END;
+    }
+
+    list->head = NULL;
+    list->tail = NULL;
+    list->current_size = 0;
+
+END:
+    return;
+}
+
+exit_code_t isll_push_head(isll_t *list, isll_link_t *link)
+{
+    return isll_insert_after(list, NULL, link);
+}
+
+exit_code_t isll_push_tail(isll_t *list, isll_link_t *link)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    exit_code = isll_insert_after(list, list->tail, link);
+
+END:
+    return exit_code;
+}
+
+exit_code_t isll_insert_after(isll_t *list, isll_link_t *previous, isll_link_t *link)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check if link exists
+    if (NULL == link)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // 3. Link the object in after previous, or at the head
+    if (NULL == previous)
+    {
+        link->next = list->head;
+        list->head = link;
+    }
+    else
+    {
+        link->next = previous->next;
+        previous->next = link;
+    }
+
+    if (NULL == link->next)
+    {
+        list->tail = link;
+    }
+
+    list->current_size += 1;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+isll_link_t *isll_peek_head(const isll_t *list)
+{
+    return (NULL != list) ? list->head : NULL;
+}
+
+isll_link_t *isll_peek_tail(const isll_t *list)
+{
+    return (NULL != list) ? list->tail : NULL;
+}
+
+isll_link_t *isll_pop_head(isll_t *list)
+{
+    return isll_remove_after(list, NULL);
+}
+
+isll_link_t *isll_remove_after(isll_t *list, isll_link_t *previous)
+{
+    isll_link_t *link = NULL;
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        goto END;
+    }
+
+    // 2. Find the link to remove and check there is one
+    link = (NULL == previous) ? list->head : previous->next;
+    if (NULL == link)
+    {
+        goto END;
+    }
+
+    // 3. Unlink it
+    if (NULL == previous)
+    {
+        list->head = link->next;
+    }
+    else
+    {
+        previous->next = link->next;
+    }
+
+    if (list->tail == link)
+    {
+        list->tail = previous;
+    }
+
+    link->next = NULL;
+    list->current_size -= 1;
+
+END:
+    return link;
+}
+
+// DOUBLY LINKED
+
+void idll_init(idll_t *list)
+{
+    if (NULL == list)
+    {
+        goto END;
+    }
+
+    list->head = NULL;
+    list->tail = NULL;
+    list->current_size = 0;
+
+END:
+    return;
+}
+
+exit_code_t idll_push_head(idll_t *list, idll_link_t *link)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check if link exists
+    if (NULL == link)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // 3. Link the object in at the front
+    link->prev = NULL;
+    link->next = list->head;
+
+    if (NULL == list->head)
+    {
+        list->tail = link;
+    }
+    else
+    {
+        list->head->prev = link;
+    }
+    list->head = link;
+
+    list->current_size += 1;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t idll_push_tail(idll_t *list, idll_link_t *link)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check if link exists
+    if (NULL == link)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // 3. Link the object in at the back
+    link->next = NULL;
+    link->prev = list->tail;
+
+    if (NULL == list->tail)
+    {
+        list->head = link;
+    }
+    else
+    {
+        list->tail->next = link;
+    }
+    list->tail = link;
+
+    list->current_size += 1;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t idll_insert_before(idll_t *list, idll_link_t *next, idll_link_t *link)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check if the links exist
+    if ((NULL == next) || (NULL == link))
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // 3. Link the object in between next and the link before it
+    link->next = next;
+    link->prev = next->prev;
+
+    if (NULL == next->prev)
+    {
+        list->head = link;
+    }
+    else
+    {
+        next->prev->next = link;
+    }
+    next->prev = link;
+
+    list->current_size += 1;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t idll_insert_after(idll_t *list, idll_link_t *previous, idll_link_t *link)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check if the links exist
+    if ((NULL == previous) || (NULL == link))
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // 3. Link the object in between previous and the link after it
+    link->prev = previous;
+    link->next = previous->next;
+
+    if (NULL == previous->next)
+    {
+        list->tail = link;
+    }
+    else
+    {
+        previous->next->prev = link;
+    }
+    previous->next = link;
+
+    list->current_size += 1;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+idll_link_t *idll_peek_head(const idll_t *list)
+{
+    return (NULL != list) ? list->head : NULL;
+}
+
+idll_link_t *idll_peek_tail(const idll_t *list)
+{
+    return (NULL != list) ? list->tail : NULL;
+}
+
+idll_link_t *idll_pop_head(idll_t *list)
+{
+    idll_link_t *link = idll_peek_head(list);
+
+    if (NULL != link)
+    {
+        idll_remove(list, link);
+    }
+
+    return link;
+}
+
+idll_link_t *idll_pop_tail(idll_t *list)
+{
+    idll_link_t *link = idll_peek_tail(list);
+
+    if (NULL != link)
+    {
+        idll_remove(list, link);
+    }
+
+    return link;
+}
+
+exit_code_t idll_remove(idll_t *list, idll_link_t *link)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check if link exists
+    if (NULL == link)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // 3. Join the neighbours to each other, or move the head or tail past the link
+    if (NULL == link->prev)
+    {
+        list->head = link->next;
+    }
+    else
+    {
+        link->prev->next = link->next;
+    }
+
+    if (NULL == link->next)
+    {
+        list->tail = link->prev;
+    }
+    else
+    {
+        link->next->prev = link->prev;
+    }
+
+    link->next = NULL;
+    link->prev = NULL;
+    list->current_size -= 1;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+// CIRCULAR SINGLY LINKED
+
+void icsll_init(icsll_t *list)
+{
+    if (NULL == list)
+    {
+        goto END;
+    }
+
+    list->tail = NULL;
+    list->current_size = 0;
+
+END:
+    return;
+}
+
+exit_code_t icsll_push_head(icsll_t *list, icsll_link_t *link)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check if link exists
+    if (NULL == link)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // 3. Link the object in between the tail and the head
+    if (NULL == list->tail)
+    {
+        link->next = link;
+        list->tail = link;
+    }
+    else
+    {
+        link->next = list->tail->next;
+        list->tail->next = link;
+    }
+
+    list->current_size += 1;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t icsll_push_tail(icsll_t *list, icsll_link_t *link)
+{
+    // Linked in between the tail and the head, the new link only needs to become the tail
+    exit_code_t exit_code = icsll_push_head(list, link);
+
+    if (E_SUCCESS == exit_code)
+    {
+        list->tail = link;
+    }
+
+    return exit_code;
+}
+
+icsll_link_t *icsll_peek_head(const icsll_t *list)
+{
+    return ((NULL != list) && (NULL != list->tail)) ? list->tail->next : NULL;
+}
+
+icsll_link_t *icsll_peek_tail(const icsll_t *list)
+{
+    return (NULL != list) ? list->tail : NULL;
+}
+
+icsll_link_t *icsll_pop_head(icsll_t *list)
+{
+    return icsll_remove_after(list, icsll_peek_tail(list));
+}
+
+icsll_link_t *icsll_remove_after(icsll_t *list, icsll_link_t *previous)
+{
+    icsll_link_t *link = NULL;
+
+    // 1. Check if list exists, is empty or previous is missing
+    if ((NULL == list) || (NULL == list->tail) || (NULL == previous))
+    {
+        goto END;
+    }
+
+    // 2. Unlink the link after previous, emptying the list if it was the only one
+    link = previous->next;
+
+    if (link == previous)
+    {
+        list->tail = NULL;
+    }
+    else
+    {
+        previous->next = link->next;
+
+        if (list->tail == link)
+        {
+            list->tail = previous;
+        }
+    }
+
+    link->next = NULL;
+    list->current_size -= 1;
+
+END:
+    return link;
+}
+
+exit_code_t icsll_rotate(icsll_t *list)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if list exists or is empty
+    if ((NULL == list) || (NULL == list->tail))
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. The head becomes the tail just by moving the tail on one
+    list->tail = list->tail->next;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
@@ -1,4 +1,7 @@
+#include <stddef.h>
+
 #include "linked_lists/singly_linked_list.h"
+#include "utilities/sort.h"
 
 struct sll_node
 {
@@ -11,6 +14,8 @@ struct singly_linked_list
     sll_node_t *head;
     sll_node_t *tail;
     size_t current_size;
+    node_pool_t *pool; // supplies every node of the list
+    bool owns_pool;    // true if the pool was created for this list alone
 };
 
 typedef struct results
@@ -20,28 +25,70 @@ typedef struct results
 } results_t;
 
 /// @brief Creates a new node
+/// @param list The list whose pool supplies the node.
 /// @param data The data to be added.
 /// @return new_sll_node_t
-static sll_node_t *create_new_node(void *data);
+static sll_node_t *create_new_node(singly_linked_list_t *list, void *data);
 
-static exit_code_t get_nodes_at_pos(results_t **results_p, singly_linked_list_t *list, size_t position);
+static exit_code_t get_nodes_at_pos(results_t *results, singly_linked_list_t *list, size_t position);
 
 singly_linked_list_t *sll_create(void)
 {
-    // 1. Create the list
-    singly_linked_list_t *list = calloc(1, sizeof(singly_linked_list_t));
+    singly_linked_list_t *list = NULL;
+
+    // 1. Create a pool for this list alone
+    node_pool_t *pool = node_pool_create(sizeof(sll_node_t), 0);
+    if (NULL == pool)
+    {
+        goto END;
+    }
+
+    // 2. Create the list around it
+    list = sll_create_with_pool(pool);
+    if (NULL == list)
+    {
+        node_pool_destroy(&pool);
+        goto END;
+    }
+
+    list->owns_pool = true;
+
+END:
+    return list;
+}
 
-    // 2. Check if memory allocation was successful
+singly_linked_list_t *sll_create_with_pool(node_pool_t *pool)
+{
+    singly_linked_list_t *list = NULL;
+
+    // 1. Check if pool exists and its nodes are big enough
+    if ((NULL == pool) || (node_pool_node_size(pool) < sizeof(sll_node_t)))
+    {
+        goto END;
+    }
+
+    // 2. Create the list
+    list = calloc(1, sizeof(singly_linked_list_t));
+
+    // 3. Check if memory allocation was successful
     if (NULL != list)
     {
         list->current_size = 0;
         list->head = NULL;
         list->tail = NULL;
+        list->pool = pool;
+        list->owns_pool = false;
     }
 
+END:
     return list;
 }
 
+size_t sll_node_size(void)
+{
+    return sizeof(sll_node_t);
+}
+
 exit_code_t sll_push_head(singly_linked_list_t *list, void *data)
 {
     exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
@@ -60,7 +107,12 @@ exit_code_t sll_push_head(singly_linked_list_t *list, void *data)
         goto END;
     }
 
-    sll_node_t *new_node = create_new_node(data); // Create a new node
+    sll_node_t *new_node = create_new_node(list, data); // Create a new node
+    if (NULL == new_node)
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
 
     // 3. Determine links based on whether or not list is empty
     if (NULL == list->head)
@@ -102,7 +154,12 @@ exit_code_t sll_push_tail(singly_linked_list_t *list, void *data)
         goto END;
     }
 
-    sll_node_t *new_node = create_new_node(data); // Create a new node
+    sll_node_t *new_node = create_new_node(list, data); // Create a new node
+    if (NULL == new_node)
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
 
     // 3. Determine links based on whether or not list is empty
     if (NULL == list->head)
@@ -151,7 +208,12 @@ exit_code_t sll_push_position(singly_linked_list_t *list, void *data, size_t pos
         goto END;
     }
 
-    sll_node_t *new_node = create_new_node(data); // Create a new node
+    sll_node_t *new_node = create_new_node(list, data); // Create a new node
+    if (NULL == new_node)
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
 
     // 4. Determine links based on whether or not list is empty
     if (NULL == list->head)
@@ -163,22 +225,17 @@ exit_code_t sll_push_position(singly_linked_list_t *list, void *data, size_t pos
     else
     {
         // Retrieve the node at the current position, as well as the previous adjacent node
-        results_t *results = NULL;
+        results_t results = {NULL, NULL};
         exit_code = get_nodes_at_pos(&results, list, position);
         if (E_SUCCESS != exit_code)
         {
-            free(results);
-            results = NULL;
             goto END;
         }
 
-        new_node->next = results->current_node;
-        results->previous_node->next = new_node;
-
-        results->current_node = new_node;
+        new_node->next = results.current_node;
+        results.previous_node->next = new_node;
 
-        free(results);
-        results = NULL;
+        results.current_node = new_node;
     }
 
     // 4. Increment the size of the list
@@ -238,19 +295,14 @@ void *sll_peek_position(singly_linked_list_t *list, size_t position)
     }
 
     // Retrieve the node at the current position
-    results_t *results = NULL;
+    results_t results = {NULL, NULL};
     exit_code_t exit_code = get_nodes_at_pos(&results, list, position);
     if (E_SUCCESS != exit_code)
     {
-        free(results);
-        results = NULL;
         goto END;
     }
 
-    data = results->current_node->data;
-
-    free(results);
-    results = NULL;
+    data = results.current_node->data;
 
 END:
     return data;
@@ -307,20 +359,16 @@ void *sll_pop_position(singly_linked_list_t *list, size_t position)
     }
 
     // Retrieve the node at the current position
-    results_t *results = NULL;
+    results_t results = {NULL, NULL};
     exit_code_t exit_code = get_nodes_at_pos(&results, list, position);
     if (E_SUCCESS != exit_code)
     {
-        free(results);
-        results = NULL;
         goto END;
     }
 
 
-    data = results->current_node->data;
+    data = results.current_node->data;
 
-    free(results);
-    results = NULL;
 
     sll_remove_position(list, position);
 
@@ -342,14 +390,14 @@ exit_code_t sll_remove_head(singly_linked_list_t *list)
     // 3. Check if there is only one node in the list
     if (NULL == list->head->next)
     {
-        free(list->head);
+        node_pool_free(list->pool, list->head);
         list->head = NULL;
     }
     else
     {
         sll_node_t *temp = list->head->next;
 
-        free(list->head);
+        node_pool_free(list->pool, list->head);
         list->head = NULL;
 
         list->head = temp;
@@ -376,26 +424,23 @@ exit_code_t sll_remove_tail(singly_linked_list_t *list)
     // 3. Check if there is only one node in the list
     if (NULL == list->head->next)
     {
-        free(list->tail);
+        node_pool_free(list->pool, list->tail);
         list->tail = NULL;
     }
     else
     {
-        results_t *results = NULL;
+        results_t results = {NULL, NULL};
         exit_code = get_nodes_at_pos(&results, list, list->current_size);
         if (E_SUCCESS != exit_code)
         {
-            free(results);
-            results = NULL;
             goto END;
         }
 
-        list->tail = results->previous_node;
+        list->tail = results.previous_node;
 
-        free(results);
     }
 
-    free(list->tail->next);
+    node_pool_free(list->pool, list->tail->next);
     list->tail->next = NULL;
 
     list->current_size -= 1;
@@ -438,22 +483,18 @@ exit_code_t sll_remove_position(singly_linked_list_t *list, size_t position)
     }
 
     // Retrieve the node at the current position, as well as the previous adjacent node
-    results_t *results = NULL;
+    results_t results = {NULL, NULL};
     exit_code = get_nodes_at_pos(&results, list, position);
     if (E_SUCCESS != exit_code)
     {
-        free(results);
-        results = NULL;
         goto END;
     }
 
-    results->previous_node->next = results->current_node->next;
+    results.previous_node->next = results.current_node->next;
 
-    free(results->current_node);
-    results->current_node = NULL;
+    node_pool_free(list->pool, results.current_node);
+    results.current_node = NULL;
 
-    free(results);
-    results = NULL;
     
     // 4. Increment the size of the list
     list->current_size -= 1;
@@ -507,15 +548,22 @@ void sll_clear_list(singly_linked_list_t **list)
         goto END;
     }
 
-    sll_node_t *current_node = (*list)->head;
-    sll_node_t *next_node = NULL;
-
-    // 2. Clear out all the nodes in the list
-    while (NULL != current_node)
+    // 2. Clear out all the nodes in the list, all at once if no other list shares the pool
+    if (true == (*list)->owns_pool)
     {
-        next_node = current_node->next;
-        free(current_node);
-        current_node = next_node;
+        node_pool_reset((*list)->pool);
+    }
+    else
+    {
+        sll_node_t *current_node = (*list)->head;
+        sll_node_t *next_node = NULL;
+
+        while (NULL != current_node)
+        {
+            next_node = current_node->next;
+            node_pool_free((*list)->pool, current_node);
+            current_node = next_node;
+        }
     }
 
     (*list)->head = NULL;
@@ -537,7 +585,13 @@ void sll_destroy_list(singly_linked_list_t **list)
     // 2. Clear out all the nodes
     sll_clear_list(list);
 
-    // 3. Destroy the list container
+    // 3. Destroy the pool if no other list uses it
+    if (true == (*list)->owns_pool)
+    {
+        node_pool_destroy(&(*list)->pool);
+    }
+
+    // 4. Destroy the list container
     free(*list);
     *list = NULL;
 
@@ -545,10 +599,253 @@ END:
     return;
 }
 
-sll_node_t *create_new_node(void *data)
+exit_code_t sll_cursor_head(singly_linked_list_t *list, sll_cursor_t *cursor)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check if cursor exists
+    if (NULL == cursor)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    cursor->list = list;
+    cursor->previous = NULL;
+    cursor->current = list->head;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t sll_cursor_next(sll_cursor_t *cursor)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if cursor exists
+    if ((NULL == cursor) || (NULL == cursor->list))
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // 2. Check if cursor is past the end
+    if (NULL == cursor->current)
+    {
+        exit_code = E_OUT_OF_BOUNDS;
+        goto END;
+    }
+
+    cursor->previous = cursor->current;
+    cursor->current = cursor->current->next;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+void *sll_cursor_get(const sll_cursor_t *cursor)
+{
+    void *data = NULL;
+
+    // Check if cursor exists or is past the end
+    if ((NULL == cursor) || (NULL == cursor->current))
+    {
+        goto END;
+    }
+
+    data = cursor->current->data;
+
+END:
+    return data;
+}
+
+exit_code_t sll_cursor_insert_before(sll_cursor_t *cursor, void *data)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if cursor and data exist
+    if ((NULL == cursor) || (NULL == cursor->list) || (NULL == data))
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    singly_linked_list_t *list = cursor->list;
+
+    sll_node_t *new_node = create_new_node(list, data); // Create a new node
+    if (NULL == new_node)
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
+
+    // 2. Link the node in between the previous node (or the head) and the cursor
+    new_node->next = cursor->current;
+    if (NULL == cursor->previous)
+    {
+        list->head = new_node;
+    }
+    else
+    {
+        cursor->previous->next = new_node;
+    }
+
+    // 3. Past the end, the new node is the new tail
+    if (NULL == cursor->current)
+    {
+        list->tail = new_node;
+    }
+
+    cursor->previous = new_node;
+
+    // 4. Increment the size of the list
+    list->current_size += 1;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t sll_cursor_insert_after(sll_cursor_t *cursor, void *data)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if cursor and data exist
+    if ((NULL == cursor) || (NULL == cursor->list) || (NULL == data))
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // 2. Check if cursor is past the end
+    if (NULL == cursor->current)
+    {
+        exit_code = E_OUT_OF_BOUNDS;
+        goto END;
+    }
+
+    singly_linked_list_t *list = cursor->list;
+
+    sll_node_t *new_node = create_new_node(list, data); // Create a new node
+    if (NULL == new_node)
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
+
+    // 3. Link the node in after the cursor
+    new_node->next = cursor->current->next;
+    cursor->current->next = new_node;
+
+    if (cursor->current == list->tail)
+    {
+        list->tail = new_node;
+    }
+
+    // 4. Increment the size of the list
+    list->current_size += 1;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t sll_cursor_erase(sll_cursor_t *cursor)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if cursor exists
+    if ((NULL == cursor) || (NULL == cursor->list))
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // 2. Check if cursor is past the end
+    if (NULL == cursor->current)
+    {
+        exit_code = E_OUT_OF_BOUNDS;
+        goto END;
+    }
+
+    singly_linked_list_t *list = cursor->list;
+    sll_node_t *next_node = cursor->current->next;
+
+    // 3. Unlink the node from the previous node (or the head)
+    if (NULL == cursor->previous)
+    {
+        list->head = next_node;
+    }
+    else
+    {
+        cursor->previous->next = next_node;
+    }
+
+    if (cursor->current == list->tail)
+    {
+        list->tail = cursor->previous;
+    }
+
+    node_pool_free(list->pool, cursor->current);
+    cursor->current = next_node;
+
+    // 4. Decrement the size of the list
+    list->current_size -= 1;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t sll_sort(singly_linked_list_t *list, const compare_ctx *compare)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check if comparator exists
+    if ((NULL == compare) || (NULL == compare->compare))
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // Lists of fewer than two nodes are already sorted
+    if (list->current_size < 2)
+    {
+        exit_code = E_SUCCESS;
+        goto END;
+    }
+
+    // 3. Relink the nodes in order
+    void *tail = NULL;
+    list->head = linked_merge_sort(list->head, offsetof(sll_node_t, next), offsetof(sll_node_t, data), compare,
+                                   &tail);
+    list->tail = tail;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+sll_node_t *create_new_node(singly_linked_list_t *list, void *data)
 {
     // 1. Allocate memory for new node
-    sll_node_t *new_node = calloc(1, sizeof(sll_node_t));
+    sll_node_t *new_node = node_pool_alloc(list->pool);
     if (NULL == new_node)
     {
         goto END;
@@ -562,17 +859,10 @@ END:
     return new_node;
 }
 
-exit_code_t get_nodes_at_pos(results_t **results_p, singly_linked_list_t *list, size_t position)
+exit_code_t get_nodes_at_pos(results_t *results, singly_linked_list_t *list, size_t position)
 {
     exit_code_t exit_code = E_DEFAULT_ERROR;
 
-    results_t *results = calloc(1, sizeof(results_t));
-    if (NULL == results)
-    {
-        exit_code = E_NULL_POINTER;
-        goto END;
-    }
-
 	results->previous_node = NULL;
 	results->current_node = NULL;
 
@@ -597,7 +887,6 @@ exit_code_t get_nodes_at_pos(results_t **results_p, singly_linked_list_t *list,
         results->current_node = results->current_node->next;
     }
 
-    *results_p = results;
     exit_code = E_SUCCESS;
 END:
     return exit_code;
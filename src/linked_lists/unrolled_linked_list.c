@@ -0,0 +1,687 @@
+#include <string.h>
+
+#include "linked_lists/unrolled_linked_list.h"
+
+struct ull_node
+{
+    ull_node_t *next;
+    size_t count;                  // elements in use, always packed at the front of data
+    void *data[ULL_NODE_CAPACITY];
+};
+
+struct unrolled_linked_list
+{
+    ull_node_t *head;
+    ull_node_t *tail;
+    size_t current_size; // elements, not nodes
+    size_t node_count;
+    node_pool_t *pool;   // supplies every node of the list
+    bool owns_pool;      // true if the pool was created for this list alone
+};
+
+typedef struct results
+{
+    ull_node_t *previous_node;
+    ull_node_t *current_node;
+    size_t offset; // index of the element within current_node
+} results_t;
+
+/// @brief Creates a new, empty node
+/// @param list The list whose pool supplies the node.
+/// @return new_ull_node_t
+static ull_node_t *create_new_node(unrolled_linked_list_t *list);
+
+static exit_code_t get_nodes_at_pos(results_t *results, unrolled_linked_list_t *list, size_t position);
+
+/// @brief Stores an element at results->offset, splitting the node first if it is full.
+/// @param list The list to insert into.
+/// @param results The node and offset to insert at. The offset may equal the node's count to append to it.
+/// @param data The data to be added.
+/// @return exit_code_t (E_SUCCESS for success, anything else is considered a failure).
+static exit_code_t insert_at(unrolled_linked_list_t *list, const results_t *results, void *data);
+
+/// @brief Takes the element at results->offset out of its node, then frees the node if it is empty or
+///        merges it with a neighbour if both now fit in one node.
+/// @param list The list to remove from.
+/// @param results The node, the node before it and the offset to remove at.
+/// @return The removed value.
+static void *remove_at(unrolled_linked_list_t *list, const results_t *results);
+
+unrolled_linked_list_t *ull_create(void)
+{
+    unrolled_linked_list_t *list = NULL;
+
+    // 1. Create a pool for this list alone
+    node_pool_t *pool = node_pool_create(sizeof(ull_node_t), 0);
+    if (NULL == pool)
+    {
+        goto END;
+    }
+
+    // 2. Create the list around it
+    list = ull_create_with_pool(pool);
+    if (NULL == list)
+    {
+        node_pool_destroy(&pool);
+        goto END;
+    }
+
+    list->owns_pool = true;
+
+END:
+    return list;
+}
+
+unrolled_linked_list_t *ull_create_with_pool(node_pool_t *pool)
+{
+    unrolled_linked_list_t *list = NULL;
+
+    // 1. Check if pool exists and its nodes are big enough
+    if ((NULL == pool) || (node_pool_node_size(pool) < sizeof(ull_node_t)))
+    {
+        goto END;
+    }
+
+    // 2. Create the list
+    list = calloc(1, sizeof(unrolled_linked_list_t));
+
+    // 3. Check if memory allocation was successful
+    if (NULL != list)
+    {
+        list->current_size = 0;
+        list->node_count = 0;
+        list->head = NULL;
+        list->tail = NULL;
+        list->pool = pool;
+        list->owns_pool = false;
+    }
+
+END:
+    return list;
+}
+
+size_t ull_node_size(void)
+{
+    return sizeof(ull_node_t);
+}
+
+size_t ull_size(const unrolled_linked_list_t *list)
+{
+    return (NULL != list) ? list->current_size : 0;
+}
+
+size_t ull_node_count(const unrolled_linked_list_t *list)
+{
+    return (NULL != list) ? list->node_count : 0;
+}
+
+exit_code_t ull_push_head(unrolled_linked_list_t *list, void *data)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check if data exists
+    if (NULL == data)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // 3. Start a new head node if the list is empty or the head is full, rather than splitting it
+    if ((NULL == list->head) || (ULL_NODE_CAPACITY == list->head->count))
+    {
+        ull_node_t *new_node = create_new_node(list); // Create a new node
+        if (NULL == new_node)
+        {
+            exit_code = E_CMR_FAILURE;
+            goto END;
+        }
+
+        new_node->next = list->head;
+        list->head = new_node;
+        if (NULL == list->tail)
+        {
+            list->tail = new_node;
+        }
+    }
+
+    // 4. Insert the element at the front of the head node
+    results_t results = {NULL, list->head, 0};
+    exit_code = insert_at(list, &results, data);
+
+END:
+    return exit_code;
+}
+
+exit_code_t ull_push_tail(unrolled_linked_list_t *list, void *data)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check if data exists
+    if (NULL == data)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // 3. Start a new tail node if the list is empty or the tail is full, so queues fill every node
+    if ((NULL == list->tail) || (ULL_NODE_CAPACITY == list->tail->count))
+    {
+        ull_node_t *new_node = create_new_node(list); // Create a new node
+        if (NULL == new_node)
+        {
+            exit_code = E_CMR_FAILURE;
+            goto END;
+        }
+
+        if (NULL == list->tail)
+        {
+            list->head = new_node;
+        }
+        else
+        {
+            list->tail->next = new_node;
+        }
+        list->tail = new_node;
+    }
+
+    // 4. Append the element to the tail node
+    results_t results = {NULL, list->tail, list->tail->count};
+    exit_code = insert_at(list, &results, data);
+
+END:
+    return exit_code;
+}
+
+exit_code_t ull_push_position(unrolled_linked_list_t *list, void *data, size_t position)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check if data exists
+    if (NULL == data)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // 3. Check if position is out of range
+    if ((position > list->current_size) || (position == 0))
+    {
+        exit_code = E_OUT_OF_BOUNDS;
+        goto END;
+    }
+
+    // 4. Retrieve the node holding the position and insert in front of the element there
+    results_t results = {NULL, NULL, 0};
+    exit_code = get_nodes_at_pos(&results, list, position);
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
+
+    exit_code = insert_at(list, &results, data);
+
+END:
+    return exit_code;
+}
+
+void *ull_peek_head(unrolled_linked_list_t *list)
+{
+    void *data = NULL;
+
+    // Check if list exists or is empty
+    if ((NULL == list) || (NULL == list->head))
+    {
+        goto END;
+    }
+
+    data = list->head->data[0];
+
+END:
+    return data;
+}
+
+void *ull_peek_tail(unrolled_linked_list_t *list)
+{
+    void *data = NULL;
+
+    // Check if list exists or is empty
+    if ((NULL == list) || (NULL == list->head))
+    {
+        goto END;
+    }
+
+    data = list->tail->data[list->tail->count - 1];
+
+END:
+    return data;
+}
+
+void *ull_peek_position(unrolled_linked_list_t *list, size_t position)
+{
+    void *data = NULL;
+
+    // Retrieve the node holding the position (this also checks the list and the range)
+    results_t results = {NULL, NULL, 0};
+    if (E_SUCCESS != get_nodes_at_pos(&results, list, position))
+    {
+        goto END;
+    }
+
+    data = results.current_node->data[results.offset];
+
+END:
+    return data;
+}
+
+void *ull_pop_head(unrolled_linked_list_t *list)
+{
+    void *data = NULL;
+
+    // Check if list exists or is empty
+    if ((NULL == list) || (NULL == list->head))
+    {
+        goto END;
+    }
+
+    results_t results = {NULL, list->head, 0};
+    data = remove_at(list, &results);
+
+END:
+    return data;
+}
+
+void *ull_pop_tail(unrolled_linked_list_t *list)
+{
+    void *data = NULL;
+
+    // Check if list exists or is empty
+    if ((NULL == list) || (NULL == list->head))
+    {
+        goto END;
+    }
+
+    data = list->tail->data[list->tail->count - 1];
+    ull_remove_tail(list);
+
+END:
+    return data;
+}
+
+void *ull_pop_position(unrolled_linked_list_t *list, size_t position)
+{
+    void *data = NULL;
+
+    // Retrieve the node holding the position (this also checks the list and the range)
+    results_t results = {NULL, NULL, 0};
+    if (E_SUCCESS != get_nodes_at_pos(&results, list, position))
+    {
+        goto END;
+    }
+
+    data = remove_at(list, &results);
+
+END:
+    return data;
+}
+
+exit_code_t ull_remove_head(unrolled_linked_list_t *list)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // set the fail state
+
+    // 1. Check if list does not exist or is empty
+    if ((NULL == list) || (NULL == list->head))
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    results_t results = {NULL, list->head, 0};
+    remove_at(list, &results);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t ull_remove_tail(unrolled_linked_list_t *list)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // set the fail state
+
+    // 1. Check if list does not exist or is empty
+    if ((NULL == list) || (NULL == list->tail))
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    exit_code = ull_remove_position(list, list->current_size);
+
+END:
+    return exit_code;
+}
+
+exit_code_t ull_remove_position(unrolled_linked_list_t *list, size_t position)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR; // Set the fail state
+
+    // 1. Check if list does not exist or is empty
+    if ((NULL == list) || (NULL == list->head))
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check if position is out of range
+    if (position > list->current_size || position == 0)
+    {
+        exit_code = E_OUT_OF_BOUNDS;
+        goto END;
+    }
+
+    // 3. The last element of a tail holding others can go without looking for the node before the tail
+    if ((position == list->current_size) && (list->tail->count > 1))
+    {
+        list->tail->count -= 1;
+        list->current_size -= 1;
+        exit_code = E_SUCCESS;
+        goto END;
+    }
+
+    // 4. Retrieve the node holding the position, as well as the previous adjacent node
+    results_t results = {NULL, NULL, 0};
+    exit_code = get_nodes_at_pos(&results, list, position);
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
+
+    remove_at(list, &results);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t ull_print_list(unrolled_linked_list_t *list, void (*function_ptr)(void *))
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    // 1. Check if list exists
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // 2. Check for NULL function pointer
+    if (NULL == function_ptr)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // 3. Print the list, a node's worth of elements at a time
+    for (ull_node_t *current_node = list->head; NULL != current_node; current_node = current_node->next)
+    {
+        for (size_t idx = 0; idx < current_node->count; idx++)
+        {
+            (*function_ptr)(current_node->data[idx]);
+        }
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+void ull_clear_list(unrolled_linked_list_t **list)
+{
+    // 1. Check if list is empty
+    if ((NULL == list) || (NULL == *list))
+    {
+        goto END;
+    }
+
+    // 2. Clear out all the nodes in the list, all at once if no other list shares the pool
+    if (true == (*list)->owns_pool)
+    {
+        node_pool_reset((*list)->pool);
+    }
+    else
+    {
+        ull_node_t *current_node = (*list)->head;
+        ull_node_t *next_node = NULL;
+
+        while (NULL != current_node)
+        {
+            next_node = current_node->next;
+            node_pool_free((*list)->pool, current_node);
+            current_node = next_node;
+        }
+    }
+
+    (*list)->head = NULL;
+    (*list)->tail = NULL;
+    (*list)->current_size = 0;
+    (*list)->node_count = 0;
+
+END:
+    return;
+}
+
+void ull_destroy_list(unrolled_linked_list_t **list)
+{
+    // 1. Check if list is empty
+    if ((NULL == list) || (NULL == *list))
+    {
+        goto END;
+    }
+
+    // 2. Clear out all the nodes
+    ull_clear_list(list);
+
+    // 3. Destroy the pool if no other list uses it
+    if (true == (*list)->owns_pool)
+    {
+        node_pool_destroy(&(*list)->pool);
+    }
+
+    // 4. Destroy the list container
+    free(*list);
+    *list = NULL;
+
+END:
+    return;
+}
+
+// HELPER FUNCTIONS
+
+ull_node_t *create_new_node(unrolled_linked_list_t *list)
+{
+    // 1. Allocate memory for new node (the pool hands it out zeroed, so it starts empty)
+    ull_node_t *new_node = node_pool_alloc(list->pool);
+    if (NULL == new_node)
+    {
+        goto END;
+    }
+
+    list->node_count += 1;
+
+END:
+    return new_node;
+}
+
+exit_code_t get_nodes_at_pos(results_t *results, unrolled_linked_list_t *list, size_t position)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    results->previous_node = NULL;
+    results->current_node = NULL;
+    results->offset = 0;
+
+    if ((NULL == list) || (NULL == list->head))
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    if ((position > list->current_size) || (position == 0))
+    {
+        exit_code = E_OUT_OF_BOUNDS;
+        goto END;
+    }
+
+    // Start searching from the head, skipping a whole node at a time
+    size_t remaining = position - 1;
+    results->current_node = list->head;
+
+    while (remaining >= results->current_node->count)
+    {
+        remaining -= results->current_node->count;
+        results->previous_node = results->current_node;
+        results->current_node = results->current_node->next;
+    }
+
+    results->offset = remaining;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t insert_at(unrolled_linked_list_t *list, const results_t *results, void *data)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+    ull_node_t *node = results->current_node;
+    size_t offset = results->offset;
+
+    // 1. Split a full node, moving its upper half into a new node after it
+    if (ULL_NODE_CAPACITY == node->count)
+    {
+        ull_node_t *new_node = create_new_node(list);
+        if (NULL == new_node)
+        {
+            exit_code = E_CMR_FAILURE;
+            goto END;
+        }
+
+        size_t keep = node->count / 2;
+        new_node->count = node->count - keep;
+        memcpy(new_node->data, &node->data[keep], new_node->count * sizeof(void *));
+        node->count = keep;
+
+        new_node->next = node->next;
+        node->next = new_node;
+        if (list->tail == node)
+        {
+            list->tail = new_node;
+        }
+
+        if (offset > keep)
+        {
+            node = new_node;
+            offset -= keep;
+        }
+    }
+
+    // 2. Shift the later elements up one and store the new one
+    memmove(&node->data[offset + 1], &node->data[offset], (node->count - offset) * sizeof(void *));
+    node->data[offset] = data;
+    node->count += 1;
+
+    list->current_size += 1;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+void *remove_at(unrolled_linked_list_t *list, const results_t *results)
+{
+    ull_node_t *node = results->current_node;
+    size_t offset = results->offset;
+    void *data = node->data[offset];
+
+    // 1. Close the gap left by the element
+    memmove(&node->data[offset], &node->data[offset + 1], (node->count - offset - 1) * sizeof(void *));
+    node->count -= 1;
+    list->current_size -= 1;
+
+    ull_node_t *next_node = node->next;
+
+    if (0 == node->count)
+    {
+        // 2a. Unlink an empty node
+        if (NULL == results->previous_node)
+        {
+            list->head = next_node;
+        }
+        else
+        {
+            results->previous_node->next = next_node;
+        }
+
+        if (list->tail == node)
+        {
+            list->tail = results->previous_node;
+        }
+
+        node_pool_free(list->pool, node);
+        list->node_count -= 1;
+    }
+    else if ((NULL != results->previous_node) &&
+             (results->previous_node->count + node->count <= ULL_NODE_CAPACITY))
+    {
+        // 2b. Merge this node into the previous one so nodes stay at least half full on average
+        ull_node_t *previous_node = results->previous_node;
+        memcpy(&previous_node->data[previous_node->count], node->data, node->count * sizeof(void *));
+        previous_node->count += node->count;
+        previous_node->next = next_node;
+
+        if (list->tail == node)
+        {
+            list->tail = previous_node;
+        }
+
+        node_pool_free(list->pool, node);
+        list->node_count -= 1;
+    }
+    else if ((NULL != next_node) && (node->count + next_node->count <= ULL_NODE_CAPACITY))
+    {
+        // 2c. Otherwise merge the next node into this one if it fits
+        memcpy(&node->data[node->count], next_node->data, next_node->count * sizeof(void *));
+        node->count += next_node->count;
+        node->next = next_node->next;
+
+        if (list->tail == next_node)
+        {
+            list->tail = node;
+        }
+
+        node_pool_free(list->pool, next_node);
+        list->node_count -= 1;
+    }
+
+    return data;
+}
@@ -0,0 +1,310 @@
+#include "segmented_array_list.h"
+#include "utilities/segment_index.h"
+
+struct segmented_array_list
+{
+    void *segments[SEGMENT_COUNT]; // segment k holds segment_length(k) slots, allocated on demand
+    size_t current_size;
+    size_t num_segments;           // number of allocated segments
+    const destroy_ctx *destroy;
+    const equal_ctx *equal;
+    size_t element_size;           // bytes per slot (sizeof(void *) for pointer lists)
+    bool is_typed;                 // true if elements are stored by value
+};
+
+static segmented_array_list_t *create_list(size_t element_size, bool is_typed, const destroy_ctx *destroy, const equal_ctx *equal);
+static void *slot_at(segmented_array_list_t *list, size_t index);
+static void *element_at(segmented_array_list_t *list, size_t index);
+static void store_element(segmented_array_list_t *list, size_t index, void *data);
+static void destroy_element(segmented_array_list_t *list, size_t index);
+
+segmented_array_list_t *segmented_list_create(const destroy_ctx *destroy, const equal_ctx *equal)
+{
+    return create_list(sizeof(void *), false, destroy, equal);
+}
+
+segmented_array_list_t *segmented_list_create_typed(size_t element_size, const destroy_ctx *destroy, const equal_ctx *equal)
+{
+    segmented_array_list_t *list = NULL;
+
+    if (0 == element_size)
+    {
+        goto END;
+    }
+
+    list = create_list(element_size, true, destroy, equal);
+
+END:
+    return list;
+}
+
+exit_code_t segmented_list_push(segmented_array_list_t *list, void *data)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    if (NULL == data)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    size_t segment = 0;
+    size_t offset = 0;
+    segment_locate(list->current_size, &segment, &offset);
+
+    // Add a new segment when the last one is full; existing segments are never touched
+    if (segment == list->num_segments)
+    {
+        if ((segment >= SEGMENT_COUNT) || (segment_length(segment) > SIZE_MAX / list->element_size))
+        {
+            exit_code = E_CMR_FAILURE;
+            goto END;
+        }
+
+        list->segments[segment] = malloc(segment_length(segment) * list->element_size);
+        if (NULL == list->segments[segment])
+        {
+            exit_code = E_CMR_FAILURE;
+            goto END;
+        }
+
+        list->num_segments++;
+    }
+
+    store_element(list, list->current_size, data);
+    list->current_size++;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+exit_code_t segmented_list_pop(segmented_array_list_t *list)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if ((NULL == list) || (0 == list->current_size))
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    // Segments are kept for reuse so addresses handed out earlier stay valid
+    destroy_element(list, list->current_size - 1);
+    list->current_size--;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+void *segmented_list_get(segmented_array_list_t *list, size_t index)
+{
+    void *element = NULL;
+
+    if ((NULL == list) || (index >= list->current_size))
+    {
+        goto END;
+    }
+
+    element = element_at(list, index);
+
+END:
+    return element;
+}
+
+exit_code_t segmented_list_set(segmented_array_list_t *list, size_t index, void *data)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if (NULL == list)
+    {
+        exit_code = E_LIST_ERROR;
+        goto END;
+    }
+
+    if (index >= list->current_size)
+    {
+        exit_code = E_OUT_OF_BOUNDS;
+        goto END;
+    }
+
+    if (NULL == data)
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // destroy the data if necessary
+    destroy_element(list, index);
+
+    store_element(list, index, data);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+bool segmented_list_contains(segmented_array_list_t *list, void *data)
+{
+    bool contains_data = false;
+
+    if ((NULL == list) || (NULL == data) || (NULL == list->equal))
+    {
+        goto END;
+    }
+
+    // Scan one contiguous segment at a time
+    size_t index = 0;
+    for (size_t segment = 0; (segment < list->num_segments) && (index < list->current_size); segment++)
+    {
+        size_t length = segment_length(segment);
+        for (size_t offset = 0; (offset < length) && (index < list->current_size); offset++, index++)
+        {
+            unsigned char *slot = (unsigned char *)list->segments[segment] + (offset * list->element_size);
+            void *element = list->is_typed ? (void *)slot : *(void **)slot;
+
+            if (true == list->equal->equal(element, data, list->equal->ctx))
+            {
+                contains_data = true;
+                goto END;
+            }
+        }
+    }
+
+END:
+    return contains_data;
+}
+
+size_t segmented_list_size(segmented_array_list_t *list)
+{
+    size_t size = 0;
+
+    if (NULL == list)
+    {
+        goto END;
+    }
+
+    size = list->current_size;
+
+END:
+    return size;
+}
+
+bool segmented_list_is_empty(segmented_array_list_t *list)
+{
+    bool is_empty = false;
+
+    if (NULL == list)
+    {
+        goto END;
+    }
+
+    is_empty = (0 == list->current_size);
+
+END:
+    return is_empty;
+}
+
+void segmented_list_destroy(segmented_array_list_t **list)
+{
+    if ((NULL == list) || (NULL == *list))
+    {
+        goto END;
+    }
+
+    // destroy the data if necessary
+    for (size_t index = 0; index < (*list)->current_size; index++)
+    {
+        destroy_element(*list, index);
+    }
+
+    for (size_t segment = 0; segment < (*list)->num_segments; segment++)
+    {
+        free((*list)->segments[segment]);
+        (*list)->segments[segment] = NULL;
+    }
+
+    free(*list);
+    *list = NULL;
+
+END:
+    return;
+}
+
+segmented_array_list_t *create_list(size_t element_size, bool is_typed, const destroy_ctx *destroy, const equal_ctx *equal)
+{
+    // The segment directory is part of the list, so no segment is allocated until the first push
+    segmented_array_list_t *list = calloc(1, sizeof(segmented_array_list_t));
+    if (NULL == list)
+    {
+        goto END;
+    }
+
+    list->current_size = 0;
+    list->num_segments = 0;
+    list->destroy = destroy;
+    list->equal = equal;
+    list->element_size = element_size;
+    list->is_typed = is_typed;
+
+END:
+    return list;
+}
+
+void *slot_at(segmented_array_list_t *list, size_t index)
+{
+    size_t segment = 0;
+    size_t offset = 0;
+    segment_locate(index, &segment, &offset);
+
+    return (unsigned char *)list->segments[segment] + (offset * list->element_size);
+}
+
+void *element_at(segmented_array_list_t *list, size_t index)
+{
+    // Typed lists hand out the address of the slot, pointer lists the stored pointer
+    return list->is_typed ? slot_at(list, index) : *(void **)slot_at(list, index);
+}
+
+void store_element(segmented_array_list_t *list, size_t index, void *data)
+{
+    if (list->is_typed)
+    {
+        memcpy(slot_at(list, index), data, list->element_size);
+    }
+    else
+    {
+        *(void **)slot_at(list, index) = data;
+    }
+}
+
+void destroy_element(segmented_array_list_t *list, size_t index)
+{
+    const destroy_ctx *destroy = list->destroy;
+
+    if (NULL == destroy)
+    {
+        goto END;
+    }
+
+    if (NULL != destroy->destroy)
+    {
+        destroy->destroy(element_at(list, index), destroy->context);
+    }
+    else if (NULL != destroy->destroy_many)
+    {
+        // A batch of one, holding the same pointer destroy would have been given
+        void *item = element_at(list, index);
+        destroy->destroy_many(&item, 1, destroy->context);
+    }
+
+END:
+    return;
+}
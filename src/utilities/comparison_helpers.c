@@ -22,7 +22,8 @@ int raw_size_t_comp(const void *x_raw, const void *y_raw, const void *ctx)
     size_t x = (size_t) (uintptr_t) x_raw;
 	size_t y = (size_t) (uintptr_t) y_raw;
 
-    return x - y;
+    // x - y truncated to int would call values 2^32 apart equal
+    return (x > y) - (x < y);
 }
 
 int str_comp(const void *x, const void *y, const void *ctx)
@@ -34,7 +35,11 @@ int str_comp(const void *x, const void *y, const void *ctx)
 int naive_comp(const void *x, const void *y, const void *ctx)
 {
     (void) ctx;
-    return (uintptr_t) y - (uintptr_t) x;
+    uintptr_t x_addr = (uintptr_t) x;
+    uintptr_t y_addr = (uintptr_t) y;
+
+    // same sign as y - x, without truncating the difference to int
+    return (y_addr > x_addr) - (y_addr < x_addr);
 }
 
 int double_comp(const void *x, const void *y, const void *ctx)
@@ -1,4 +1,4 @@
-#include "destroy_helpers.h"
+#include "utilities/destroy_helpers.h"
 
 void naive_destroy(void *val, const void *ctx)
 {
@@ -6,8 +6,18 @@ void naive_destroy(void *val, const void *ctx)
     free(val);
 }
 
+void naive_destroy_many(void **items, size_t count, const void *ctx)
+{
+    (void) ctx;
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        free(items[idx]);
+    }
+}
+
 destroy_ctx naive_destroy_ctx = 
 {
     naive_destroy,
-    NULL
+    NULL,
+    naive_destroy_many
 };
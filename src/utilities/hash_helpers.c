@@ -0,0 +1,61 @@
+#include "utilities/hash_helpers.h"
+
+// Finalizer from splitmix64, spreads nearby integers across the whole word
+static size_t mix(uint64_t value)
+{
+    value ^= value >> 30;
+    value *= UINT64_C(0xbf58476d1ce4e5b9);
+    value ^= value >> 27;
+    value *= UINT64_C(0x94d049bb133111eb);
+    value ^= value >> 31;
+
+    return (size_t) value;
+}
+
+size_t int_hash(const void *x, const void *ctx)
+{
+    (void) ctx;
+    return mix((uint64_t) (uint32_t) * (const int *) x);
+}
+
+size_t raw_int_hash(const void *x_raw, const void *ctx)
+{
+    (void) ctx;
+    int x = (int) (uintptr_t) x_raw;
+
+    return mix((uint64_t) (uint32_t) x);
+}
+
+size_t raw_size_t_hash(const void *x_raw, const void *ctx)
+{
+    (void) ctx;
+    return mix((uint64_t) (uintptr_t) x_raw);
+}
+
+size_t naive_hash(const void *x, const void *ctx)
+{
+    (void) ctx;
+    return mix((uint64_t) (uintptr_t) x);
+}
+
+size_t str_hash(const void *x, const void *ctx)
+{
+    (void) ctx;
+    const unsigned char *str = x;
+
+    // 64-bit FNV-1a
+    uint64_t hash = UINT64_C(0xcbf29ce484222325);
+    while ('\0' != *str)
+    {
+        hash ^= *str++;
+        hash *= UINT64_C(0x100000001b3);
+    }
+
+    return (size_t) hash;
+}
+
+hash_ctx int_hash_ctx = {int_hash, NULL};
+hash_ctx raw_int_hash_ctx = {raw_int_hash, NULL};
+hash_ctx raw_size_t_hash_ctx = {raw_size_t_hash, NULL};
+hash_ctx str_hash_ctx = {str_hash, NULL};
+hash_ctx naive_hash_ctx = {naive_hash, NULL};
@@ -0,0 +1,229 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "exit_codes.h"
+#include "utilities/node_pool.h"
+
+// Slab headers are padded so the first node starts as aligned as malloc's own result
+#define SLAB_HEADER_SIZE \
+    (((sizeof(slab_t) + _Alignof(max_align_t) - 1) / _Alignof(max_align_t)) * _Alignof(max_align_t))
+
+typedef struct slab
+{
+    struct slab *next;
+} slab_t;
+
+typedef struct free_node
+{
+    struct free_node *next; // stored in the released node itself
+} free_node_t;
+
+struct node_pool
+{
+    size_t node_size;          // bytes per node, rounded up to hold a free_node_t
+    size_t slab_nodes;         // nodes in the next slab to be allocated
+    size_t max_slab_nodes;     // slabs stop doubling at this many nodes
+    slab_t *slabs;             // every slab, newest first
+    free_node_t *free_list;    // released nodes, handed out again before fresh ones
+    unsigned char *fresh;      // next never-used node in the newest slab
+    unsigned char *fresh_end;  // end of the newest slab
+    size_t in_use;
+};
+
+static exit_code_t add_slab(node_pool_t *pool);
+
+node_pool_t *node_pool_create(size_t node_size, size_t max_slab_nodes)
+{
+    node_pool_t *pool = NULL;
+
+    if (0 == node_size)
+    {
+        goto END;
+    }
+
+    // Every node must be able to hold the free-list link and keep the next node aligned
+    if (node_size < sizeof(free_node_t))
+    {
+        node_size = sizeof(free_node_t);
+    }
+
+    if (node_size > SIZE_MAX - _Alignof(void *))
+    {
+        goto END;
+    }
+    node_size = ((node_size + _Alignof(void *) - 1) / _Alignof(void *)) * _Alignof(void *);
+
+    pool = calloc(1, sizeof(node_pool_t));
+    if (NULL == pool)
+    {
+        goto END;
+    }
+
+    pool->node_size = node_size;
+    pool->max_slab_nodes = (0 != max_slab_nodes) ? max_slab_nodes : NODE_POOL_DEFAULT_SLAB_NODES;
+    pool->slab_nodes = (NODE_POOL_MIN_SLAB_NODES < pool->max_slab_nodes) ? NODE_POOL_MIN_SLAB_NODES
+                                                                          : pool->max_slab_nodes;
+
+END:
+    return pool;
+}
+
+void *node_pool_alloc(node_pool_t *pool)
+{
+    void *node = NULL;
+
+    if (NULL == pool)
+    {
+        goto END;
+    }
+
+    if (NULL != pool->free_list)
+    {
+        node = pool->free_list;
+        pool->free_list = pool->free_list->next;
+    }
+    else
+    {
+        if ((pool->fresh == pool->fresh_end) && (E_SUCCESS != add_slab(pool)))
+        {
+            goto END;
+        }
+
+        node = pool->fresh;
+        pool->fresh += pool->node_size;
+    }
+
+    memset(node, 0, pool->node_size);
+    pool->in_use++;
+
+END:
+    return node;
+}
+
+void node_pool_free(node_pool_t *pool, void *node)
+{
+    if ((NULL == pool) || (NULL == node))
+    {
+        goto END;
+    }
+
+    free_node_t *released = node;
+    released->next = pool->free_list;
+    pool->free_list = released;
+    pool->in_use--;
+
+END:
+    return;
+}
+
+size_t node_pool_node_size(const node_pool_t *pool)
+{
+    size_t node_size = 0;
+
+    if (NULL == pool)
+    {
+        goto END;
+    }
+
+    node_size = pool->node_size;
+
+END:
+    return node_size;
+}
+
+size_t node_pool_in_use(const node_pool_t *pool)
+{
+    size_t in_use = 0;
+
+    if (NULL == pool)
+    {
+        goto END;
+    }
+
+    in_use = pool->in_use;
+
+END:
+    return in_use;
+}
+
+void node_pool_reset(node_pool_t *pool)
+{
+    if (NULL == pool)
+    {
+        goto END;
+    }
+
+    while (NULL != pool->slabs)
+    {
+        slab_t *next = pool->slabs->next;
+        free(pool->slabs);
+        pool->slabs = next;
+    }
+
+    pool->free_list = NULL;
+    pool->fresh = NULL;
+    pool->fresh_end = NULL;
+    pool->in_use = 0;
+    pool->slab_nodes = (NODE_POOL_MIN_SLAB_NODES < pool->max_slab_nodes) ? NODE_POOL_MIN_SLAB_NODES
+                                                                          : pool->max_slab_nodes;
+
+END:
+    return;
+}
+
+void node_pool_destroy(node_pool_t **pool)
+{
+    if ((NULL == pool) || (NULL == *pool))
+    {
+        goto END;
+    }
+
+    node_pool_reset(*pool);
+
+    free(*pool);
+    *pool = NULL;
+
+END:
+    return;
+}
+
+// HELPER FUNCTIONS
+
+exit_code_t add_slab(node_pool_t *pool)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    if (pool->slab_nodes > (SIZE_MAX - SLAB_HEADER_SIZE) / pool->node_size)
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
+
+    slab_t *slab = malloc(SLAB_HEADER_SIZE + (pool->slab_nodes * pool->node_size));
+    if (NULL == slab)
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
+
+    slab->next = pool->slabs;
+    pool->slabs = slab;
+
+    pool->fresh = (unsigned char *)slab + SLAB_HEADER_SIZE;
+    pool->fresh_end = pool->fresh + (pool->slab_nodes * pool->node_size);
+
+    // Grow geometrically so a long list needs few slabs and a short one wastes little
+    if (pool->slab_nodes <= pool->max_slab_nodes / 2)
+    {
+        pool->slab_nodes *= 2;
+    }
+    else
+    {
+        pool->slab_nodes = pool->max_slab_nodes;
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
@@ -0,0 +1,567 @@
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "utilities/sort.h"
+#include "utilities/swap.h"
+
+#define INSERTION_SORT_THRESHOLD 16 // ranges this small are finished with insertion sort
+#define NINTHER_THRESHOLD 128       // ranges this large pick the pivot from nine samples
+#define MIN_CHUNK_SIZE 4096         // smallest range worth handing to its own thread
+#define MAX_PENDING_RUNS 128        // run lengths on the stack grow at least like Fibonacci numbers
+
+typedef struct sort_task
+{
+    char *src;
+    char *dst;
+    size_t low;  // first element of the task
+    size_t mid;  // first element of the second run (merge tasks only)
+    size_t high; // one past the last element
+    size_t size;
+    const compare_ctx *compare;
+    void *(*run)(void *task);
+} sort_task_t;
+
+static inline char *element(char *base, size_t index, size_t size);
+static inline int compare_at(char *base, size_t x, size_t y, size_t size, const compare_ctx *compare);
+static void sort_three(char *base, size_t x, size_t y, size_t z, size_t size, const compare_ctx *compare);
+static size_t partition(char *base, size_t count, size_t size, const compare_ctx *compare);
+static void insertion_sort(char *base, size_t count, size_t size, const compare_ctx *compare);
+static void sift_down(char *base, size_t root, size_t count, size_t size, const compare_ctx *compare);
+static void heap_sort(char *base, size_t count, size_t size, const compare_ctx *compare);
+static void introsort_loop(char *base, size_t count, size_t size, const compare_ctx *compare, size_t depth);
+static void *sort_chunk(void *task);
+static void *merge_runs(void *task);
+static void run_tasks(sort_task_t *tasks, size_t num_tasks, pthread_t *threads);
+
+typedef struct chain
+{
+    size_t next_offset;
+    size_t data_offset;
+    const compare_ctx *compare;
+} chain_t;
+
+typedef struct chain_run
+{
+    char *head;
+    char *tail;
+    size_t length;
+} chain_run_t;
+
+static inline char **next_link(const chain_t *chain, char *node);
+static inline int compare_nodes(const chain_t *chain, char *x, char *y);
+static void take_run(const chain_t *chain, char **rest, chain_run_t *run);
+static void merge_chain_runs(const chain_t *chain, chain_run_t *first, const chain_run_t *second);
+
+void introsort(void *base, size_t count, size_t size, const compare_ctx *compare)
+{
+    size_t depth = 0;
+
+    if ((NULL == base) || (NULL == compare) || (0 == size) || (count < 2))
+    {
+        goto END;
+    }
+
+    // Quicksort gets 2 * log2(count) levels before the range is handed to heapsort
+    for (size_t remaining = count; remaining > 1; remaining >>= 1)
+    {
+        depth += 2;
+    }
+
+    introsort_loop(base, count, size, compare, depth);
+
+END:
+    return;
+}
+
+exit_code_t parallel_merge_sort(void *base, size_t count, size_t size, const compare_ctx *compare,
+                                size_t threads)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+    char *scratch = NULL;
+    size_t *bounds = NULL;
+    sort_task_t *tasks = NULL;
+    pthread_t *handles = NULL;
+
+    if ((NULL == base) || (NULL == compare))
+    {
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    if (0 == size)
+    {
+        exit_code = E_INVALID_INPUT;
+        goto END;
+    }
+
+    if (0 == threads)
+    {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (online > 0) ? (size_t)online : 1;
+    }
+
+    // Every thread gets a chunk big enough to be worth the start-up cost
+    if (threads > count / MIN_CHUNK_SIZE)
+    {
+        threads = count / MIN_CHUNK_SIZE;
+    }
+
+    if ((count < PARALLEL_SORT_THRESHOLD) || (threads < 2))
+    {
+        introsort(base, count, size, compare);
+        exit_code = E_SUCCESS;
+        goto END;
+    }
+
+    if (count > SIZE_MAX / size)
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
+
+    scratch = malloc(count * size);
+    bounds = calloc(threads + 1, sizeof(size_t));
+    tasks = calloc(threads, sizeof(sort_task_t));
+    handles = calloc(threads, sizeof(pthread_t));
+    if ((NULL == scratch) || (NULL == bounds) || (NULL == tasks) || (NULL == handles))
+    {
+        exit_code = E_CMR_FAILURE;
+        goto END;
+    }
+
+    // Sort one chunk per thread in place
+    size_t num_runs = threads;
+    for (size_t idx = 0; idx <= num_runs; idx++)
+    {
+        bounds[idx] = (count / num_runs) * idx + (count % num_runs) * idx / num_runs;
+    }
+
+    for (size_t idx = 0; idx < num_runs; idx++)
+    {
+        tasks[idx] = (sort_task_t){base, NULL, bounds[idx], 0, bounds[idx + 1], size, compare, sort_chunk};
+    }
+    run_tasks(tasks, num_runs, handles);
+
+    // Merge neighbouring runs pairwise, bouncing between the list and the scratch buffer
+    char *src = base;
+    char *dst = scratch;
+    while (num_runs > 1)
+    {
+        size_t num_tasks = (num_runs + 1) / 2;
+
+        for (size_t idx = 0; idx < num_tasks; idx++)
+        {
+            size_t low = bounds[2 * idx];
+            size_t high = bounds[(2 * idx + 2 <= num_runs) ? 2 * idx + 2 : num_runs];
+            size_t mid = (2 * idx + 1 < num_runs) ? bounds[2 * idx + 1] : high;
+
+            tasks[idx] = (sort_task_t){src, dst, low, mid, high, size, compare, merge_runs};
+        }
+        run_tasks(tasks, num_tasks, handles);
+
+        for (size_t idx = 0; idx < num_tasks; idx++)
+        {
+            bounds[idx] = tasks[idx].low;
+        }
+        bounds[num_tasks] = count;
+        num_runs = num_tasks;
+
+        char *temp = src;
+        src = dst;
+        dst = temp;
+    }
+
+    if (src != base)
+    {
+        memcpy(base, src, count * size);
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    free(scratch);
+    free(bounds);
+    free(tasks);
+    free(handles);
+    return exit_code;
+}
+
+void *linked_merge_sort(void *head, size_t next_offset, size_t data_offset, const compare_ctx *compare,
+                        void **tail)
+{
+    chain_t chain = {next_offset, data_offset, compare};
+    chain_run_t runs[MAX_PENDING_RUNS];
+    size_t num_runs = 0;
+    char *rest = head;
+
+    if ((NULL == head) || (NULL == compare))
+    {
+        goto END;
+    }
+
+    while (NULL != rest)
+    {
+        take_run(&chain, &rest, &runs[num_runs++]);
+
+        // Keep pending runs balanced (timsort's rules), so the stack stays shallow and merges stay even
+        while (num_runs > 1)
+        {
+            size_t merge_at = num_runs - 2;
+            bool outgrown = (merge_at > 0) &&
+                            (runs[merge_at - 1].length <= runs[merge_at].length + runs[merge_at + 1].length);
+            outgrown = outgrown || ((merge_at > 1) &&
+                                    (runs[merge_at - 2].length <= runs[merge_at - 1].length + runs[merge_at].length));
+
+            if (true == outgrown)
+            {
+                if (runs[merge_at - 1].length < runs[merge_at + 1].length)
+                {
+                    merge_at--;
+                }
+            }
+            else if (runs[merge_at].length > runs[merge_at + 1].length)
+            {
+                break;
+            }
+
+            merge_chain_runs(&chain, &runs[merge_at], &runs[merge_at + 1]);
+            for (size_t idx = merge_at + 1; idx + 1 < num_runs; idx++)
+            {
+                runs[idx] = runs[idx + 1];
+            }
+            num_runs--;
+        }
+    }
+
+    // Merge whatever is still pending, newest first
+    while (num_runs > 1)
+    {
+        merge_chain_runs(&chain, &runs[num_runs - 2], &runs[num_runs - 1]);
+        num_runs--;
+    }
+
+    head = runs[0].head;
+
+END:
+    if (NULL != tail)
+    {
+        *tail = (NULL != head) ? runs[0].tail : NULL;
+    }
+    return head;
+}
+
+// HELPER FUNCTIONS
+
+char *element(char *base, size_t index, size_t size)
+{
+    return base + (index * size);
+}
+
+int compare_at(char *base, size_t x, size_t y, size_t size, const compare_ctx *compare)
+{
+    return compare->compare(element(base, x, size), element(base, y, size), compare->ctx);
+}
+
+void sort_three(char *base, size_t x, size_t y, size_t z, size_t size, const compare_ctx *compare)
+{
+    // Leaves the median of the three elements at y
+    if (compare_at(base, y, x, size, compare) < 0)
+    {
+        swap(element(base, x, size), element(base, y, size), size);
+    }
+
+    if (compare_at(base, z, y, size, compare) < 0)
+    {
+        swap(element(base, y, size), element(base, z, size), size);
+
+        if (compare_at(base, y, x, size, compare) < 0)
+        {
+            swap(element(base, x, size), element(base, y, size), size);
+        }
+    }
+}
+
+size_t partition(char *base, size_t count, size_t size, const compare_ctx *compare)
+{
+    size_t mid = count / 2;
+    size_t last = count - 1;
+
+    // Move the pivot to the front
+    if (count > NINTHER_THRESHOLD)
+    {
+        size_t step = count / 8;
+        sort_three(base, 0, step, 2 * step, size, compare);
+        sort_three(base, mid - step, mid, mid + step, size, compare);
+        sort_three(base, last - 2 * step, last - step, last, size, compare);
+        sort_three(base, step, mid, last - step, size, compare);
+    }
+    else
+    {
+        sort_three(base, 0, mid, last, size, compare);
+    }
+    swap(base, element(base, mid, size), size);
+
+    // Hoare partition; stopping on equal keys keeps runs of duplicates balanced
+    size_t left = 0;
+    size_t right = count;
+    for (;;)
+    {
+        do
+        {
+            left++;
+        } while ((left < count) && (compare_at(base, left, 0, size, compare) < 0));
+
+        do
+        {
+            right--;
+        } while (compare_at(base, right, 0, size, compare) > 0);
+
+        if (left >= right)
+        {
+            break;
+        }
+
+        swap(element(base, left, size), element(base, right, size), size);
+    }
+
+    swap(base, element(base, right, size), size);
+
+    return right;
+}
+
+void insertion_sort(char *base, size_t count, size_t size, const compare_ctx *compare)
+{
+    for (size_t idx = 1; idx < count; idx++)
+    {
+        for (size_t pos = idx; (pos > 0) && (compare_at(base, pos, pos - 1, size, compare) < 0); pos--)
+        {
+            swap(element(base, pos, size), element(base, pos - 1, size), size);
+        }
+    }
+}
+
+void sift_down(char *base, size_t root, size_t count, size_t size, const compare_ctx *compare)
+{
+    for (;;)
+    {
+        size_t child = (2 * root) + 1;
+        if (child >= count)
+        {
+            break;
+        }
+
+        if ((child + 1 < count) && (compare_at(base, child, child + 1, size, compare) < 0))
+        {
+            child++;
+        }
+
+        if (compare_at(base, root, child, size, compare) >= 0)
+        {
+            break;
+        }
+
+        swap(element(base, root, size), element(base, child, size), size);
+        root = child;
+    }
+}
+
+void heap_sort(char *base, size_t count, size_t size, const compare_ctx *compare)
+{
+    for (size_t root = count / 2; root > 0; root--)
+    {
+        sift_down(base, root - 1, count, size, compare);
+    }
+
+    for (size_t end = count - 1; end > 0; end--)
+    {
+        swap(base, element(base, end, size), size);
+        sift_down(base, 0, end, size, compare);
+    }
+}
+
+void introsort_loop(char *base, size_t count, size_t size, const compare_ctx *compare, size_t depth)
+{
+    while (count > INSERTION_SORT_THRESHOLD)
+    {
+        if (0 == depth)
+        {
+            heap_sort(base, count, size, compare);
+            return;
+        }
+        depth--;
+
+        size_t pivot = partition(base, count, size, compare);
+        char *upper = element(base, pivot + 1, size);
+        size_t upper_count = count - pivot - 1;
+
+        // Recurse into the smaller side so the stack stays O(log n)
+        if (pivot < upper_count)
+        {
+            introsort_loop(base, pivot, size, compare, depth);
+            base = upper;
+            count = upper_count;
+        }
+        else
+        {
+            introsort_loop(upper, upper_count, size, compare, depth);
+            count = pivot;
+        }
+    }
+
+    insertion_sort(base, count, size, compare);
+}
+
+void *sort_chunk(void *task)
+{
+    sort_task_t *chunk = task;
+
+    introsort(element(chunk->src, chunk->low, chunk->size), chunk->high - chunk->low, chunk->size,
+              chunk->compare);
+
+    return NULL;
+}
+
+void *merge_runs(void *task)
+{
+    sort_task_t *merge = task;
+    size_t left = merge->low;
+    size_t right = merge->mid;
+    size_t out = merge->low;
+    size_t size = merge->size;
+
+    while ((left < merge->mid) && (right < merge->high))
+    {
+        size_t next = (compare_at(merge->src, right, left, size, merge->compare) < 0) ? right++ : left++;
+        memcpy(element(merge->dst, out++, size), element(merge->src, next, size), size);
+    }
+
+    // At most one of the runs has anything left
+    memcpy(element(merge->dst, out, size), element(merge->src, left, size), (merge->mid - left) * size);
+    out += merge->mid - left;
+    memcpy(element(merge->dst, out, size), element(merge->src, right, size), (merge->high - right) * size);
+
+    return NULL;
+}
+
+void run_tasks(sort_task_t *tasks, size_t num_tasks, pthread_t *threads)
+{
+    // The calling thread takes the first task; a task whose thread cannot start runs inline
+    for (size_t idx = 1; idx < num_tasks; idx++)
+    {
+        if (0 != pthread_create(&threads[idx], NULL, tasks[idx].run, &tasks[idx]))
+        {
+            tasks[idx].run(&tasks[idx]);
+            tasks[idx].run = NULL;
+        }
+    }
+
+    tasks[0].run(&tasks[0]);
+
+    for (size_t idx = 1; idx < num_tasks; idx++)
+    {
+        if (NULL != tasks[idx].run)
+        {
+            pthread_join(threads[idx], NULL);
+        }
+    }
+}
+
+char **next_link(const chain_t *chain, char *node)
+{
+    return (char **)(node + chain->next_offset);
+}
+
+int compare_nodes(const chain_t *chain, char *x, char *y)
+{
+    return chain->compare->compare(*(void **)(x + chain->data_offset), *(void **)(y + chain->data_offset),
+                                   chain->compare->ctx);
+}
+
+void take_run(const chain_t *chain, char **rest, chain_run_t *run)
+{
+    char *node = *rest;
+    char *next = *next_link(chain, node);
+
+    run->length = 1;
+
+    if ((NULL != next) && (compare_nodes(chain, next, node) < 0))
+    {
+        // A strictly descending run is reversed as it is read; equal keys never join it, which keeps
+        // the sort stable
+        char *reversed = node;
+        *next_link(chain, node) = NULL;
+        run->tail = node;
+
+        while ((NULL != next) && (compare_nodes(chain, next, reversed) < 0))
+        {
+            char *after = *next_link(chain, next);
+            *next_link(chain, next) = reversed;
+            reversed = next;
+            next = after;
+            run->length++;
+        }
+
+        run->head = reversed;
+        *rest = next;
+    }
+    else
+    {
+        while ((NULL != next) && (compare_nodes(chain, next, node) >= 0))
+        {
+            node = next;
+            next = *next_link(chain, node);
+            run->length++;
+        }
+
+        *next_link(chain, node) = NULL;
+        run->head = *rest;
+        run->tail = node;
+        *rest = next;
+    }
+}
+
+void merge_chain_runs(const chain_t *chain, chain_run_t *first, const chain_run_t *second)
+{
+    // Runs that are already in order only need joining, which keeps nearly sorted input linear
+    if (compare_nodes(chain, second->head, first->tail) >= 0)
+    {
+        *next_link(chain, first->tail) = second->head;
+        first->tail = second->tail;
+        first->length += second->length;
+        goto END;
+    }
+
+    char *left = first->head;
+    char *right = second->head;
+    char *head = NULL;
+    char **link = &head;
+
+    // Ties go to the first run, which comes earlier in the list
+    while ((NULL != left) && (NULL != right))
+    {
+        if (compare_nodes(chain, right, left) < 0)
+        {
+            *link = right;
+            link = next_link(chain, right);
+            right = *link;
+        }
+        else
+        {
+            *link = left;
+            link = next_link(chain, left);
+            left = *link;
+        }
+    }
+
+    *link = (NULL != left) ? left : right;
+
+    first->head = head;
+    first->tail = (NULL != left) ? first->tail : second->tail;
+    first->length += second->length;
+
+END:
+    return;
+}
@@ -14,8 +14,8 @@ void swap(void *position_1, void *position_2, size_t size)
         *y = temp;
 
         // update variables
-        *x++;
-        *y++;
-        temp --;
+        x++;
+        y++;
+        size--;
     }
 }
\ No newline at end of file
@@ -0,0 +1,197 @@
+#include "utilities/word_search.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define WORD_SEARCH_X86
+#endif
+
+static size_t scalar_find(const uintptr_t *words, size_t count, uintptr_t key, uintptr_t mask)
+{
+    size_t idx = 0;
+
+    key &= mask;
+    while ((idx < count) && ((words[idx] & mask) != key))
+    {
+        idx++;
+    }
+
+    return idx;
+}
+
+static size_t scalar_count(const uintptr_t *words, size_t count, uintptr_t key, uintptr_t mask)
+{
+    size_t matches = 0;
+
+    key &= mask;
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        matches += ((words[idx] & mask) == key);
+    }
+
+    return matches;
+}
+
+#ifdef WORD_SEARCH_X86
+// SSE2 has no 64-bit compare, so a lane matches when both of its 32-bit halves do
+static inline int sse2_match_bits(const uintptr_t *words, __m128i key, __m128i mask)
+{
+    __m128i value = _mm_and_si128(_mm_loadu_si128((const __m128i *) words), mask);
+    __m128i halves = _mm_cmpeq_epi32(value, key);
+    __m128i lanes = _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+
+    return _mm_movemask_pd(_mm_castsi128_pd(lanes));
+}
+
+static size_t sse2_find(const uintptr_t *words, size_t count, uintptr_t key, uintptr_t mask)
+{
+    __m128i key_v = _mm_set1_epi64x((long long) (key & mask));
+    __m128i mask_v = _mm_set1_epi64x((long long) mask);
+    size_t idx = 0;
+
+    for (; idx + 2 <= count; idx += 2)
+    {
+        int bits = sse2_match_bits(words + idx, key_v, mask_v);
+        if (0 != bits)
+        {
+            return idx + (size_t) __builtin_ctz((unsigned) bits);
+        }
+    }
+
+    return idx + scalar_find(words + idx, count - idx, key, mask);
+}
+
+static size_t sse2_count(const uintptr_t *words, size_t count, uintptr_t key, uintptr_t mask)
+{
+    __m128i key_v = _mm_set1_epi64x((long long) (key & mask));
+    __m128i mask_v = _mm_set1_epi64x((long long) mask);
+    size_t matches = 0;
+    size_t idx = 0;
+
+    for (; idx + 2 <= count; idx += 2)
+    {
+        matches += (size_t) __builtin_popcount((unsigned) sse2_match_bits(words + idx, key_v, mask_v));
+    }
+
+    return matches + scalar_count(words + idx, count - idx, key, mask);
+}
+
+__attribute__((target("avx2")))
+static size_t avx2_find(const uintptr_t *words, size_t count, uintptr_t key, uintptr_t mask)
+{
+    __m256i key_v = _mm256_set1_epi64x((long long) (key & mask));
+    __m256i mask_v = _mm256_set1_epi64x((long long) mask);
+    size_t idx = 0;
+
+    // Two vectors per iteration keep both load ports busy
+    for (; idx + 8 <= count; idx += 8)
+    {
+        __m256i lo = _mm256_and_si256(_mm256_loadu_si256((const __m256i *) (words + idx)), mask_v);
+        __m256i hi = _mm256_and_si256(_mm256_loadu_si256((const __m256i *) (words + idx + 4)), mask_v);
+        int lo_bits = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(lo, key_v)));
+        int hi_bits = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(hi, key_v)));
+        unsigned bits = (unsigned) lo_bits | ((unsigned) hi_bits << 4);
+
+        if (0 != bits)
+        {
+            return idx + (size_t) __builtin_ctz(bits);
+        }
+    }
+
+    return idx + scalar_find(words + idx, count - idx, key, mask);
+}
+
+__attribute__((target("avx2")))
+static size_t avx2_count(const uintptr_t *words, size_t count, uintptr_t key, uintptr_t mask)
+{
+    __m256i key_v = _mm256_set1_epi64x((long long) (key & mask));
+    __m256i mask_v = _mm256_set1_epi64x((long long) mask);
+    size_t matches = 0;
+    size_t idx = 0;
+
+    for (; idx + 4 <= count; idx += 4)
+    {
+        __m256i value = _mm256_and_si256(_mm256_loadu_si256((const __m256i *) (words + idx)), mask_v);
+        int bits = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(value, key_v)));
+        matches += (size_t) __builtin_popcount((unsigned) bits);
+    }
+
+    return matches + scalar_count(words + idx, count - idx, key, mask);
+}
+
+__attribute__((target("avx512f")))
+static size_t avx512_find(const uintptr_t *words, size_t count, uintptr_t key, uintptr_t mask)
+{
+    __m512i key_v = _mm512_set1_epi64((long long) (key & mask));
+    __m512i mask_v = _mm512_set1_epi64((long long) mask);
+    size_t idx = 0;
+
+    for (; idx + 8 <= count; idx += 8)
+    {
+        __m512i value = _mm512_and_si512(_mm512_loadu_si512((const void *) (words + idx)), mask_v);
+        __mmask8 bits = _mm512_cmpeq_epi64_mask(value, key_v);
+
+        if (0 != bits)
+        {
+            return idx + (size_t) __builtin_ctz((unsigned) bits);
+        }
+    }
+
+    return idx + scalar_find(words + idx, count - idx, key, mask);
+}
+
+__attribute__((target("avx512f")))
+static size_t avx512_count(const uintptr_t *words, size_t count, uintptr_t key, uintptr_t mask)
+{
+    __m512i key_v = _mm512_set1_epi64((long long) (key & mask));
+    __m512i mask_v = _mm512_set1_epi64((long long) mask);
+    size_t matches = 0;
+    size_t idx = 0;
+
+    for (; idx + 8 <= count; idx += 8)
+    {
+        __m512i value = _mm512_and_si512(_mm512_loadu_si512((const void *) (words + idx)), mask_v);
+        matches += (size_t) __builtin_popcount((unsigned) _mm512_cmpeq_epi64_mask(value, key_v));
+    }
+
+    return matches + scalar_count(words + idx, count - idx, key, mask);
+}
+#endif
+
+size_t word_find(const uintptr_t *words, size_t count, uintptr_t key, uintptr_t mask)
+{
+#ifdef WORD_SEARCH_X86
+    // __builtin_cpu_supports reads the CPUID results libgcc caches at start-up
+    if (__builtin_cpu_supports("avx512f"))
+    {
+        return avx512_find(words, count, key, mask);
+    }
+
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return avx2_find(words, count, key, mask);
+    }
+
+    return sse2_find(words, count, key, mask);
+#else
+    return scalar_find(words, count, key, mask);
+#endif
+}
+
+size_t word_count(const uintptr_t *words, size_t count, uintptr_t key, uintptr_t mask)
+{
+#ifdef WORD_SEARCH_X86
+    if (__builtin_cpu_supports("avx512f"))
+    {
+        return avx512_count(words, count, key, mask);
+    }
+
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return avx2_count(words, count, key, mask);
+    }
+
+    return sse2_count(words, count, key, mask);
+#else
+    return scalar_count(words, count, key, mask);
+#endif
+}
@@ -0,0 +1,230 @@
+#include <check.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "array_deque.h"
+#include "exit_codes.h"
+#include "utilities/comparison_helpers.h"
+
+static int destroy_count = 0;
+
+static void count_destroy(void *data, const void *context)
+{
+    (void) data;
+    (void) context;
+    destroy_count++;
+}
+
+static destroy_ctx count_destroy_ctx = {count_destroy, NULL, NULL};
+
+static void count_destroy_many(void **items, size_t count, const void *context)
+{
+    (void) items;
+    (void) context;
+    destroy_count += (int)count;
+}
+
+static destroy_ctx count_destroy_many_ctx = {NULL, NULL, count_destroy_many};
+
+// CREATE TESTS
+//***********************************************************************************************
+// ensure a new deque is empty
+START_TEST(test_array_deque_create)
+{
+    array_deque_t *deque = array_deque_create(NULL, NULL);
+    ck_assert_ptr_ne(deque, NULL);
+    ck_assert(array_deque_is_empty(deque));
+
+    array_deque_destroy(&deque);
+    ck_assert_ptr_eq(deque, NULL);
+}
+END_TEST
+
+// ensure a zero element size is rejected
+START_TEST(test_array_deque_create_typed_zero_size)
+{
+    ck_assert_ptr_eq(array_deque_create_typed(0, NULL, NULL), NULL);
+}
+END_TEST
+
+// TEST LIST
+static TFun array_deque_create_tests[] =
+{
+    test_array_deque_create,
+    test_array_deque_create_typed_zero_size,
+    NULL
+};
+
+// PUSH AND POP TESTS
+//***********************************************************************************************
+// ensure the deque works as a FIFO across many wraps and growths
+START_TEST(test_array_deque_fifo)
+{
+    int out = 0;
+    int next_in = 0;
+    int next_out = 0;
+    array_deque_t *deque = array_deque_create_typed(sizeof(int), NULL, NULL);
+
+    // keep a sliding window of varying size so head wraps at every capacity
+    for (int round = 0; round < 200; round++)
+    {
+        for (int num = 0; num < (round % 7) + 3; num++, next_in++)
+        {
+            ck_assert_int_eq(array_deque_push_back(deque, &next_in), E_SUCCESS);
+        }
+
+        for (int num = 0; num < (round % 5) + 2; num++, next_out++)
+        {
+            ck_assert_int_eq(array_deque_pop_front(deque, &out), E_SUCCESS);
+            ck_assert_int_eq(out, next_out);
+        }
+    }
+
+    ck_assert_int_eq(array_deque_size(deque), next_in - next_out);
+    ck_assert_int_eq(*(int *)array_deque_get(deque, 0), next_out);
+
+    array_deque_destroy(&deque);
+}
+END_TEST
+
+// ensure both ends can be pushed and popped, destroying only when no out is given
+START_TEST(test_array_deque_both_ends)
+{
+    void *out = NULL;
+    destroy_count = 0;
+    array_deque_t *deque = array_deque_create(&count_destroy_ctx, NULL);
+
+    // 30 .. 1 then 101 .. 130
+    for (int num = 1; num <= 30; num++)
+    {
+        array_deque_push_front(deque, (void *)(uintptr_t)num);
+        array_deque_push_back(deque, (void *)(uintptr_t)(num + 100));
+    }
+
+    ck_assert_int_eq(array_deque_size(deque), 60);
+    ck_assert_int_eq((int)(uintptr_t)array_deque_get(deque, 0), 30);
+    ck_assert_int_eq((int)(uintptr_t)array_deque_get(deque, 29), 1);
+    ck_assert_int_eq((int)(uintptr_t)array_deque_get(deque, 30), 101);
+    ck_assert_ptr_eq(array_deque_get(deque, 60), NULL);
+
+    ck_assert_int_eq(array_deque_pop_back(deque, &out), E_SUCCESS);
+    ck_assert_int_eq((int)(uintptr_t)out, 130);
+    ck_assert_int_eq(array_deque_pop_front(deque, NULL), E_SUCCESS);
+    ck_assert_int_eq(destroy_count, 1);
+
+    array_deque_destroy(&deque);
+    ck_assert_int_eq(destroy_count, 59);
+}
+END_TEST
+
+// ensure a ctx with only destroy_many still frees elements dropped one at a time
+START_TEST(test_array_deque_destroy_many_only)
+{
+    destroy_count = 0;
+    array_deque_t *deque = array_deque_create(&count_destroy_many_ctx, NULL);
+
+    for (int num = 1; num <= 4; num++)
+    {
+        array_deque_push_back(deque, (void *)(uintptr_t)num);
+    }
+
+    ck_assert_int_eq(array_deque_pop_front(deque, NULL), E_SUCCESS);
+    ck_assert_int_eq(array_deque_pop_back(deque, NULL), E_SUCCESS);
+    ck_assert_int_eq(destroy_count, 2);
+
+    array_deque_destroy(&deque);
+    ck_assert_int_eq(destroy_count, 4);
+}
+END_TEST
+
+// ensure popping an empty or NULL deque fails
+START_TEST(test_array_deque_pop_empty)
+{
+    array_deque_t *deque = array_deque_create(NULL, NULL);
+
+    ck_assert_int_eq(array_deque_pop_front(deque, NULL), E_LIST_ERROR);
+    ck_assert_int_eq(array_deque_pop_back(deque, NULL), E_LIST_ERROR);
+    ck_assert_int_eq(array_deque_pop_back(NULL, NULL), E_LIST_ERROR);
+    ck_assert_int_eq(array_deque_push_back(deque, NULL), E_NULL_POINTER);
+
+    array_deque_destroy(&deque);
+}
+END_TEST
+
+// TEST LIST
+static TFun array_deque_ends_tests[] =
+{
+    test_array_deque_fifo,
+    test_array_deque_both_ends,
+    test_array_deque_destroy_many_only,
+    test_array_deque_pop_empty,
+    NULL
+};
+
+// ACCESS TESTS
+//***********************************************************************************************
+// ensure set and contains use logical indices on a wrapped buffer
+START_TEST(test_array_deque_set_and_contains)
+{
+    array_deque_t *deque = array_deque_create(NULL, &raw_int_eq_ctx);
+
+    for (int num = 1; num <= ARRAY_DEQUE_INITIAL_CAPACITY; num++)
+    {
+        array_deque_push_back(deque, (void *)(uintptr_t)num);
+    }
+    array_deque_pop_front(deque, NULL);
+    array_deque_pop_front(deque, NULL);
+    array_deque_push_back(deque, (void *)(uintptr_t)50); // lands in a wrapped slot
+
+    ck_assert_int_eq(array_deque_set(deque, 0, (void *)(uintptr_t)70), E_SUCCESS);
+    ck_assert_int_eq(array_deque_set(deque, array_deque_size(deque), (void *)(uintptr_t)1), E_OUT_OF_BOUNDS);
+    ck_assert(array_deque_contains(deque, (void *)(uintptr_t)70));
+    ck_assert(array_deque_contains(deque, (void *)(uintptr_t)50));
+    ck_assert(!array_deque_contains(deque, (void *)(uintptr_t)3));
+
+    array_deque_destroy(&deque);
+}
+END_TEST
+
+// TEST LIST
+static TFun array_deque_access_tests[] =
+{
+    test_array_deque_set_and_contains,
+    NULL
+};
+
+static void add_tests(TCase * test_cases, TFun * test_functions)
+{
+    while (* test_functions)
+    {
+        // add the test from the core_tests array to the tcase
+        tcase_add_test(test_cases, * test_functions);
+        test_functions++;
+    }
+}
+
+Suite *array_deque_test_suite(void)
+{
+    Suite *array_deque_test_suite = suite_create("Array Deque Tests");
+
+    // Create array_deque_create() tests
+    TFun *array_deque_create_test_list = array_deque_create_tests;
+    TCase *array_deque_create_test_cases = tcase_create(" array_deque_create() Tests");
+    add_tests(array_deque_create_test_cases, array_deque_create_test_list);
+    suite_add_tcase(array_deque_test_suite, array_deque_create_test_cases);
+
+    // Create array_deque push/pop tests
+    TFun *array_deque_ends_test_list = array_deque_ends_tests;
+    TCase *array_deque_ends_test_cases = tcase_create(" array_deque push/pop Tests");
+    add_tests(array_deque_ends_test_cases, array_deque_ends_test_list);
+    suite_add_tcase(array_deque_test_suite, array_deque_ends_test_cases);
+
+    // Create array_deque_set()/contains() tests
+    TFun *array_deque_access_test_list = array_deque_access_tests;
+    TCase *array_deque_access_test_cases = tcase_create(" array_deque_set()/contains() Tests");
+    add_tests(array_deque_access_test_cases, array_deque_access_test_list);
+    suite_add_tcase(array_deque_test_suite, array_deque_access_test_cases);
+
+    return array_deque_test_suite;
+}
@@ -1,10 +1,17 @@
 #include <check.h>
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
 
 #include "array_list.h"
 #include "void_pointer_functions.h"
 #include "exit_codes.h"
+#include "utilities/comparison_helpers.h"
+#include "utilities/hash_helpers.h"
+#include "utilities/sort.h"
+#include "utilities/destroy_helpers.h"
 
 struct array_list
 {
@@ -104,10 +111,11 @@ START_TEST(test_array_list_insert_int_multi)
     ck_assert_int_eq(exit_code, E_SUCCESS);
     ck_assert_int_eq(*((int *)list->elements[3]), 41);
 
-    // Ensure 76 at index 4
+    // Ensure 76 at index 3 and 41 shifted to index 4
     exit_code = array_list_insert(list, 3, &num_array[4]);
     ck_assert_int_eq(exit_code, E_SUCCESS);
-    ck_assert_int_eq(*((int *)list->elements[4]), 76);
+    ck_assert_int_eq(*((int *)list->elements[3]), 76);
+    ck_assert_int_eq(*((int *)list->elements[4]), 41);
 
     //************************************
     // Verify capacity
@@ -389,6 +397,1842 @@ static TFun array_list_set_tests[] =
     NULL
 };
 
+// TYPED LIST TESTS
+//***********************************************************************************************
+typedef struct point
+{
+    int x;
+    int y;
+} point_t;
+
+// ensure values are copied into the list rather than referenced
+START_TEST(test_array_list_typed_insert_copies)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    array_list_t *list = array_list_create_typed(sizeof(int), NULL, &int_eq_ctx);
+    ck_assert_ptr_ne(list, NULL);
+
+    for (int num = 0; num < 20; num++)
+    {
+        exit_code = push(list, &num);
+        ck_assert_int_eq(exit_code, E_SUCCESS);
+    }
+
+    int num = 100;
+    exit_code = array_list_insert(list, 10, &num);
+    ck_assert_int_eq(exit_code, E_SUCCESS);
+    num = -1;
+
+    ck_assert_int_eq(array_list_size(list), 21);
+    ck_assert_int_eq(*((int *)array_list_get(list, 9)), 9);
+    ck_assert_int_eq(*((int *)array_list_get(list, 10)), 100);
+    ck_assert_int_eq(*((int *)array_list_get(list, 11)), 10);
+    ck_assert_int_eq(*((int *)array_list_get(list, 20)), 19);
+
+    array_list_destroy(&list);
+    ck_assert_ptr_eq(list, NULL);
+}
+END_TEST
+
+// ensure structs can be set, read back and searched by value
+START_TEST(test_array_list_typed_struct)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    array_list_t *list = array_list_create_typed(sizeof(point_t), NULL, NULL);
+
+    point_t point = {1, 2};
+    exit_code = push(list, &point);
+    ck_assert_int_eq(exit_code, E_SUCCESS);
+
+    point_t replacement = {3, 4};
+    exit_code = array_list_set(list, 0, &replacement);
+    ck_assert_int_eq(exit_code, E_SUCCESS);
+
+    point_t result = {0, 0};
+    exit_code = array_list_get_value(list, 0, &result);
+    ck_assert_int_eq(exit_code, E_SUCCESS);
+    ck_assert_int_eq(result.x, 3);
+    ck_assert_int_eq(result.y, 4);
+
+    exit_code = array_list_get_value(list, 1, &result);
+    ck_assert_int_eq(exit_code, E_OUT_OF_BOUNDS);
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure removing by value hands the element back and closes the gap
+START_TEST(test_array_list_typed_remove_value)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    array_list_t *list = array_list_create_typed(sizeof(int), NULL, &int_eq_ctx);
+
+    int num_array[] = {13, 52, 36};
+    for (size_t idx = 0; idx < 3; idx++)
+    {
+        push(list, &num_array[idx]);
+    }
+
+    int removed = 0;
+    exit_code = array_list_remove_value(list, 1, &removed);
+    ck_assert_int_eq(exit_code, E_SUCCESS);
+    ck_assert_int_eq(removed, 52);
+    ck_assert_int_eq(array_list_size(list), 2);
+    ck_assert_int_eq(*((int *)array_list_get(list, 1)), 36);
+
+    ck_assert(array_list_contains(list, &num_array[2]));
+    ck_assert(!array_list_contains(list, &num_array[1]));
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure a zero element size is rejected
+START_TEST(test_array_list_typed_zero_size)
+{
+    array_list_t *list = array_list_create_typed(0, NULL, NULL);
+    ck_assert_ptr_eq(list, NULL);
+}
+END_TEST
+
+// TEST LIST
+static TFun array_list_typed_tests[] =
+{
+    test_array_list_typed_insert_copies,
+    test_array_list_typed_struct,
+    test_array_list_typed_remove_value,
+    test_array_list_typed_zero_size,
+    NULL
+};
+
+// RANGE TESTS
+//***********************************************************************************************
+static int destroy_count = 0;
+
+static void count_destroy(void *data, const void *context)
+{
+    (void) data;
+    (void) context;
+    destroy_count++;
+}
+
+static destroy_ctx count_destroy_ctx = {count_destroy, NULL, NULL};
+
+// ensure a batch larger than the capacity is appended in order
+START_TEST(test_array_list_push_many)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    int num_array[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    void *items[12];
+    for (size_t idx = 0; idx < 12; idx++)
+    {
+        items[idx] = &num_array[idx];
+    }
+
+    array_list_t *list = array_list_create(NULL, NULL);
+
+    exit_code = array_list_push_many(list, items, 12);
+    ck_assert_int_eq(exit_code, E_SUCCESS);
+    ck_assert_int_eq(array_list_size(list), 12);
+    ck_assert_int_eq(list->total_capacity, 20);
+
+    for (size_t idx = 0; idx < 12; idx++)
+    {
+        ck_assert_int_eq(*((int *)list->elements[idx]), num_array[idx]);
+    }
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure a batch is placed in the middle and the tail is shifted once
+START_TEST(test_array_list_insert_range_middle)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    int values[] = {1, 2, 3, 4};
+    int batch[] = {10, 20, 30};
+    int expected[] = {1, 2, 10, 20, 30, 3, 4};
+
+    array_list_t *list = array_list_create_typed(sizeof(int), NULL, NULL);
+
+    exit_code = array_list_push_many(list, values, 4);
+    ck_assert_int_eq(exit_code, E_SUCCESS);
+
+    exit_code = array_list_insert_range(list, 2, batch, 3);
+    ck_assert_int_eq(exit_code, E_SUCCESS);
+    ck_assert_int_eq(array_list_size(list), 7);
+
+    for (size_t idx = 0; idx < 7; idx++)
+    {
+        ck_assert_int_eq(*((int *)array_list_get(list, idx)), expected[idx]);
+    }
+
+    exit_code = array_list_insert_range(list, 8, batch, 3);
+    ck_assert_int_eq(exit_code, E_OUT_OF_BOUNDS);
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure a batch containing NULL is rejected without modifying the list
+START_TEST(test_array_list_insert_range_NULL_item)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    int num = 5;
+    void *items[] = {&num, NULL};
+
+    array_list_t *list = array_list_create(NULL, NULL);
+
+    exit_code = array_list_insert_range(list, 0, items, 2);
+    ck_assert_int_eq(exit_code, E_NULL_POINTER);
+    ck_assert_int_eq(array_list_size(list), 0);
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure a removed range is destroyed and the gap closed
+START_TEST(test_array_list_remove_range)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    int values[] = {0, 1, 2, 3, 4, 5, 6, 7};
+    int expected[] = {0, 1, 6, 7};
+
+    destroy_count = 0;
+    array_list_t *list = array_list_create_typed(sizeof(int), &count_destroy_ctx, NULL);
+    array_list_push_many(list, values, 8);
+
+    exit_code = array_list_remove_range(list, 2, 4);
+    ck_assert_int_eq(exit_code, E_SUCCESS);
+    ck_assert_int_eq(destroy_count, 4);
+    ck_assert_int_eq(array_list_size(list), 4);
+
+    for (size_t idx = 0; idx < 4; idx++)
+    {
+        ck_assert_int_eq(*((int *)array_list_get(list, idx)), expected[idx]);
+    }
+
+    exit_code = array_list_remove_range(list, 2, 3);
+    ck_assert_int_eq(exit_code, E_OUT_OF_BOUNDS);
+    ck_assert_int_eq(destroy_count, 4);
+
+    array_list_destroy(&list);
+    ck_assert_int_eq(destroy_count, 8);
+}
+END_TEST
+
+static _Atomic size_t many_items = 0;
+static _Atomic size_t many_calls = 0;
+
+static void count_destroy_many(void **items, size_t count, const void *context)
+{
+    (void) context;
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        ck_assert_ptr_ne(items[idx], NULL);
+    }
+    many_items += count;
+    many_calls++;
+}
+
+static destroy_ctx count_destroy_many_ctx = {NULL, NULL, count_destroy_many};
+
+// ensure a pointer list hands each range to destroy_many in one call
+START_TEST(test_array_list_destroy_many_pointers)
+{
+    many_items = 0;
+    many_calls = 0;
+    array_list_t *list = array_list_create(&count_destroy_many_ctx, NULL);
+
+    for (int num = 1; num <= 1000; num++)
+    {
+        push(list, (void *)(uintptr_t)num);
+    }
+
+    array_list_remove_range(list, 10, 90);
+    ck_assert_int_eq(many_items, 90);
+    ck_assert_int_eq(many_calls, 1);
+
+    array_list_destroy(&list);
+    ck_assert_int_eq(many_items, 1000);
+    ck_assert_int_eq(many_calls, 2);
+}
+END_TEST
+
+// ensure typed lists pass slot addresses to destroy_many in batches
+START_TEST(test_array_list_destroy_many_typed)
+{
+    many_items = 0;
+    many_calls = 0;
+    array_list_t *list = array_list_create_typed(sizeof(int), &count_destroy_many_ctx, NULL);
+
+    for (int num = 0; num < 600; num++)
+    {
+        push(list, &num);
+    }
+
+    array_list_destroy(&list);
+    ck_assert_int_eq(many_items, 600);
+    ck_assert_int_eq(many_calls, 3);
+}
+END_TEST
+
+static int last_destroyed = 0;
+
+static void free_destroy_many(void **items, size_t count, const void *context)
+{
+    (void) context;
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        last_destroyed = *(int *)items[idx];
+        free(items[idx]);
+    }
+    many_items += count;
+}
+
+static void record_destroy_many(void **items, size_t count, const void *context)
+{
+    (void) context;
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        last_destroyed = *(int *)items[idx];
+    }
+    many_items += count;
+}
+
+static destroy_ctx free_destroy_many_ctx = {NULL, NULL, free_destroy_many};
+static destroy_ctx record_destroy_many_ctx = {NULL, NULL, record_destroy_many};
+
+// ensure remove and set free the dropped element when only destroy_many is given
+START_TEST(test_array_list_destroy_many_single)
+{
+    many_items = 0;
+    array_list_t *list = array_list_create(&free_destroy_many_ctx, NULL);
+
+    for (int num = 1; num <= 3; num++)
+    {
+        int *value = malloc(sizeof(int));
+        *value = num;
+        push(list, value);
+    }
+
+    ck_assert_int_eq(array_list_remove(list, 1), E_SUCCESS);
+    ck_assert_int_eq(many_items, 1);
+    ck_assert_int_eq(last_destroyed, 2);
+
+    int *value = malloc(sizeof(int));
+    *value = 4;
+    ck_assert_int_eq(array_list_set(list, 0, value), E_SUCCESS);
+    ck_assert_int_eq(many_items, 2);
+    ck_assert_int_eq(last_destroyed, 1);
+
+    array_list_destroy(&list);
+    ck_assert_int_eq(many_items, 4);
+
+    // typed lists hand over the slot address
+    many_items = 0;
+    list = array_list_create_typed(sizeof(int), &record_destroy_many_ctx, NULL);
+    for (int num = 1; num <= 3; num++)
+    {
+        push(list, &num);
+    }
+
+    ck_assert_int_eq(array_list_remove(list, 2), E_SUCCESS);
+    ck_assert_int_eq(last_destroyed, 3);
+
+    int replacement = 9;
+    ck_assert_int_eq(array_list_set(list, 0, &replacement), E_SUCCESS);
+    ck_assert_int_eq(last_destroyed, 1);
+    ck_assert_int_eq(many_items, 2);
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure a large list is destroyed across several threads, freeing every element once
+START_TEST(test_array_list_destroy_sharded)
+{
+    size_t count = PARALLEL_DESTROY_THRESHOLD * 2 + 7;
+    many_items = 0;
+
+    array_list_options_t options = {0};
+    options.destroy_threads = 4;
+    array_list_t *list = array_list_create_with_options(&options, &count_destroy_many_ctx, NULL);
+
+    for (size_t idx = 1; idx <= count; idx++)
+    {
+        push(list, (void *)(uintptr_t)idx);
+    }
+
+    array_list_destroy(&list);
+    ck_assert_int_eq(many_items, count);
+
+    // real frees, so a double free or leak shows up under the sanitizers
+    list = array_list_create_with_options(&options, &naive_destroy_ctx, NULL);
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        push(list, malloc(8));
+    }
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure a background destroy returns at once and finishes by the time wait returns
+START_TEST(test_array_list_destroy_in_background)
+{
+    many_items = 0;
+
+    array_list_options_t options = {0};
+    options.destroy_in_background = true;
+    array_list_t *list = array_list_create_with_options(&options, &count_destroy_many_ctx, NULL);
+
+    for (int num = 1; num <= 5000; num++)
+    {
+        push(list, (void *)(uintptr_t)num);
+    }
+
+    array_list_destroy(&list);
+    ck_assert_ptr_eq(list, NULL);
+
+    array_list_wait_for_background_destroys();
+    ck_assert_int_eq(many_items, 5000);
+}
+END_TEST
+
+// TEST LIST
+static TFun array_list_range_tests[] =
+{
+    test_array_list_push_many,
+    test_array_list_insert_range_middle,
+    test_array_list_insert_range_NULL_item,
+    test_array_list_remove_range,
+    test_array_list_destroy_many_pointers,
+    test_array_list_destroy_many_typed,
+    test_array_list_destroy_many_single,
+    test_array_list_destroy_sharded,
+    test_array_list_destroy_in_background,
+    NULL
+};
+
+// CAPACITY TESTS
+//***********************************************************************************************
+// ensure the initial capacity and a fixed growth chunk are honoured
+START_TEST(test_array_list_options_chunk)
+{
+    array_list_options_t options = {0};
+    options.initial_capacity = 3;
+    options.growth_chunk = 4;
+
+    array_list_t *list = array_list_create_with_options(&options, NULL, NULL);
+    ck_assert_ptr_ne(list, NULL);
+    ck_assert_int_eq(array_list_capacity(list), 3);
+
+    int num_array[] = {1, 2, 3, 4};
+    for (size_t idx = 0; idx < 4; idx++)
+    {
+        push(list, &num_array[idx]);
+    }
+
+    ck_assert_int_eq(array_list_capacity(list), 7);
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure a fractional growth factor is used
+START_TEST(test_array_list_options_factor)
+{
+    array_list_options_t options = {0};
+    options.initial_capacity = 10;
+    options.growth_factor = 1.5;
+    options.element_size = sizeof(int);
+
+    array_list_t *list = array_list_create_with_options(&options, NULL, NULL);
+
+    for (int num = 0; num < 11; num++)
+    {
+        push(list, &num);
+    }
+
+    ck_assert_int_eq(array_list_capacity(list), 15);
+    ck_assert_int_eq(*((int *)array_list_get(list, 10)), 10);
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure a growth factor that cannot grow the list is rejected, including negatives and NaN
+START_TEST(test_array_list_options_invalid_factor)
+{
+    array_list_options_t options = {0};
+    double factors[] = {1.0, 0.5, -2.0, -1e-9, NAN, -INFINITY};
+
+    for (size_t idx = 0; idx < sizeof(factors) / sizeof(factors[0]); idx++)
+    {
+        options.growth_factor = factors[idx];
+        ck_assert_ptr_eq(array_list_create_with_options(&options, NULL, NULL), NULL);
+    }
+
+    // 0 still selects the default
+    options.growth_factor = 0.0;
+    array_list_t *list = array_list_create_with_options(&options, NULL, NULL);
+    ck_assert_ptr_ne(list, NULL);
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure reserve presizes exactly and shrink_to_fit gives memory back
+START_TEST(test_array_list_reserve_and_shrink)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    array_list_t *list = array_list_create_typed(sizeof(int), NULL, NULL);
+
+    exit_code = array_list_reserve(list, 1000);
+    ck_assert_int_eq(exit_code, E_SUCCESS);
+    ck_assert_int_eq(array_list_capacity(list), 1000);
+
+    for (int num = 0; num < 1000; num++)
+    {
+        push(list, &num);
+    }
+    ck_assert_int_eq(array_list_capacity(list), 1000);
+
+    exit_code = array_list_remove_range(list, 10, 990);
+    ck_assert_int_eq(exit_code, E_SUCCESS);
+
+    exit_code = array_list_shrink_to_fit(list);
+    ck_assert_int_eq(exit_code, E_SUCCESS);
+    ck_assert_int_eq(array_list_capacity(list), 10);
+    ck_assert_int_eq(*((int *)array_list_get(list, 9)), 9);
+
+    // reserving less than the capacity is a no-op
+    exit_code = array_list_reserve(list, 5);
+    ck_assert_int_eq(exit_code, E_SUCCESS);
+    ck_assert_int_eq(array_list_capacity(list), 10);
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure elements survive moving into a mapping and growing/shrinking there
+START_TEST(test_array_list_mapped_growth)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+
+    array_list_options_t options = {0};
+    options.element_size = sizeof(size_t);
+    options.mmap_threshold = 4096;
+
+    array_list_t *list = array_list_create_with_options(&options, NULL, NULL);
+    ck_assert_ptr_ne(list, NULL);
+
+    for (size_t num = 0; num < 100000; num++)
+    {
+        exit_code = push(list, &num);
+        ck_assert_int_eq(exit_code, E_SUCCESS);
+    }
+
+    ck_assert_int_ge(array_list_capacity(list), 100000);
+
+    for (size_t idx = 0; idx < 100000; idx += 997)
+    {
+        ck_assert_uint_eq(*((size_t *)array_list_get(list, idx)), idx);
+    }
+
+    exit_code = array_list_remove_range(list, 1000, 99000);
+    ck_assert_int_eq(exit_code, E_SUCCESS);
+
+    exit_code = array_list_shrink_to_fit(list);
+    ck_assert_int_eq(exit_code, E_SUCCESS);
+    ck_assert_int_lt(array_list_capacity(list), 2000);
+    ck_assert_uint_eq(*((size_t *)array_list_get(list, 999)), 999);
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure a small list spills to the heap and moves back inline without losing elements
+START_TEST(test_array_list_inline_spill_and_return)
+{
+    array_list_t *list = array_list_create(NULL, &raw_int_eq_ctx);
+    ck_assert_int_eq(array_list_capacity(list), INITIAL_CAPACITY);
+
+    for (int num = 1; num <= 40; num++)
+    {
+        push(list, (void *)(uintptr_t)num);
+    }
+
+    ck_assert_int_eq(array_list_remove_range(list, 3, 37), E_SUCCESS);
+    ck_assert_int_eq(array_list_shrink_to_fit(list), E_SUCCESS);
+    ck_assert_int_eq(array_list_capacity(list), 3);
+
+    for (size_t idx = 0; idx < 3; idx++)
+    {
+        ck_assert_int_eq((int)(uintptr_t)array_list_get(list, idx), idx + 1);
+    }
+
+    // and out again
+    for (int num = 4; num <= 20; num++)
+    {
+        push(list, (void *)(uintptr_t)num);
+    }
+    ck_assert_int_eq((int)(uintptr_t)array_list_get(list, 19), 20);
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure inline storage suits typed elements that need more than pointer alignment
+START_TEST(test_array_list_inline_alignment)
+{
+    typedef struct wide
+    {
+        _Alignas(16) size_t low;
+        size_t high;
+    } wide_t;
+
+    array_list_options_t options = {0};
+    options.element_size = sizeof(wide_t);
+    options.initial_capacity = 2;
+    array_list_t *list = array_list_create_with_options(&options, NULL, NULL);
+
+    wide_t value = {1, 2};
+    push(list, &value);
+    ck_assert_int_eq((uintptr_t)array_list_get(list, 0) % 16, 0);
+
+    value.low = 3;
+    push(list, &value);
+    push(list, &value); // spills
+    ck_assert_int_eq(((wide_t *)array_list_get(list, 2))->low, 3);
+    ck_assert_int_eq(((wide_t *)array_list_get(list, 0))->high, 2);
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure a list can go straight from inline storage to a mapping
+START_TEST(test_array_list_inline_to_mapping)
+{
+    array_list_options_t options = {0};
+    options.mmap_threshold = 64;
+    array_list_t *list = array_list_create_with_options(&options, NULL, NULL);
+
+    for (int num = 1; num <= 9; num++)
+    {
+        push(list, (void *)(uintptr_t)num);
+    }
+
+    ck_assert_int_ge(array_list_capacity(list), 9);
+    ck_assert_int_eq((int)(uintptr_t)array_list_get(list, 0), 1);
+    ck_assert_int_eq((int)(uintptr_t)array_list_get(list, 8), 9);
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// TEST LIST
+static TFun array_list_capacity_tests[] =
+{
+    test_array_list_options_chunk,
+    test_array_list_options_factor,
+    test_array_list_options_invalid_factor,
+    test_array_list_reserve_and_shrink,
+    test_array_list_mapped_growth,
+    test_array_list_inline_spill_and_return,
+    test_array_list_inline_alignment,
+    test_array_list_inline_to_mapping,
+    NULL
+};
+
+// SEARCH TESTS
+//***********************************************************************************************
+// ensure index_of finds the first match with and without a hash index
+START_TEST(test_array_list_index_of_linear)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+    size_t index = 0;
+
+    int values[] = {4, 8, 15, 16, 23, 42, 15};
+    array_list_t *list = array_list_create_typed(sizeof(int), NULL, &int_eq_ctx);
+    array_list_push_many(list, values, 7);
+
+    int key = 15;
+    exit_code = array_list_index_of(list, &key, &index);
+    ck_assert_int_eq(exit_code, E_SUCCESS);
+    ck_assert_int_eq(index, 2);
+
+    key = 99;
+    exit_code = array_list_index_of(list, &key, &index);
+    ck_assert_int_eq(exit_code, E_KEY_NOT_FOUND);
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure a hash index without an equal context is rejected
+START_TEST(test_array_list_hash_requires_equal)
+{
+    array_list_options_t options = {0};
+    options.hash = &int_hash_ctx;
+
+    array_list_t *list = array_list_create_with_options(&options, NULL, NULL);
+    ck_assert_ptr_eq(list, NULL);
+}
+END_TEST
+
+// ensure the hash index follows inserts, sets and removes anywhere in the list
+START_TEST(test_array_list_hash_index_tracks_edits)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+    size_t index = 0;
+
+    array_list_options_t options = {0};
+    options.element_size = sizeof(int);
+    options.hash = &int_hash_ctx;
+
+    array_list_t *list = array_list_create_with_options(&options, NULL, &int_eq_ctx);
+    ck_assert_ptr_ne(list, NULL);
+
+    for (int num = 0; num < 1000; num++)
+    {
+        push(list, &num);
+    }
+
+    // insert at the front shifts every position
+    int key = -5;
+    array_list_insert(list, 0, &key);
+    exit_code = array_list_index_of(list, &key, &index);
+    ck_assert_int_eq(exit_code, E_SUCCESS);
+    ck_assert_int_eq(index, 0);
+
+    key = 500;
+    array_list_index_of(list, &key, &index);
+    ck_assert_int_eq(index, 501);
+
+    // set replaces the indexed value
+    int replacement = 5000;
+    array_list_set(list, 501, &replacement);
+    ck_assert(!array_list_contains(list, &key));
+    array_list_index_of(list, &replacement, &index);
+    ck_assert_int_eq(index, 501);
+
+    // removing a range shifts the tail back
+    exit_code = array_list_remove_range(list, 100, 300);
+    ck_assert_int_eq(exit_code, E_SUCCESS);
+    key = 150;
+    ck_assert(!array_list_contains(list, &key));
+    key = 999;
+    array_list_index_of(list, &key, &index);
+    ck_assert_int_eq(index, 700);
+
+    // duplicates report the first occurrence
+    key = 999;
+    array_list_insert(list, 3, &key);
+    array_list_index_of(list, &key, &index);
+    ck_assert_int_eq(index, 3);
+
+    array_list_remove(list, 3);
+    array_list_index_of(list, &key, &index);
+    ck_assert_int_eq(index, 700);
+
+    // every remaining element is found at its own position
+    for (size_t idx = 0; idx < array_list_size(list); idx++)
+    {
+        exit_code = array_list_index_of(list, array_list_get(list, idx), &index);
+        ck_assert_int_eq(exit_code, E_SUCCESS);
+        ck_assert_int_eq(index, idx);
+    }
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure popping from the tail keeps the other positions and skips the table pass, which would
+// make this quadratic in the list size
+START_TEST(test_array_list_hash_index_tail_removes)
+{
+    size_t index = 0;
+    int popped = 0;
+    size_t count = 1 << 16;
+
+    array_list_options_t options = {0};
+    options.element_size = sizeof(int);
+    options.hash = &int_hash_ctx;
+
+    array_list_t *list = array_list_create_with_options(&options, NULL, &int_eq_ctx);
+    for (int num = 0; num < (int)count; num++)
+    {
+        push(list, &num);
+    }
+
+    while (array_list_size(list) > 10)
+    {
+        size_t last = array_list_size(list) - 1;
+        ck_assert_int_eq(array_list_remove(list, last), E_SUCCESS);
+        ck_assert_int_eq(array_list_remove_value(list, last - 1, &popped), E_SUCCESS);
+        ck_assert_int_eq(popped, (int)last - 1);
+        ck_assert_int_eq(array_list_remove_range(list, last - 3, 2), E_SUCCESS);
+    }
+
+    for (size_t idx = 0; idx < array_list_size(list); idx++)
+    {
+        ck_assert_int_eq(array_list_index_of(list, array_list_get(list, idx), &index), E_SUCCESS);
+        ck_assert_int_eq(index, idx);
+    }
+
+    int gone = 10;
+    ck_assert(!array_list_contains(list, &gone));
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure a pointer list of strings can be indexed
+START_TEST(test_array_list_hash_index_strings)
+{
+    size_t index = 0;
+
+    array_list_options_t options = {0};
+    options.hash = &str_hash_ctx;
+
+    array_list_t *list = array_list_create_with_options(&options, NULL, &str_eq_ctx);
+
+    const char *words[] = {"hello", "world", "I", "am", "big", "chungus"};
+    array_list_push_many(list, words, 6);
+
+    char key[] = "big";
+    ck_assert_int_eq(array_list_index_of(list, key, &index), E_SUCCESS);
+    ck_assert_int_eq(index, 4);
+
+    char missing[] = "small";
+    ck_assert(!array_list_contains(list, missing));
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure raw int lists are searched on the low 32 bits at every offset, including the tail
+START_TEST(test_array_list_word_search_raw_int)
+{
+    size_t index = 0;
+
+    array_list_t *list = array_list_create(NULL, &raw_int_eq_ctx);
+
+    for (int num = 1; num <= 37; num++)
+    {
+        push(list, (void *) (uintptr_t) num);
+    }
+
+    for (int num = 1; num <= 37; num++)
+    {
+        ck_assert_int_eq(array_list_index_of(list, (void *) (uintptr_t) num, &index), E_SUCCESS);
+        ck_assert_int_eq(index, num - 1);
+    }
+
+    ck_assert(!array_list_contains(list, (void *) (uintptr_t) 38));
+
+    // a negative int stored through uintptr_t still matches the same int
+    int negative = -7;
+    push(list, (void *) (uintptr_t) negative);
+    ck_assert(array_list_contains(list, (void *) (uintptr_t) (uint32_t) negative));
+    ck_assert_int_eq(array_list_index_of(list, (void *) (uintptr_t) negative, &index), E_SUCCESS);
+    ck_assert_int_eq(index, 37);
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure count agrees across the word search, the hash index and the equal callback
+START_TEST(test_array_list_count)
+{
+    int values[] = {3, 1, 3, 3, 2, 3, 1, 3, 3, 3, 3};
+
+    array_list_t *raw_list = array_list_create(NULL, &raw_size_t_eq_ctx);
+    array_list_t *typed_list = array_list_create_typed(sizeof(int), NULL, &int_eq_ctx);
+
+    array_list_options_t options = {0};
+    options.element_size = sizeof(int);
+    options.hash = &int_hash_ctx;
+    array_list_t *hashed_list = array_list_create_with_options(&options, NULL, &int_eq_ctx);
+
+    for (size_t idx = 0; idx < 11; idx++)
+    {
+        push(raw_list, (void *) (uintptr_t) values[idx]);
+        push(typed_list, &values[idx]);
+        push(hashed_list, &values[idx]);
+    }
+
+    int key = 3;
+    ck_assert_int_eq(array_list_count(raw_list, (void *) (uintptr_t) key), 8);
+    ck_assert_int_eq(array_list_count(typed_list, &key), 8);
+    ck_assert_int_eq(array_list_count(hashed_list, &key), 8);
+
+    key = 2;
+    ck_assert_int_eq(array_list_count(raw_list, (void *) (uintptr_t) key), 1);
+    ck_assert_int_eq(array_list_count(hashed_list, &key), 1);
+
+    key = 9;
+    ck_assert_int_eq(array_list_count(raw_list, (void *) (uintptr_t) key), 0);
+    ck_assert_int_eq(array_list_count(typed_list, &key), 0);
+    ck_assert_int_eq(array_list_count(NULL, &key), 0);
+
+    array_list_destroy(&raw_list);
+    array_list_destroy(&typed_list);
+    array_list_destroy(&hashed_list);
+}
+END_TEST
+
+// ensure naive lists match by address, not by content
+START_TEST(test_array_list_word_search_identity)
+{
+    size_t index = 0;
+    int values[20] = {0};
+    int copy = 0;
+
+    array_list_t *list = array_list_create(NULL, &naive_eq_ctx);
+
+    for (size_t idx = 0; idx < 20; idx++)
+    {
+        push(list, &values[idx]);
+    }
+
+    ck_assert_int_eq(array_list_index_of(list, &values[13], &index), E_SUCCESS);
+    ck_assert_int_eq(index, 13);
+    ck_assert(!array_list_contains(list, &copy));
+    ck_assert_int_eq(array_list_count(list, &values[19]), 1);
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// TEST LIST
+static TFun array_list_search_tests[] =
+{
+    test_array_list_index_of_linear,
+    test_array_list_hash_requires_equal,
+    test_array_list_hash_index_tracks_edits,
+    test_array_list_hash_index_tail_removes,
+    test_array_list_hash_index_strings,
+    test_array_list_word_search_raw_int,
+    test_array_list_count,
+    test_array_list_word_search_identity,
+    NULL
+};
+
+// SORT TESTS
+//***********************************************************************************************
+// ensure a typed list sorts with the compare called on slot addresses
+START_TEST(test_array_list_sort_typed)
+{
+    exit_code_t exit_code = E_DEFAULT_ERROR;
+    array_list_t *list = array_list_create_typed(sizeof(int), NULL, &int_eq_ctx);
+
+    for (int num = 0; num < 1000; num++)
+    {
+        int value = (num * 7919) % 1000;
+        push(list, &value);
+    }
+
+    exit_code = array_list_sort(list, &int_comp_ctx);
+    ck_assert_int_eq(exit_code, E_SUCCESS);
+
+    for (size_t idx = 0; idx < 1000; idx++)
+    {
+        ck_assert_int_eq(*(int *)array_list_get(list, idx), idx);
+    }
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure a context-carrying comparator such as inv_comp is honoured
+START_TEST(test_array_list_sort_inverse)
+{
+    compare_ctx descending = {inv_comp, &raw_int_comp_ctx};
+    array_list_t *list = array_list_create(NULL, &raw_int_eq_ctx);
+
+    for (int num = 0; num < 300; num++)
+    {
+        push(list, (void *)(uintptr_t)((num * 31) % 100 + 1)); // plenty of duplicates
+    }
+
+    ck_assert_int_eq(array_list_sort(list, &descending), E_SUCCESS);
+
+    for (size_t idx = 1; idx < 300; idx++)
+    {
+        ck_assert_int_ge((int)(uintptr_t)array_list_get(list, idx - 1), (int)(uintptr_t)array_list_get(list, idx));
+    }
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure a pointer list compares the stored pointers, not the slots
+START_TEST(test_array_list_sort_strings)
+{
+    array_list_t *list = array_list_create(NULL, &str_eq_ctx);
+
+    const char *words[] = {"pear", "apple", "fig", "banana", "cherry"};
+    array_list_push_many(list, words, 5);
+
+    ck_assert_int_eq(array_list_sort(list, &str_comp_ctx), E_SUCCESS);
+    ck_assert_str_eq(array_list_get(list, 0), "apple");
+    ck_assert_str_eq(array_list_get(list, 1), "banana");
+    ck_assert_str_eq(array_list_get(list, 4), "pear");
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure the parallel sort agrees with the sequential one on a large list
+START_TEST(test_array_list_sort_parallel)
+{
+    size_t count = PARALLEL_SORT_THRESHOLD * 4 + 3;
+    array_list_t *sequential = array_list_create_typed(sizeof(int), NULL, &int_eq_ctx);
+    array_list_t *parallel = array_list_create_typed(sizeof(int), NULL, &int_eq_ctx);
+
+    srand(7);
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        int value = rand() % 5000;
+        push(sequential, &value);
+        push(parallel, &value);
+    }
+
+    ck_assert_int_eq(array_list_sort(sequential, &int_comp_ctx), E_SUCCESS);
+    ck_assert_int_eq(array_list_sort_parallel(parallel, &int_comp_ctx, 3), E_SUCCESS);
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        ck_assert_int_eq(*(int *)array_list_get(parallel, idx), *(int *)array_list_get(sequential, idx));
+    }
+
+    // 0 threads picks one per CPU
+    compare_ctx descending = {inv_comp, &int_comp_ctx};
+    ck_assert_int_eq(array_list_sort_parallel(parallel, &descending, 0), E_SUCCESS);
+    ck_assert_int_eq(*(int *)array_list_get(parallel, 0), *(int *)array_list_get(sequential, count - 1));
+
+    array_list_destroy(&sequential);
+    array_list_destroy(&parallel);
+}
+END_TEST
+
+// ensure the hash index points at the new positions after a sort
+START_TEST(test_array_list_sort_rebuilds_index)
+{
+    size_t index = 0;
+
+    array_list_options_t options = {0};
+    options.element_size = sizeof(int);
+    options.hash = &int_hash_ctx;
+    array_list_t *list = array_list_create_with_options(&options, NULL, &int_eq_ctx);
+
+    for (int num = 99; num >= 0; num--)
+    {
+        push(list, &num);
+    }
+
+    ck_assert_int_eq(array_list_sort(list, &int_comp_ctx), E_SUCCESS);
+
+    for (int num = 0; num < 100; num++)
+    {
+        ck_assert_int_eq(array_list_index_of(list, &num, &index), E_SUCCESS);
+        ck_assert_int_eq(index, num);
+    }
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure bad arguments are rejected
+START_TEST(test_array_list_sort_invalid)
+{
+    array_list_t *list = array_list_create(NULL, NULL);
+
+    ck_assert_int_eq(array_list_sort(NULL, &int_comp_ctx), E_LIST_ERROR);
+    ck_assert_int_eq(array_list_sort(list, NULL), E_NULL_POINTER);
+    ck_assert_int_eq(array_list_sort_parallel(list, NULL, 2), E_NULL_POINTER);
+    ck_assert_int_eq(array_list_sort(list, &int_comp_ctx), E_SUCCESS); // empty list
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// TEST LIST
+static TFun array_list_sort_tests[] =
+{
+    test_array_list_sort_typed,
+    test_array_list_sort_inverse,
+    test_array_list_sort_strings,
+    test_array_list_sort_parallel,
+    test_array_list_sort_rebuilds_index,
+    test_array_list_sort_invalid,
+    NULL
+};
+
+// SORTED TESTS
+//***********************************************************************************************
+// ensure pushes land in order and lookups use the list's comparator
+START_TEST(test_array_list_sorted_push)
+{
+    size_t index = 0;
+    array_list_t *list = array_list_create_sorted(&raw_int_comp_ctx, NULL);
+    ck_assert_ptr_ne(list, NULL);
+
+    for (int num = 0; num < 200; num++)
+    {
+        ck_assert_int_eq(push(list, (void *)(uintptr_t)((num * 37) % 100 + 1)), E_SUCCESS);
+    }
+
+    for (size_t idx = 1; idx < array_list_size(list); idx++)
+    {
+        ck_assert_int_le((int)(uintptr_t)array_list_get(list, idx - 1), (int)(uintptr_t)array_list_get(list, idx));
+    }
+
+    // no equal_ctx was given, the comparator answers instead
+    ck_assert(array_list_contains(list, (void *)(uintptr_t)50));
+    ck_assert(!array_list_contains(list, (void *)(uintptr_t)101));
+    ck_assert_int_eq(array_list_index_of(list, (void *)(uintptr_t)50, &index), E_SUCCESS);
+    ck_assert_int_eq(index, 98);
+    ck_assert_int_eq(array_list_count(list, (void *)(uintptr_t)50), 2);
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure the bounds bracket runs of equal elements, including at both ends
+START_TEST(test_array_list_sorted_bounds)
+{
+    size_t first = 0;
+    size_t last = 0;
+
+    array_list_options_t options = {0};
+    options.element_size = sizeof(int);
+    options.order = &int_comp_ctx;
+    array_list_t *list = array_list_create_with_options(&options, NULL, NULL);
+
+    int values[] = {5, 1, 3, 3, 3, 9, 7};
+    ck_assert_int_eq(array_list_push_many(list, values, 7), E_SUCCESS); // 1 3 3 3 5 7 9
+
+    int key = 3;
+    ck_assert_int_eq(array_list_equal_range(list, &key, &first, &last), E_SUCCESS);
+    ck_assert_int_eq(first, 1);
+    ck_assert_int_eq(last, 4);
+
+    key = 4;
+    array_list_equal_range(list, &key, &first, &last);
+    ck_assert_int_eq(first, 4);
+    ck_assert_int_eq(last, 4);
+
+    key = 0;
+    array_list_lower_bound(list, &key, &first);
+    ck_assert_int_eq(first, 0);
+
+    key = 9;
+    array_list_upper_bound(list, &key, &last);
+    ck_assert_int_eq(last, 7);
+
+    // unsorted lists have no bounds
+    array_list_t *unsorted = array_list_create_typed(sizeof(int), NULL, &int_eq_ctx);
+    ck_assert_int_eq(array_list_lower_bound(unsorted, &key, &first), E_INVALID_INPUT);
+
+    array_list_destroy(&unsorted);
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure positional edits and batches cannot break the order
+START_TEST(test_array_list_sorted_rejects_out_of_order)
+{
+    array_list_options_t options = {0};
+    options.element_size = sizeof(int);
+    options.order = &int_comp_ctx;
+    array_list_t *list = array_list_create_with_options(&options, NULL, NULL);
+
+    int values[] = {10, 20, 30};
+    array_list_push_many(list, values, 3);
+
+    int fits = 15;
+    int too_big = 25;
+    ck_assert_int_eq(array_list_insert(list, 1, &too_big), E_OUT_OF_ORDER);
+    ck_assert_int_eq(array_list_insert(list, 1, &fits), E_SUCCESS); // 10 15 20 30
+
+    ck_assert_int_eq(array_list_set(list, 2, &too_big), E_SUCCESS);
+    ck_assert_int_eq(array_list_set(list, 0, &too_big), E_OUT_OF_ORDER);
+
+    int batch[] = {31, 35, 33};
+    ck_assert_int_eq(array_list_insert_range(list, 4, batch, 3), E_OUT_OF_ORDER);
+    batch[2] = 40;
+    ck_assert_int_eq(array_list_insert_range(list, 4, batch, 3), E_SUCCESS);
+    ck_assert_int_eq(array_list_size(list), 7);
+
+    compare_ctx descending = {inv_comp, &int_comp_ctx};
+    ck_assert_int_eq(array_list_sort(list, &int_comp_ctx), E_SUCCESS);
+    ck_assert_int_eq(array_list_sort(list, &descending), E_OUT_OF_ORDER);
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure unique lists refuse duplicates and need an order
+START_TEST(test_array_list_sorted_unique)
+{
+    array_list_options_t options = {0};
+    options.unique = true;
+    ck_assert_ptr_eq(array_list_create_with_options(&options, NULL, NULL), NULL);
+
+    options.order = &str_comp_ctx;
+    array_list_t *list = array_list_create_with_options(&options, NULL, NULL);
+
+    char first[] = "kiwi";
+    char again[] = "kiwi";
+    char other[] = "lime";
+    ck_assert_int_eq(push(list, first), E_SUCCESS);
+    ck_assert_int_eq(push(list, other), E_SUCCESS);
+    ck_assert_int_eq(push(list, again), E_KEY_ALREADY_EXISTS);
+    ck_assert_int_eq(array_list_set(list, 1, again), E_KEY_ALREADY_EXISTS);
+    ck_assert_int_eq(array_list_set(list, 0, again), E_SUCCESS); // replacing the key with itself is fine
+    ck_assert_int_eq(array_list_size(list), 2);
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+typedef struct tagged
+{
+    int key;
+    int tag; // tells equal keys apart
+} tagged_t;
+
+static int compare_keys(const void *x, const void *y, const void *ctx)
+{
+    (void) ctx;
+    const tagged_t *first = x;
+    const tagged_t *second = y;
+    return (first->key > second->key) - (first->key < second->key);
+}
+
+static compare_ctx key_comp_ctx = {compare_keys, NULL};
+
+// ensure a batch merges in stably and unique lists keep everything before the first duplicate
+START_TEST(test_array_list_sorted_push_many)
+{
+    array_list_options_t options = {0};
+    options.element_size = sizeof(tagged_t);
+    options.order = &key_comp_ctx;
+    array_list_t *list = array_list_create_with_options(&options, NULL, NULL);
+
+    tagged_t stored[] = {{2, 0}, {4, 1}, {6, 2}};
+    ck_assert_int_eq(array_list_push_many(list, stored, 3), E_SUCCESS);
+
+    // equal keys land after the stored ones, in the batch's own order
+    tagged_t batch[] = {{4, 3}, {7, 4}, {1, 5}, {4, 6}, {2, 7}};
+    ck_assert_int_eq(array_list_push_many(list, batch, 5), E_SUCCESS);
+
+    int keys[] = {1, 2, 2, 4, 4, 4, 6, 7};
+    int tags[] = {5, 0, 7, 1, 3, 6, 2, 4};
+    ck_assert_int_eq(array_list_size(list), 8);
+    for (size_t idx = 0; idx < 8; idx++)
+    {
+        tagged_t *item = array_list_get(list, idx);
+        ck_assert_int_eq(item->key, keys[idx]);
+        ck_assert_int_eq(item->tag, tags[idx]);
+    }
+    array_list_destroy(&list);
+
+    options.element_size = sizeof(int);
+    options.order = &int_comp_ctx;
+    options.unique = true;
+    list = array_list_create_with_options(&options, NULL, NULL);
+
+    int values[] = {10, 20};
+    ck_assert_int_eq(array_list_push_many(list, values, 2), E_SUCCESS);
+
+    // 20 is already stored, so 5 and 30 go in and the rest do not
+    int clash_stored[] = {5, 30, 20, 1, 40};
+    ck_assert_int_eq(array_list_push_many(list, clash_stored, 5), E_KEY_ALREADY_EXISTS);
+
+    // the second 7 repeats the first, so 7 and 8 go in
+    int clash_batch[] = {7, 8, 7, 2};
+    ck_assert_int_eq(array_list_push_many(list, clash_batch, 4), E_KEY_ALREADY_EXISTS);
+
+    int expected[] = {5, 7, 8, 10, 20, 30};
+    ck_assert_int_eq(array_list_size(list), 6);
+    for (size_t idx = 0; idx < 6; idx++)
+    {
+        ck_assert_int_eq(*(int *)array_list_get(list, idx), expected[idx]);
+    }
+
+    // a leading duplicate leaves the list untouched
+    ck_assert_int_eq(array_list_push_many(list, values, 2), E_KEY_ALREADY_EXISTS);
+    ck_assert_int_eq(array_list_size(list), 6);
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// TEST LIST
+static TFun array_list_sorted_tests[] =
+{
+    test_array_list_sorted_push,
+    test_array_list_sorted_bounds,
+    test_array_list_sorted_rejects_out_of_order,
+    test_array_list_sorted_unique,
+    test_array_list_sorted_push_many,
+    NULL
+};
+
+// BULK EDIT TESTS
+//***********************************************************************************************
+static bool is_even(const void *data, const void *ctx)
+{
+    (void) ctx;
+    return 0 == (*(const int *)data % 2);
+}
+
+static bool raw_is_multiple(const void *data, const void *ctx)
+{
+    return 0 == ((uintptr_t)data % *(const uintptr_t *)ctx);
+}
+
+static void *add_ten(void *data, const void *ctx)
+{
+    (void) ctx;
+    *(int *)data += 10;
+    return data;
+}
+
+static void *raw_double(void *data, const void *ctx)
+{
+    (void) ctx;
+    return (void *)((uintptr_t)data * 2);
+}
+
+// ensure remove_if keeps the survivors in order and destroys only the removed elements
+START_TEST(test_array_list_remove_if)
+{
+    size_t removed = 0;
+    uintptr_t divisor = 3;
+    predicate_ctx multiple_of_three = {raw_is_multiple, &divisor};
+
+    many_items = 0;
+    array_list_t *list = array_list_create(&count_destroy_many_ctx, &raw_size_t_eq_ctx);
+
+    for (uintptr_t num = 1; num <= 100; num++)
+    {
+        push(list, (void *)num);
+    }
+
+    ck_assert_int_eq(array_list_remove_if(list, &multiple_of_three, &removed), E_SUCCESS);
+    ck_assert_int_eq(removed, 33);
+    ck_assert_int_eq(many_items, 33);
+    ck_assert_int_eq(array_list_size(list), 67);
+
+    for (size_t idx = 0; idx < array_list_size(list); idx++)
+    {
+        uintptr_t value = (uintptr_t)array_list_get(list, idx);
+        ck_assert_int_ne(value % 3, 0);
+        ck_assert_int_eq(value, idx + (idx / 2) + 1);
+    }
+
+    ck_assert_int_eq(array_list_remove_if(list, NULL, NULL), E_NULL_POINTER);
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure partition splits a typed list and the hash index follows the moves
+START_TEST(test_array_list_partition)
+{
+    size_t split = 0;
+    size_t index = 0;
+    predicate_ctx even = {is_even, NULL};
+
+    array_list_options_t options = {0};
+    options.element_size = sizeof(int);
+    options.hash = &int_hash_ctx;
+    array_list_t *list = array_list_create_with_options(&options, NULL, &int_eq_ctx);
+
+    for (int num = 0; num < 51; num++)
+    {
+        push(list, &num);
+    }
+
+    ck_assert_int_eq(array_list_partition(list, &even, &split), E_SUCCESS);
+    ck_assert_int_eq(split, 26);
+
+    for (size_t idx = 0; idx < 51; idx++)
+    {
+        int value = *(int *)array_list_get(list, idx);
+        ck_assert(is_even(&value, NULL) == (idx < split));
+        ck_assert_int_eq(array_list_index_of(list, &value, &index), E_SUCCESS);
+        ck_assert_int_eq(index, idx);
+    }
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// ensure map updates typed slots in place and replaces stored pointers
+START_TEST(test_array_list_map_inplace)
+{
+    map_ctx plus_ten = {add_ten, NULL};
+    map_ctx doubled = {raw_double, NULL};
+
+    array_list_t *typed = array_list_create_typed(sizeof(int), NULL, NULL);
+    array_list_t *raw = array_list_create(NULL, NULL);
+
+    for (int num = 1; num <= 10; num++)
+    {
+        push(typed, &num);
+        push(raw, (void *)(uintptr_t)num);
+    }
+
+    ck_assert_int_eq(array_list_map_inplace(typed, &plus_ten), E_SUCCESS);
+    ck_assert_int_eq(array_list_map_inplace(raw, &doubled), E_SUCCESS);
+
+    for (size_t idx = 0; idx < 10; idx++)
+    {
+        ck_assert_int_eq(*(int *)array_list_get(typed, idx), idx + 11);
+        ck_assert_int_eq((uintptr_t)array_list_get(raw, idx), (idx + 1) * 2);
+    }
+
+    // sorted lists would lose their order
+    array_list_t *sorted = array_list_create_sorted(&raw_int_comp_ctx, NULL);
+    ck_assert_int_eq(array_list_map_inplace(sorted, &doubled), E_OUT_OF_ORDER);
+
+    array_list_destroy(&sorted);
+    array_list_destroy(&typed);
+    array_list_destroy(&raw);
+}
+END_TEST
+
+// ensure unique collapses runs of equal elements, including a trailing run
+START_TEST(test_array_list_unique)
+{
+    size_t removed = 0;
+    int values[] = {1, 1, 2, 3, 3, 3, 1, 4, 4};
+    int expected[] = {1, 2, 3, 1, 4};
+
+    array_list_t *list = array_list_create_typed(sizeof(int), NULL, &int_eq_ctx);
+    array_list_push_many(list, values, 9);
+
+    ck_assert_int_eq(array_list_unique(list, &removed), E_SUCCESS);
+    ck_assert_int_eq(removed, 4);
+    ck_assert_int_eq(array_list_size(list), 5);
+
+    for (size_t idx = 0; idx < 5; idx++)
+    {
+        ck_assert_int_eq(*(int *)array_list_get(list, idx), expected[idx]);
+    }
+
+    // sorted lists compare with their order and need no equal
+    array_list_t *sorted = array_list_create_sorted(&raw_int_comp_ctx, &count_destroy_many_ctx);
+    many_items = 0;
+    for (int num = 0; num < 30; num++)
+    {
+        push(sorted, (void *)(uintptr_t)(num % 4 + 1));
+    }
+    ck_assert_int_eq(array_list_unique(sorted, &removed), E_SUCCESS);
+    ck_assert_int_eq(removed, 26);
+    ck_assert_int_eq(many_items, 26);
+
+    array_list_t *no_equal = array_list_create(NULL, NULL);
+    ck_assert_int_eq(array_list_unique(no_equal, NULL), E_NULL_POINTER);
+
+    array_list_destroy(&no_equal);
+    array_list_destroy(&sorted);
+    array_list_destroy(&list);
+}
+END_TEST
+
+// TEST LIST
+static TFun array_list_bulk_tests[] =
+{
+    test_array_list_remove_if,
+    test_array_list_partition,
+    test_array_list_map_inplace,
+    test_array_list_unique,
+    NULL
+};
+
+// ARRAY_LIST SNAPSHOT TESTS
+//***********************************************************************************************
+START_TEST(test_array_list_snapshot_copy_on_write)
+{
+    array_list_t *list = array_list_create_typed(sizeof(int), NULL, NULL);
+
+    for (int num = 0; num < 100; num++)
+    {
+        array_list_push_many(list, &num, 1);
+    }
+
+    array_list_snapshot_t *snapshot = array_list_snapshot(list);
+    ck_assert_ptr_nonnull(snapshot);
+    ck_assert_int_eq(array_list_snapshot_size(snapshot), 100);
+
+    // No writes in between, so both snapshots are the same view
+    array_list_snapshot_t *again = array_list_snapshot(list);
+    ck_assert_ptr_eq(again, snapshot);
+    array_list_snapshot_release(&again);
+    ck_assert_ptr_null(again);
+
+    // Writes go to a private copy and leave the snapshot as it was
+    int changed = 999;
+    ck_assert_int_eq(array_list_set(list, 0, &changed), E_SUCCESS);
+    ck_assert_int_eq(array_list_remove(list, 99), E_SUCCESS);
+    ck_assert_int_eq(*(int *)array_list_get(list, 0), 999);
+    ck_assert_int_eq(array_list_size(list), 99);
+
+    ck_assert_int_eq(array_list_snapshot_size(snapshot), 100);
+    for (int idx = 0; idx < 100; idx++)
+    {
+        ck_assert_int_eq(*(const int *)array_list_snapshot_get(snapshot, idx), idx);
+    }
+    ck_assert_ptr_null(array_list_snapshot_get(snapshot, 100));
+
+    // The snapshot outlives the list
+    array_list_destroy(&list);
+    ck_assert_int_eq(*(const int *)array_list_snapshot_get(snapshot, 42), 42);
+    array_list_snapshot_release(&snapshot);
+}
+END_TEST
+
+START_TEST(test_array_list_snapshot_released_before_write)
+{
+    array_list_t *list = array_list_create_typed(sizeof(int), NULL, NULL);
+
+    for (int num = 0; num < 100; num++)
+    {
+        array_list_push_many(list, &num, 1);
+    }
+
+    void *before = array_list_get(list, 0);
+    array_list_snapshot_t *snapshot = array_list_snapshot(list);
+    array_list_snapshot_release(&snapshot);
+
+    // With no readers left the list takes its buffer back without copying it
+    int changed = 7;
+    ck_assert_int_eq(array_list_set(list, 0, &changed), E_SUCCESS);
+    ck_assert_ptr_eq(array_list_get(list, 0), before);
+
+    array_list_snapshot_release(&snapshot);
+    array_list_snapshot_release(NULL);
+    ck_assert_ptr_null(array_list_snapshot(NULL));
+    ck_assert_int_eq(array_list_snapshot_size(NULL), 0);
+    ck_assert_ptr_null(array_list_snapshot_get(NULL, 0));
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+START_TEST(test_array_list_snapshot_small_and_mapped)
+{
+    // Inline storage cannot be shared, so the snapshot copies it
+    array_list_t *small = array_list_create(NULL, &raw_size_t_eq_ctx);
+    push(small, (void *)1);
+    push(small, (void *)2);
+
+    array_list_snapshot_t *small_snapshot = array_list_snapshot(small);
+    push(small, (void *)3);
+    array_list_remove(small, 0);
+
+    ck_assert_int_eq(array_list_snapshot_size(small_snapshot), 2);
+    ck_assert_ptr_eq(array_list_snapshot_get(small_snapshot, 0), (void *)1);
+    ck_assert_ptr_eq(array_list_snapshot_get(small_snapshot, 1), (void *)2);
+
+    array_list_destroy(&small);
+    array_list_snapshot_release(&small_snapshot);
+
+    // A mapped buffer is shared and unmapped by whoever lets go of it last
+    array_list_options_t options = {0};
+    options.element_size = sizeof(size_t);
+    options.mmap_threshold = 4096;
+    array_list_t *large = array_list_create_with_options(&options, NULL, NULL);
+
+    for (size_t num = 0; num < 10000; num++)
+    {
+        array_list_push_many(large, &num, 1);
+    }
+
+    array_list_snapshot_t *large_snapshot = array_list_snapshot(large);
+    for (size_t num = 0; num < 10000; num++)
+    {
+        array_list_push_many(large, &num, 1);
+    }
+
+    ck_assert_int_eq(array_list_size(large), 20000);
+    ck_assert_int_eq(array_list_snapshot_size(large_snapshot), 10000);
+    ck_assert_int_eq(*(const size_t *)array_list_snapshot_get(large_snapshot, 9999), 9999);
+
+    array_list_snapshot_release(&large_snapshot);
+    array_list_destroy(&large);
+}
+END_TEST
+
+static void *sum_snapshot(void *arg)
+{
+    array_list_snapshot_t *snapshot = arg;
+    size_t *sum = calloc(1, sizeof(size_t));
+
+    for (size_t idx = 0; idx < array_list_snapshot_size(snapshot); idx++)
+    {
+        *sum += *(const size_t *)array_list_snapshot_get(snapshot, idx);
+    }
+
+    array_list_snapshot_release(&snapshot);
+    return sum;
+}
+
+START_TEST(test_array_list_snapshot_threaded_readers)
+{
+    enum { NUM_READERS = 4, NUM_ROUNDS = 50, PER_ROUND = 1000 };
+    pthread_t readers[NUM_READERS];
+    size_t expected[NUM_READERS];
+    array_list_t *list = array_list_create_typed(sizeof(size_t), NULL, NULL);
+
+    for (size_t round = 0; round < NUM_ROUNDS; round++)
+    {
+        for (size_t num = 0; num < PER_ROUND; num++)
+        {
+            array_list_push_many(list, &num, 1);
+        }
+
+        // Each reader gets its own reference and sums while the writer keeps going
+        array_list_snapshot_t *snapshot = array_list_snapshot(list);
+        for (size_t idx = 0; idx < NUM_READERS; idx++)
+        {
+            expected[idx] = (round + 1) * (PER_ROUND * (PER_ROUND - 1) / 2);
+            pthread_create(&readers[idx], NULL, sum_snapshot, array_list_snapshot_retain(snapshot));
+        }
+        array_list_snapshot_release(&snapshot);
+
+        size_t zero = 0;
+        for (size_t idx = 0; idx < array_list_size(list); idx += 7)
+        {
+            array_list_set(list, idx, &zero);
+        }
+
+        for (size_t idx = 0; idx < NUM_READERS; idx++)
+        {
+            size_t *sum = NULL;
+            pthread_join(readers[idx], (void **)&sum);
+            ck_assert_int_eq(*sum, expected[idx]);
+            free(sum);
+        }
+
+        // Put the zeroed elements back so every round starts from the same values
+        for (size_t idx = 0; idx < array_list_size(list); idx += 7)
+        {
+            size_t value = idx % PER_ROUND;
+            array_list_set(list, idx, &value);
+        }
+    }
+
+    array_list_destroy(&list);
+}
+END_TEST
+
+// TEST LIST
+static TFun array_list_snapshot_tests[] =
+{
+    test_array_list_snapshot_copy_on_write,
+    test_array_list_snapshot_released_before_write,
+    test_array_list_snapshot_small_and_mapped,
+    test_array_list_snapshot_threaded_readers,
+    NULL
+};
+
+// ARRAY_LIST FILE TESTS
+//***********************************************************************************************
+START_TEST(test_array_list_save_and_map)
+{
+    char path[] = "/tmp/array_list_save_XXXXXX";
+    int fd = mkstemp(path);
+    ck_assert_int_ne(fd, -1);
+    close(fd);
+
+    array_list_t *list = array_list_create_typed(sizeof(size_t), NULL, &raw_size_t_eq_ctx);
+    for (size_t num = 0; num < 5000; num++)
+    {
+        size_t value = num * 3;
+        array_list_push_many(list, &value, 1);
+    }
+
+    ck_assert_int_eq(array_list_save(list, path), E_SUCCESS);
+    ck_assert_int_eq(array_list_verify_file(path), E_SUCCESS);
+    array_list_destroy(&list);
+
+    array_list_t *mapped = array_list_map(path, NULL, NULL);
+    ck_assert_ptr_nonnull(mapped);
+    ck_assert_int_eq(array_list_size(mapped), 5000);
+    ck_assert_int_eq(*(size_t *)array_list_get(mapped, 4999), 4999 * 3);
+
+    // Writes go to a private copy; the file keeps what was saved
+    size_t extra = 1;
+    ck_assert_int_eq(array_list_set(mapped, 0, &extra), E_SUCCESS);
+    ck_assert_int_eq(array_list_push_many(mapped, &extra, 1), E_SUCCESS);
+    ck_assert_int_eq(*(size_t *)array_list_get(mapped, 0), 1);
+    ck_assert_int_eq(array_list_size(mapped), 5001);
+    ck_assert_int_eq(array_list_verify_file(path), E_SUCCESS);
+
+    // Saving over the file this list came from is safe
+    ck_assert_int_eq(array_list_save(mapped, path), E_SUCCESS);
+    array_list_t *reloaded = array_list_map(path, NULL, NULL);
+    ck_assert_int_eq(array_list_size(reloaded), 5001);
+    ck_assert_int_eq(*(size_t *)array_list_get(reloaded, 0), 1);
+
+    array_list_destroy(&mapped);
+    array_list_destroy(&reloaded);
+    remove(path);
+}
+END_TEST
+
+START_TEST(test_array_list_map_rejects_bad_files)
+{
+    char path[] = "/tmp/array_list_map_XXXXXX";
+    int fd = mkstemp(path);
+    ck_assert_int_ne(fd, -1);
+    close(fd);
+
+    array_list_t *pointers = array_list_create(NULL, NULL);
+    push(pointers, (void *)1);
+    ck_assert_int_eq(array_list_save(pointers, path), E_INVALID_INPUT);
+    ck_assert_int_eq(array_list_save(NULL, path), E_LIST_ERROR);
+    ck_assert_int_eq(array_list_save(pointers, NULL), E_NULL_POINTER);
+    array_list_destroy(&pointers);
+
+    // An empty file has no header
+    ck_assert_ptr_null(array_list_map(path, NULL, NULL));
+    ck_assert_int_ne(array_list_verify_file(path), E_SUCCESS);
+    ck_assert_ptr_null(array_list_map("/tmp/does/not/exist", NULL, NULL));
+    ck_assert_ptr_null(array_list_map(NULL, NULL, NULL));
+
+    array_list_t *list = array_list_create_typed(sizeof(int), NULL, NULL);
+    for (int num = 0; num < 100; num++)
+    {
+        array_list_push_many(list, &num, 1);
+    }
+    ck_assert_int_eq(array_list_save(list, path), E_SUCCESS);
+    array_list_destroy(&list);
+
+    // A flipped payload byte fails the checksum but not the (cheap) map
+    FILE *file = fopen(path, "r+b");
+    fseek(file, -1, SEEK_END);
+    fputc(0x7f, file);
+    fclose(file);
+    ck_assert_int_eq(array_list_verify_file(path), E_INVALID_INPUT);
+
+    array_list_t *mapped = array_list_map(path, NULL, NULL);
+    ck_assert_ptr_nonnull(mapped);
+    array_list_destroy(&mapped);
+
+    // A truncated file no longer matches its header
+    ck_assert_int_eq(truncate(path, 4096 + 10), 0);
+    ck_assert_ptr_null(array_list_map(path, NULL, NULL));
+
+    remove(path);
+}
+END_TEST
+
+// Rewrites a saved list so its elements start at payload_offset, keeping the header otherwise intact
+static void move_payload(const char *path, uint64_t payload_offset)
+{
+    unsigned char header[40] = {0}; // magic, element size, count, checksum, payload offset
+    int payload[100] = {0};
+
+    FILE *file = fopen(path, "rb");
+    ck_assert_ptr_nonnull(file);
+    ck_assert_int_eq(fread(header, sizeof(header), 1, file), 1);
+    uint64_t saved_offset = 0;
+    memcpy(&saved_offset, header + 32, sizeof(saved_offset));
+    fseek(file, (long)saved_offset, SEEK_SET);
+    ck_assert_int_eq(fread(payload, sizeof(payload), 1, file), 1);
+    fclose(file);
+
+    memcpy(header + 32, &payload_offset, sizeof(payload_offset));
+    unsigned char *contents = calloc(1, payload_offset + sizeof(payload));
+    memcpy(contents, header, (payload_offset < sizeof(header)) ? payload_offset : sizeof(header));
+    memcpy(contents + payload_offset, payload, sizeof(payload));
+
+    file = fopen(path, "wb");
+    ck_assert_ptr_nonnull(file);
+    ck_assert_int_eq(fwrite(contents, payload_offset + sizeof(payload), 1, file), 1);
+    fclose(file);
+    free(contents);
+}
+
+// ensure a header whose payload offset is not page-aligned, or overlaps the header, is rejected
+START_TEST(test_array_list_map_rejects_bad_offsets)
+{
+    char path[] = "/tmp/array_list_offset_XXXXXX";
+    int fd = mkstemp(path);
+    ck_assert_int_ne(fd, -1);
+    close(fd);
+
+    uint64_t offsets[] = {40, 4096 + 8, 16};
+    for (size_t idx = 0; idx < sizeof(offsets) / sizeof(offsets[0]); idx++)
+    {
+        array_list_t *list = array_list_create_typed(sizeof(int), NULL, NULL);
+        for (int num = 0; num < 100; num++)
+        {
+            array_list_push_many(list, &num, 1);
+        }
+        ck_assert_int_eq(array_list_save(list, path), E_SUCCESS);
+        array_list_destroy(&list);
+
+        // The sizes and checksum still add up, so only the offset itself gives it away
+        move_payload(path, offsets[idx]);
+        ck_assert_ptr_null(array_list_map(path, NULL, NULL));
+        ck_assert_int_ne(array_list_verify_file(path), E_SUCCESS);
+    }
+
+    remove(path);
+}
+END_TEST
+
+START_TEST(test_array_list_map_empty_list)
+{
+    char path[] = "/tmp/array_list_empty_XXXXXX";
+    int fd = mkstemp(path);
+    ck_assert_int_ne(fd, -1);
+    close(fd);
+
+    array_list_t *list = array_list_create_typed(sizeof(double), NULL, NULL);
+    ck_assert_int_eq(array_list_save(list, path), E_SUCCESS);
+    array_list_destroy(&list);
+
+    array_list_t *mapped = array_list_map(path, NULL, NULL);
+    ck_assert_ptr_nonnull(mapped);
+    ck_assert_int_eq(array_list_size(mapped), 0);
+
+    double value = 1.5;
+    ck_assert_int_eq(array_list_push_many(mapped, &value, 1), E_SUCCESS);
+    ck_assert_int_eq(array_list_size(mapped), 1);
+
+    array_list_destroy(&mapped);
+    remove(path);
+}
+END_TEST
+
+// TEST LIST
+static TFun array_list_file_tests[] =
+{
+    test_array_list_save_and_map,
+    test_array_list_map_rejects_bad_files,
+    test_array_list_map_rejects_bad_offsets,
+    test_array_list_map_empty_list,
+    NULL
+};
+
 static void add_tests(TCase * test_cases, TFun * test_functions)
 {
     while (* test_functions)
@@ -427,5 +2271,59 @@ Suite *array_list_test_suite(void)
     add_tests(array_list_set_test_cases, array_list_set_test_list);
     suite_add_tcase(array_list_test_suite, array_list_set_test_cases);
 
+    // Create typed array list tests
+    TFun *array_list_typed_test_list = array_list_typed_tests;
+    TCase *array_list_typed_test_cases = tcase_create(" array_list_create_typed() Tests");
+    add_tests(array_list_typed_test_cases, array_list_typed_test_list);
+    suite_add_tcase(array_list_test_suite, array_list_typed_test_cases);
+
+    // Create range tests
+    TFun *array_list_range_test_list = array_list_range_tests;
+    TCase *array_list_range_test_cases = tcase_create(" array_list range Tests");
+    add_tests(array_list_range_test_cases, array_list_range_test_list);
+    suite_add_tcase(array_list_test_suite, array_list_range_test_cases);
+
+    // Create capacity tests
+    TFun *array_list_capacity_test_list = array_list_capacity_tests;
+    TCase *array_list_capacity_test_cases = tcase_create(" array_list capacity Tests");
+    add_tests(array_list_capacity_test_cases, array_list_capacity_test_list);
+    suite_add_tcase(array_list_test_suite, array_list_capacity_test_cases);
+
+    // Create search tests
+    TFun *array_list_search_test_list = array_list_search_tests;
+    TCase *array_list_search_test_cases = tcase_create(" array_list search Tests");
+    add_tests(array_list_search_test_cases, array_list_search_test_list);
+    suite_add_tcase(array_list_test_suite, array_list_search_test_cases);
+
+    // Create sort tests
+    TFun *array_list_sort_test_list = array_list_sort_tests;
+    TCase *array_list_sort_test_cases = tcase_create(" array_list sort Tests");
+    add_tests(array_list_sort_test_cases, array_list_sort_test_list);
+    suite_add_tcase(array_list_test_suite, array_list_sort_test_cases);
+
+    // Create sorted tests
+    TFun *array_list_sorted_test_list = array_list_sorted_tests;
+    TCase *array_list_sorted_test_cases = tcase_create(" array_list_create_sorted() Tests");
+    add_tests(array_list_sorted_test_cases, array_list_sorted_test_list);
+    suite_add_tcase(array_list_test_suite, array_list_sorted_test_cases);
+
+    // Create bulk edit tests
+    TFun *array_list_bulk_test_list = array_list_bulk_tests;
+    TCase *array_list_bulk_test_cases = tcase_create(" array_list bulk edit Tests");
+    add_tests(array_list_bulk_test_cases, array_list_bulk_test_list);
+    suite_add_tcase(array_list_test_suite, array_list_bulk_test_cases);
+
+    // Create array_list snapshot tests
+    TFun *array_list_snapshot_test_list = array_list_snapshot_tests;
+    TCase *array_list_snapshot_test_cases = tcase_create(" array_list_snapshot() Tests");
+    add_tests(array_list_snapshot_test_cases, array_list_snapshot_test_list);
+    suite_add_tcase(array_list_test_suite, array_list_snapshot_test_cases);
+
+    // Create array_list file tests
+    TFun *array_list_file_test_list = array_list_file_tests;
+    TCase *array_list_file_test_cases = tcase_create(" array_list_save() / array_list_map() Tests");
+    add_tests(array_list_file_test_cases, array_list_file_test_list);
+    suite_add_tcase(array_list_test_suite, array_list_file_test_cases);
+
     return array_list_test_suite;
 }
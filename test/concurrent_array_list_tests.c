@@ -0,0 +1,189 @@
+#include <check.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "concurrent_array_list.h"
+#include "exit_codes.h"
+#include "utilities/comparison_helpers.h"
+
+#define NUM_THREADS 8
+#define PUSHES_PER_THREAD 20000
+
+// CREATE LIST TESTS
+//***********************************************************************************************
+// ensure a new concurrent array list is created
+START_TEST(test_concurrent_list_create)
+{
+    concurrent_array_list_t *list = concurrent_list_create(NULL, NULL);
+    ck_assert_ptr_ne(list, NULL);
+    ck_assert_int_eq(concurrent_list_size(list), 0);
+    ck_assert_ptr_eq(concurrent_list_get(list, 0), NULL);
+
+    concurrent_list_destroy(&list);
+    ck_assert_ptr_eq(list, NULL);
+}
+END_TEST
+
+// TEST LIST
+static TFun concurrent_list_create_tests[] =
+{
+    test_concurrent_list_create,
+    NULL
+};
+
+// PUSH TESTS
+//***********************************************************************************************
+START_TEST(test_concurrent_list_push_NULL)
+{
+    int num = 10;
+    concurrent_array_list_t *list = concurrent_list_create(NULL, NULL);
+
+    ck_assert_int_eq(concurrent_list_push(NULL, &num), E_LIST_ERROR);
+    ck_assert_int_eq(concurrent_list_push(list, NULL), E_NULL_POINTER);
+    ck_assert_int_eq(concurrent_list_size(list), 0);
+
+    concurrent_list_destroy(&list);
+}
+END_TEST
+
+// ensure a single thread sees its pushes in order
+START_TEST(test_concurrent_list_push_sequential)
+{
+    int num_array[50];
+    concurrent_array_list_t *list = concurrent_list_create(NULL, &int_eq_ctx);
+
+    for (int idx = 0; idx < 50; idx++)
+    {
+        num_array[idx] = idx;
+        ck_assert_int_eq(concurrent_list_push(list, &num_array[idx]), E_SUCCESS);
+    }
+
+    ck_assert_int_eq(concurrent_list_size(list), 50);
+
+    for (size_t idx = 0; idx < 50; idx++)
+    {
+        ck_assert_ptr_eq(concurrent_list_get(list, idx), &num_array[idx]);
+    }
+
+    int present = 49;
+    int absent = 50;
+    ck_assert(concurrent_list_contains(list, &present));
+    ck_assert(!concurrent_list_contains(list, &absent));
+
+    concurrent_list_destroy(&list);
+}
+END_TEST
+
+static void *push_worker(void *arg)
+{
+    concurrent_array_list_t *list = arg;
+
+    for (uintptr_t value = 1; value <= PUSHES_PER_THREAD; value++)
+    {
+        concurrent_list_push(list, (void *) value);
+    }
+
+    return NULL;
+}
+
+static void *read_worker(void *arg)
+{
+    concurrent_array_list_t *list = arg;
+    uintptr_t missing = 0;
+
+    // every index below the observed size must already hold a written element
+    while (concurrent_list_size(list) < NUM_THREADS * PUSHES_PER_THREAD)
+    {
+        size_t size = concurrent_list_size(list);
+        for (size_t idx = 0; idx < size; idx += 101)
+        {
+            missing += (NULL == concurrent_list_get(list, idx));
+        }
+    }
+
+    return (void *) missing;
+}
+
+// ensure concurrent pushers lose no elements and readers only see written slots
+START_TEST(test_concurrent_list_push_parallel)
+{
+    concurrent_array_list_t *list = concurrent_list_create(NULL, NULL);
+    pthread_t pushers[NUM_THREADS];
+    pthread_t reader;
+
+    pthread_create(&reader, NULL, read_worker, list);
+    for (size_t idx = 0; idx < NUM_THREADS; idx++)
+    {
+        pthread_create(&pushers[idx], NULL, push_worker, list);
+    }
+
+    for (size_t idx = 0; idx < NUM_THREADS; idx++)
+    {
+        pthread_join(pushers[idx], NULL);
+    }
+
+    void *missing = NULL;
+    pthread_join(reader, &missing);
+    ck_assert_ptr_eq(missing, NULL);
+
+    ck_assert_int_eq(concurrent_list_size(list), NUM_THREADS * PUSHES_PER_THREAD);
+
+    // every value was pushed once by every thread
+    size_t *seen = calloc(PUSHES_PER_THREAD + 1, sizeof(size_t));
+    for (size_t idx = 0; idx < NUM_THREADS * PUSHES_PER_THREAD; idx++)
+    {
+        uintptr_t value = (uintptr_t) concurrent_list_get(list, idx);
+        ck_assert_uint_ge(value, 1);
+        ck_assert_uint_le(value, PUSHES_PER_THREAD);
+        seen[value]++;
+    }
+
+    for (size_t value = 1; value <= PUSHES_PER_THREAD; value++)
+    {
+        ck_assert_uint_eq(seen[value], NUM_THREADS);
+    }
+
+    free(seen);
+    concurrent_list_destroy(&list);
+}
+END_TEST
+
+// TEST LIST
+static TFun concurrent_list_push_tests[] =
+{
+    test_concurrent_list_push_NULL,
+    test_concurrent_list_push_sequential,
+    test_concurrent_list_push_parallel,
+    NULL
+};
+
+static void add_tests(TCase * test_cases, TFun * test_functions)
+{
+    while (* test_functions)
+    {
+        // add the test from the core_tests array to the tcase
+        tcase_add_test(test_cases, * test_functions);
+        test_functions++;
+    }
+}
+
+Suite *concurrent_array_list_test_suite(void)
+{
+    Suite *concurrent_array_list_test_suite = suite_create("Concurrent Array List Tests");
+
+    // Create concurrent_list_create tests
+    TFun *concurrent_list_create_test_list = concurrent_list_create_tests;
+    TCase *concurrent_list_create_test_cases = tcase_create(" concurrent_list_create() Tests");
+    add_tests(concurrent_list_create_test_cases, concurrent_list_create_test_list);
+    suite_add_tcase(concurrent_array_list_test_suite, concurrent_list_create_test_cases);
+
+    // Create concurrent_list_push tests
+    TFun *concurrent_list_push_test_list = concurrent_list_push_tests;
+    TCase *concurrent_list_push_test_cases = tcase_create(" concurrent_list_push() Tests");
+    add_tests(concurrent_list_push_test_cases, concurrent_list_push_test_list);
+    suite_add_tcase(concurrent_array_list_test_suite, concurrent_list_push_test_cases);
+
+    return concurrent_array_list_test_suite;
+}
@@ -7,6 +7,16 @@ extern Suite *singly_linked_list_test_suite(void);
 extern Suite *doubly_linked_list_test_suite(void);
 extern Suite *circular_singly_linked_list_test_suite(void);
 extern Suite *array_list_test_suite(void);
+extern Suite *segmented_array_list_test_suite(void);
+extern Suite *concurrent_array_list_test_suite(void);
+extern Suite *frozen_search_test_suite(void);
+extern Suite *gap_buffer_test_suite(void);
+extern Suite *array_deque_test_suite(void);
+extern Suite *node_pool_test_suite(void);
+extern Suite *unrolled_linked_list_test_suite(void);
+extern Suite *indexable_skip_list_test_suite(void);
+extern Suite *intrusive_list_test_suite(void);
+extern Suite *compact_doubly_linked_list_test_suite(void);
 
 int run_linked_list_tests()
 {
@@ -14,11 +24,21 @@ int run_linked_list_tests()
     SRunner *sr_sll = srunner_create(NULL);
     SRunner *sr_dll = srunner_create(NULL);
     SRunner *sr_csll = srunner_create(NULL);
+    SRunner *sr_np = srunner_create(NULL);
+    SRunner *sr_ull = srunner_create(NULL);
+    SRunner *sr_isl = srunner_create(NULL);
+    SRunner *sr_il = srunner_create(NULL);
+    SRunner *sr_cdll = srunner_create(NULL);
 
     // prepare the test suites
     srunner_add_suite(sr_sll, singly_linked_list_test_suite());
     srunner_add_suite(sr_dll, doubly_linked_list_test_suite());
     srunner_add_suite(sr_csll, circular_singly_linked_list_test_suite());
+    srunner_add_suite(sr_np, node_pool_test_suite());
+    srunner_add_suite(sr_ull, unrolled_linked_list_test_suite());
+    srunner_add_suite(sr_isl, indexable_skip_list_test_suite());
+    srunner_add_suite(sr_il, intrusive_list_test_suite());
+    srunner_add_suite(sr_cdll, compact_doubly_linked_list_test_suite());
 
     // run the Linked List test suites
     printf("-------------------------------------------------------------------------------------------------------\n");
@@ -30,6 +50,16 @@ int run_linked_list_tests()
     printf("\n");
     srunner_run_all(sr_csll, CK_VERBOSE);
     printf("\n");
+    srunner_run_all(sr_np, CK_VERBOSE);
+    printf("\n");
+    srunner_run_all(sr_ull, CK_VERBOSE);
+    printf("\n");
+    srunner_run_all(sr_isl, CK_VERBOSE);
+    printf("\n");
+    srunner_run_all(sr_il, CK_VERBOSE);
+    printf("\n");
+    srunner_run_all(sr_cdll, CK_VERBOSE);
+    printf("\n");
 
     // report the test failed status
     int tests_failed = 0;
@@ -56,11 +86,51 @@ int run_linked_list_tests()
         goto END;
     }
 
+    tests_failed = srunner_ntests_failed(sr_np);
+    if (0 != tests_failed)
+    {
+        perror("node pool test failure\n");
+        goto END;
+    }
+
+    tests_failed = srunner_ntests_failed(sr_ull);
+    if (0 != tests_failed)
+    {
+        perror("unrolled linked list test failure\n");
+        goto END;
+    }
+
+    tests_failed = srunner_ntests_failed(sr_isl);
+    if (0 != tests_failed)
+    {
+        perror("indexable skip list test failure\n");
+        goto END;
+    }
+
+    tests_failed = srunner_ntests_failed(sr_il);
+    if (0 != tests_failed)
+    {
+        perror("intrusive list test failure\n");
+        goto END;
+    }
+
+    tests_failed = srunner_ntests_failed(sr_cdll);
+    if (0 != tests_failed)
+    {
+        perror("compact doubly linked list test failure\n");
+        goto END;
+    }
+
 
 END:
     srunner_free(sr_sll);
     srunner_free(sr_dll);
     srunner_free(sr_csll);
+    srunner_free(sr_np);
+    srunner_free(sr_ull);
+    srunner_free(sr_isl);
+    srunner_free(sr_il);
+    srunner_free(sr_cdll);
     // return 1 or 0 based on whether or not tests failed
     return (tests_failed == 0) ? 0 : 1;
 }
@@ -69,9 +139,19 @@ int run_array_list_tests()
 {
     //create test suite runner
     SRunner *sr_al = srunner_create(NULL);
+    SRunner *sr_sal = srunner_create(NULL);
+    SRunner *sr_cal = srunner_create(NULL);
+    SRunner *sr_fs = srunner_create(NULL);
+    SRunner *sr_gb = srunner_create(NULL);
+    SRunner *sr_dq = srunner_create(NULL);
 
     // prepare the test suites
     srunner_add_suite(sr_al, array_list_test_suite());
+    srunner_add_suite(sr_sal, segmented_array_list_test_suite());
+    srunner_add_suite(sr_cal, concurrent_array_list_test_suite());
+    srunner_add_suite(sr_fs, frozen_search_test_suite());
+    srunner_add_suite(sr_gb, gap_buffer_test_suite());
+    srunner_add_suite(sr_dq, array_deque_test_suite());
 
     // run the Linked List test suites
     printf("-------------------------------------------------------------------------------------------------------\n");
@@ -79,6 +159,16 @@ int run_array_list_tests()
     printf("-------------------------------------------------------------------------------------------------------\n");
     srunner_run_all(sr_al, CK_VERBOSE);
     printf("\n");
+    srunner_run_all(sr_sal, CK_VERBOSE);
+    printf("\n");
+    srunner_run_all(sr_cal, CK_VERBOSE);
+    printf("\n");
+    srunner_run_all(sr_fs, CK_VERBOSE);
+    printf("\n");
+    srunner_run_all(sr_gb, CK_VERBOSE);
+    printf("\n");
+    srunner_run_all(sr_dq, CK_VERBOSE);
+    printf("\n");
 
     // report the test failed status
     int tests_failed = 0;
@@ -91,8 +181,48 @@ int run_array_list_tests()
         goto END;
     }
 
+    tests_failed = srunner_ntests_failed(sr_sal);
+    if (0 != tests_failed)
+    {
+        perror("segmented array list test failure\n");
+        goto END;
+    }
+
+    tests_failed = srunner_ntests_failed(sr_cal);
+    if (0 != tests_failed)
+    {
+        perror("concurrent array list test failure\n");
+        goto END;
+    }
+
+    tests_failed = srunner_ntests_failed(sr_fs);
+    if (0 != tests_failed)
+    {
+        perror("frozen search test failure\n");
+        goto END;
+    }
+
+    tests_failed = srunner_ntests_failed(sr_gb);
+    if (0 != tests_failed)
+    {
+        perror("gap buffer test failure\n");
+        goto END;
+    }
+
+    tests_failed = srunner_ntests_failed(sr_dq);
+    if (0 != tests_failed)
+    {
+        perror("array deque test failure\n");
+        goto END;
+    }
+
 END:
     srunner_free(sr_al);
+    srunner_free(sr_sal);
+    srunner_free(sr_cal);
+    srunner_free(sr_fs);
+    srunner_free(sr_gb);
+    srunner_free(sr_dq);
     // return 1 or 0 based on whether or not tests failed
     return (tests_failed == 0) ? 0 : 1;
 }
@@ -0,0 +1,261 @@
+#include <check.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "frozen_search.h"
+#include "array_list.h"
+#include "exit_codes.h"
+#include "utilities/comparison_helpers.h"
+
+// CREATE TESTS
+//***********************************************************************************************
+// ensure a frozen search is built from sorted values and reports its size
+START_TEST(test_frozen_search_create)
+{
+    int values[] = {1, 3, 5, 7, 9};
+    frozen_search_t *search = frozen_search_create(values, 5, sizeof(int), &int_comp_ctx);
+    ck_assert_ptr_ne(search, NULL);
+    ck_assert_int_eq(frozen_search_size(search), 5);
+
+    frozen_search_destroy(&search);
+    ck_assert_ptr_eq(search, NULL);
+}
+END_TEST
+
+// ensure bad arguments are rejected
+START_TEST(test_frozen_search_create_invalid)
+{
+    int values[] = {1};
+    size_t rank = 0;
+
+    ck_assert_ptr_eq(frozen_search_create(values, 1, sizeof(int), NULL), NULL);
+    ck_assert_ptr_eq(frozen_search_create(NULL, 1, sizeof(int), &int_comp_ctx), NULL);
+    ck_assert_int_eq(frozen_search_lower_bound(NULL, values, &rank), E_NULL_POINTER);
+    ck_assert(!frozen_search_contains(NULL, values));
+    ck_assert_int_eq(frozen_search_size(NULL), 0);
+}
+END_TEST
+
+// ensure an empty structure answers every query with rank 0
+START_TEST(test_frozen_search_empty)
+{
+    size_t rank = 99;
+    int key = 4;
+
+    frozen_search_t *search = frozen_search_create(NULL, 0, sizeof(int), &int_comp_ctx);
+    ck_assert_ptr_ne(search, NULL);
+    ck_assert_int_eq(frozen_search_lower_bound(search, &key, &rank), E_SUCCESS);
+    ck_assert_int_eq(rank, 0);
+    ck_assert(!frozen_search_contains(search, &key));
+
+    frozen_search_destroy(&search);
+}
+END_TEST
+
+// TEST LIST
+static TFun frozen_search_create_tests[] =
+{
+    test_frozen_search_create,
+    test_frozen_search_create_invalid,
+    test_frozen_search_empty,
+    NULL
+};
+
+// LOWER BOUND TESTS
+//***********************************************************************************************
+// ensure every size up to a few levels matches a plain lower bound on the sorted input
+START_TEST(test_frozen_search_lower_bound_all_sizes)
+{
+    int values[130] = {0};
+
+    for (size_t count = 1; count <= 130; count++)
+    {
+        for (size_t idx = 0; idx < count; idx++)
+        {
+            values[idx] = (int)(idx * 2) + 1; // odd numbers, so even keys fall between elements
+        }
+
+        frozen_search_t *search = frozen_search_create(values, count, sizeof(int), &int_comp_ctx);
+
+        for (int key = 0; key <= (int)(count * 2) + 1; key++)
+        {
+            size_t rank = 0;
+            size_t expected = (size_t)key / 2; // first odd number >= key
+
+            ck_assert_int_eq(frozen_search_lower_bound(search, &key, &rank), E_SUCCESS);
+            ck_assert_int_eq(rank, expected);
+            ck_assert(frozen_search_contains(search, &key) == (1 == key % 2 && expected < count));
+        }
+
+        frozen_search_destroy(&search);
+    }
+}
+END_TEST
+
+// ensure duplicates report the first of their run
+START_TEST(test_frozen_search_lower_bound_duplicates)
+{
+    int values[] = {2, 4, 4, 4, 4, 6, 8, 8};
+    size_t rank = 0;
+
+    frozen_search_t *search = frozen_search_create(values, 8, sizeof(int), &int_comp_ctx);
+
+    int key = 4;
+    frozen_search_lower_bound(search, &key, &rank);
+    ck_assert_int_eq(rank, 1);
+
+    key = 8;
+    frozen_search_lower_bound(search, &key, &rank);
+    ck_assert_int_eq(rank, 6);
+
+    key = 9;
+    frozen_search_lower_bound(search, &key, &rank);
+    ck_assert_int_eq(rank, 8);
+
+    frozen_search_destroy(&search);
+}
+END_TEST
+
+// ensure the batch lookup agrees with single lookups, including a partial last batch
+START_TEST(test_frozen_search_lower_bound_batch)
+{
+    int values[1000] = {0};
+    int keys[FROZEN_SEARCH_BATCH * 3 + 5] = {0};
+    const void *key_ptrs[FROZEN_SEARCH_BATCH * 3 + 5] = {0};
+    size_t ranks[FROZEN_SEARCH_BATCH * 3 + 5] = {0};
+    size_t num_keys = FROZEN_SEARCH_BATCH * 3 + 5;
+
+    for (int idx = 0; idx < 1000; idx++)
+    {
+        values[idx] = idx * 3;
+    }
+
+    for (size_t idx = 0; idx < num_keys; idx++)
+    {
+        keys[idx] = (int)((idx * 211) % 3100) - 50;
+        key_ptrs[idx] = &keys[idx];
+    }
+
+    frozen_search_t *search = frozen_search_create(values, 1000, sizeof(int), &int_comp_ctx);
+    ck_assert_int_eq(frozen_search_lower_bound_batch(search, key_ptrs, num_keys, ranks), E_SUCCESS);
+
+    for (size_t idx = 0; idx < num_keys; idx++)
+    {
+        size_t rank = 0;
+        frozen_search_lower_bound(search, key_ptrs[idx], &rank);
+        ck_assert_int_eq(ranks[idx], rank);
+    }
+
+    frozen_search_destroy(&search);
+}
+END_TEST
+
+// TEST LIST
+static TFun frozen_search_lower_bound_tests[] =
+{
+    test_frozen_search_lower_bound_all_sizes,
+    test_frozen_search_lower_bound_duplicates,
+    test_frozen_search_lower_bound_batch,
+    NULL
+};
+
+// FREEZE TESTS
+//***********************************************************************************************
+// ensure an unsorted typed list is frozen in sorted order and the list is left alone
+START_TEST(test_array_list_freeze_search_typed)
+{
+    size_t rank = 0;
+    array_list_t *list = array_list_create_typed(sizeof(int), NULL, &int_eq_ctx);
+
+    int values[] = {50, 10, 40, 20, 30};
+    array_list_push_many(list, values, 5);
+
+    frozen_search_t *search = array_list_freeze_search(list, &int_comp_ctx);
+    ck_assert_ptr_ne(search, NULL);
+    ck_assert_int_eq(*(int *)array_list_get(list, 0), 50);
+
+    int key = 35;
+    frozen_search_lower_bound(search, &key, &rank);
+    ck_assert_int_eq(rank, 3);
+
+    // the copy is independent of the list
+    array_list_destroy(&list);
+    key = 10;
+    ck_assert(frozen_search_contains(search, &key));
+
+    frozen_search_destroy(&search);
+}
+END_TEST
+
+// ensure pointer lists compare their stored pointers, sorted lists included
+START_TEST(test_array_list_freeze_search_pointers)
+{
+    size_t rank = 0;
+    const char *words[] = {"pear", "apple", "fig", "banana", "cherry"};
+
+    array_list_t *list = array_list_create(NULL, &str_eq_ctx);
+    array_list_push_many(list, words, 5);
+    array_list_t *sorted = array_list_create_sorted(&str_comp_ctx, NULL);
+    array_list_push_many(sorted, words, 5);
+
+    frozen_search_t *from_list = array_list_freeze_search(list, &str_comp_ctx);
+    frozen_search_t *from_sorted = array_list_freeze_search(sorted, &str_comp_ctx);
+
+    char key[] = "cherry";
+    frozen_search_lower_bound(from_list, key, &rank);
+    ck_assert_int_eq(rank, 2);
+    frozen_search_lower_bound(from_sorted, key, &rank);
+    ck_assert_int_eq(rank, 2);
+
+    char missing[] = "grape";
+    ck_assert(!frozen_search_contains(from_list, missing));
+
+    frozen_search_destroy(&from_list);
+    frozen_search_destroy(&from_sorted);
+    array_list_destroy(&list);
+    array_list_destroy(&sorted);
+}
+END_TEST
+
+// TEST LIST
+static TFun array_list_freeze_search_tests[] =
+{
+    test_array_list_freeze_search_typed,
+    test_array_list_freeze_search_pointers,
+    NULL
+};
+
+static void add_tests(TCase * test_cases, TFun * test_functions)
+{
+    while (* test_functions)
+    {
+        // add the test from the core_tests array to the tcase
+        tcase_add_test(test_cases, * test_functions);
+        test_functions++;
+    }
+}
+
+Suite *frozen_search_test_suite(void)
+{
+    Suite *frozen_search_test_suite = suite_create("Frozen Search Tests");
+
+    // Create frozen_search_create() tests
+    TFun *frozen_search_create_test_list = frozen_search_create_tests;
+    TCase *frozen_search_create_test_cases = tcase_create(" frozen_search_create() Tests");
+    add_tests(frozen_search_create_test_cases, frozen_search_create_test_list);
+    suite_add_tcase(frozen_search_test_suite, frozen_search_create_test_cases);
+
+    // Create frozen_search_lower_bound() tests
+    TFun *frozen_search_lower_bound_test_list = frozen_search_lower_bound_tests;
+    TCase *frozen_search_lower_bound_test_cases = tcase_create(" frozen_search_lower_bound() Tests");
+    add_tests(frozen_search_lower_bound_test_cases, frozen_search_lower_bound_test_list);
+    suite_add_tcase(frozen_search_test_suite, frozen_search_lower_bound_test_cases);
+
+    // Create array_list_freeze_search() tests
+    TFun *array_list_freeze_search_test_list = array_list_freeze_search_tests;
+    TCase *array_list_freeze_search_test_cases = tcase_create(" array_list_freeze_search() Tests");
+    add_tests(array_list_freeze_search_test_cases, array_list_freeze_search_test_list);
+    suite_add_tcase(frozen_search_test_suite, array_list_freeze_search_test_cases);
+
+    return frozen_search_test_suite;
+}
@@ -0,0 +1,223 @@
+#include <check.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "gap_buffer.h"
+#include "exit_codes.h"
+#include "utilities/comparison_helpers.h"
+
+static int destroy_count = 0;
+
+static void count_destroy(void *data, const void *context)
+{
+    (void) data;
+    (void) context;
+    destroy_count++;
+}
+
+static destroy_ctx count_destroy_ctx = {count_destroy, NULL, NULL};
+
+static void count_destroy_many(void **items, size_t count, const void *context)
+{
+    (void) items;
+    (void) context;
+    destroy_count += (int)count;
+}
+
+static destroy_ctx count_destroy_many_ctx = {NULL, NULL, count_destroy_many};
+
+// CREATE TESTS
+//***********************************************************************************************
+// ensure a new gap buffer is empty with the cursor at the start
+START_TEST(test_gap_buffer_create)
+{
+    gap_buffer_t *buffer = gap_buffer_create(NULL, NULL);
+    ck_assert_ptr_ne(buffer, NULL);
+    ck_assert_int_eq(gap_buffer_size(buffer), 0);
+    ck_assert_int_eq(gap_buffer_cursor(buffer), 0);
+
+    gap_buffer_destroy(&buffer);
+    ck_assert_ptr_eq(buffer, NULL);
+}
+END_TEST
+
+// ensure a zero element size is rejected
+START_TEST(test_gap_buffer_create_typed_zero_size)
+{
+    ck_assert_ptr_eq(gap_buffer_create_typed(0, NULL, NULL), NULL);
+}
+END_TEST
+
+// TEST LIST
+static TFun gap_buffer_create_tests[] =
+{
+    test_gap_buffer_create,
+    test_gap_buffer_create_typed_zero_size,
+    NULL
+};
+
+// EDIT TESTS
+//***********************************************************************************************
+// ensure inserts land at the cursor, growing past the initial capacity
+START_TEST(test_gap_buffer_insert_at_cursor)
+{
+    gap_buffer_t *buffer = gap_buffer_create_typed(sizeof(int), NULL, NULL);
+
+    for (int num = 0; num < 40; num++)
+    {
+        ck_assert_int_eq(gap_buffer_insert(buffer, &num), E_SUCCESS);
+    }
+
+    // type 100..104 in the middle
+    ck_assert_int_eq(gap_buffer_move_cursor(buffer, 10), E_SUCCESS);
+    for (int num = 100; num < 105; num++)
+    {
+        gap_buffer_insert(buffer, &num);
+    }
+
+    ck_assert_int_eq(gap_buffer_size(buffer), 45);
+    ck_assert_int_eq(gap_buffer_cursor(buffer), 15);
+    ck_assert_int_eq(*(int *)gap_buffer_get(buffer, 9), 9);
+    ck_assert_int_eq(*(int *)gap_buffer_get(buffer, 10), 100);
+    ck_assert_int_eq(*(int *)gap_buffer_get(buffer, 14), 104);
+    ck_assert_int_eq(*(int *)gap_buffer_get(buffer, 15), 10);
+    ck_assert_int_eq(*(int *)gap_buffer_get(buffer, 44), 39);
+    ck_assert_ptr_eq(gap_buffer_get(buffer, 45), NULL);
+
+    gap_buffer_destroy(&buffer);
+}
+END_TEST
+
+// ensure deletes on both sides of the cursor destroy the right elements
+START_TEST(test_gap_buffer_delete)
+{
+    destroy_count = 0;
+    gap_buffer_t *buffer = gap_buffer_create(&count_destroy_ctx, NULL);
+
+    for (int num = 1; num <= 6; num++)
+    {
+        gap_buffer_insert(buffer, (void *)(uintptr_t)num);
+    }
+
+    // 1 2 3 | 4 5 6  ->  1 2 | 5 6
+    gap_buffer_move_cursor(buffer, 3);
+    ck_assert_int_eq(gap_buffer_delete_before(buffer), E_SUCCESS);
+    ck_assert_int_eq(gap_buffer_delete_after(buffer), E_SUCCESS);
+    ck_assert_int_eq(destroy_count, 2);
+    ck_assert_int_eq(gap_buffer_size(buffer), 4);
+    ck_assert_int_eq((int)(uintptr_t)gap_buffer_get(buffer, 1), 2);
+    ck_assert_int_eq((int)(uintptr_t)gap_buffer_get(buffer, 2), 5);
+
+    gap_buffer_move_cursor(buffer, 0);
+    ck_assert_int_eq(gap_buffer_delete_before(buffer), E_OUT_OF_BOUNDS);
+    gap_buffer_move_cursor(buffer, 4);
+    ck_assert_int_eq(gap_buffer_delete_after(buffer), E_OUT_OF_BOUNDS);
+
+    gap_buffer_destroy(&buffer);
+    ck_assert_int_eq(destroy_count, 6);
+}
+END_TEST
+
+// ensure a ctx with only destroy_many still frees elements dropped one at a time
+START_TEST(test_gap_buffer_destroy_many_only)
+{
+    destroy_count = 0;
+    gap_buffer_t *buffer = gap_buffer_create(&count_destroy_many_ctx, NULL);
+
+    for (int num = 1; num <= 4; num++)
+    {
+        gap_buffer_insert(buffer, (void *)(uintptr_t)num);
+    }
+
+    gap_buffer_move_cursor(buffer, 2);
+    ck_assert_int_eq(gap_buffer_delete_before(buffer), E_SUCCESS);
+    ck_assert_int_eq(gap_buffer_delete_after(buffer), E_SUCCESS);
+    ck_assert_int_eq(destroy_count, 2);
+
+    gap_buffer_destroy(&buffer);
+    ck_assert_int_eq(destroy_count, 4);
+}
+END_TEST
+
+// TEST LIST
+static TFun gap_buffer_edit_tests[] =
+{
+    test_gap_buffer_insert_at_cursor,
+    test_gap_buffer_delete,
+    test_gap_buffer_destroy_many_only,
+    NULL
+};
+
+// ACCESS TESTS
+//***********************************************************************************************
+// ensure set and contains work on both sides of the gap, and the cursor is range checked
+START_TEST(test_gap_buffer_set_and_contains)
+{
+    gap_buffer_t *buffer = gap_buffer_create(NULL, &raw_int_eq_ctx);
+
+    for (int num = 1; num <= 20; num++)
+    {
+        gap_buffer_insert(buffer, (void *)(uintptr_t)num);
+    }
+    gap_buffer_move_cursor(buffer, 7);
+
+    ck_assert_int_eq(gap_buffer_set(buffer, 2, (void *)(uintptr_t)300), E_SUCCESS);
+    ck_assert_int_eq(gap_buffer_set(buffer, 15, (void *)(uintptr_t)1600), E_SUCCESS);
+    ck_assert_int_eq(gap_buffer_set(buffer, 20, (void *)(uintptr_t)1), E_OUT_OF_BOUNDS);
+    ck_assert_int_eq(gap_buffer_cursor(buffer), 7);
+
+    ck_assert(gap_buffer_contains(buffer, (void *)(uintptr_t)300));
+    ck_assert(gap_buffer_contains(buffer, (void *)(uintptr_t)1600));
+    ck_assert(gap_buffer_contains(buffer, (void *)(uintptr_t)20));
+    ck_assert(!gap_buffer_contains(buffer, (void *)(uintptr_t)3));
+
+    ck_assert_int_eq(gap_buffer_move_cursor(buffer, 21), E_OUT_OF_BOUNDS);
+    ck_assert_int_eq(gap_buffer_insert(NULL, buffer), E_LIST_ERROR);
+    ck_assert_int_eq(gap_buffer_insert(buffer, NULL), E_NULL_POINTER);
+
+    gap_buffer_destroy(&buffer);
+}
+END_TEST
+
+// TEST LIST
+static TFun gap_buffer_access_tests[] =
+{
+    test_gap_buffer_set_and_contains,
+    NULL
+};
+
+static void add_tests(TCase * test_cases, TFun * test_functions)
+{
+    while (* test_functions)
+    {
+        // add the test from the core_tests array to the tcase
+        tcase_add_test(test_cases, * test_functions);
+        test_functions++;
+    }
+}
+
+Suite *gap_buffer_test_suite(void)
+{
+    Suite *gap_buffer_test_suite = suite_create("Gap Buffer Tests");
+
+    // Create gap_buffer_create() tests
+    TFun *gap_buffer_create_test_list = gap_buffer_create_tests;
+    TCase *gap_buffer_create_test_cases = tcase_create(" gap_buffer_create() Tests");
+    add_tests(gap_buffer_create_test_cases, gap_buffer_create_test_list);
+    suite_add_tcase(gap_buffer_test_suite, gap_buffer_create_test_cases);
+
+    // Create gap_buffer_insert()/delete() tests
+    TFun *gap_buffer_edit_test_list = gap_buffer_edit_tests;
+    TCase *gap_buffer_edit_test_cases = tcase_create(" gap_buffer_insert()/delete() Tests");
+    add_tests(gap_buffer_edit_test_cases, gap_buffer_edit_test_list);
+    suite_add_tcase(gap_buffer_test_suite, gap_buffer_edit_test_cases);
+
+    // Create gap_buffer_get()/set() tests
+    TFun *gap_buffer_access_test_list = gap_buffer_access_tests;
+    TCase *gap_buffer_access_test_cases = tcase_create(" gap_buffer_get()/set() Tests");
+    add_tests(gap_buffer_access_test_cases, gap_buffer_access_test_list);
+    suite_add_tcase(gap_buffer_test_suite, gap_buffer_access_test_cases);
+
+    return gap_buffer_test_suite;
+}
@@ -4,6 +4,7 @@
 
 #include "linked_lists/circular_singly_linked_list.h"
 #include "void_pointer_functions.h"
+#include "utilities/comparison_helpers.h"
 #include "exit_codes.h"
 
 struct csll_node
@@ -17,6 +18,8 @@ struct circular_singly_linked_list
     csll_node_t *head;
     csll_node_t *tail;
     size_t current_size;
+    node_pool_t *pool;
+    bool owns_pool;
 };
 
 // CREATE LIST TESTS
@@ -642,6 +645,334 @@ static TFun csll_remove_position_tests[] =
     NULL
 };
 
+// CSLL POOL TESTS
+//***********************************************************************************************
+// ensure lists sharing a pool take nodes from it and hand them back for each other to reuse
+START_TEST(test_csll_create_with_pool)
+{
+    node_pool_t *pool = node_pool_create(csll_node_size(), 0);
+    circular_singly_linked_list_t *first = csll_create_with_pool(pool);
+    circular_singly_linked_list_t *second = csll_create_with_pool(pool);
+    ck_assert_ptr_ne(first, NULL);
+    ck_assert_ptr_ne(second, NULL);
+
+    int nums[] = {10, 20, 30};
+    for (size_t idx = 0; idx < 3; idx++)
+    {
+        ck_assert_int_eq(csll_push_tail(first, &nums[idx]), E_SUCCESS);
+        ck_assert_int_eq(csll_push_head(second, &nums[idx]), E_SUCCESS);
+    }
+    ck_assert_int_eq(node_pool_in_use(pool), 6);
+
+    ck_assert_int_eq(*((int *)csll_pop_head(first)), 10);
+    ck_assert_int_eq(node_pool_in_use(pool), 5);
+
+    ck_assert_int_eq(csll_push_tail(second, &nums[0]), E_SUCCESS);
+    ck_assert_int_eq(*((int *)csll_peek_tail(second)), 10);
+    ck_assert_int_eq(node_pool_in_use(pool), 6);
+
+    // Destroying one list returns only its own nodes
+    csll_destroy_list(&first);
+    ck_assert_int_eq(node_pool_in_use(pool), 4);
+    ck_assert_int_eq(*((int *)csll_peek_head(second)), 30);
+
+    csll_destroy_list(&second);
+    ck_assert_int_eq(node_pool_in_use(pool), 0);
+    node_pool_destroy(&pool);
+}
+END_TEST
+
+// ensure a pool whose nodes are too small is rejected
+START_TEST(test_csll_create_with_pool_small_nodes)
+{
+    node_pool_t *pool = node_pool_create(1, 0);
+
+    ck_assert_ptr_eq(csll_create_with_pool(pool), NULL);
+    ck_assert_ptr_eq(csll_create_with_pool(NULL), NULL);
+
+    node_pool_destroy(&pool);
+}
+END_TEST
+
+// TEST LIST
+static TFun csll_pool_tests[] =
+{
+    test_csll_create_with_pool,
+    test_csll_create_with_pool_small_nodes,
+    NULL
+};
+
+// CSLL CURSOR TESTS
+//***********************************************************************************************
+// ensure a cursor wraps from the tail back to the head
+START_TEST(test_csll_cursor_wraps)
+{
+    circular_singly_linked_list_t *list = csll_create();
+    int nums[] = {1, 2, 3};
+
+    for (size_t idx = 0; idx < 3; idx++)
+    {
+        csll_push_tail(list, &nums[idx]);
+    }
+
+    csll_cursor_t cursor;
+    csll_cursor_head(list, &cursor);
+    for (size_t idx = 0; idx < 7; idx++)
+    {
+        ck_assert_int_eq(*((int *)csll_cursor_get(&cursor)), nums[idx % 3]);
+        ck_assert_int_eq(csll_cursor_next(&cursor), E_SUCCESS);
+    }
+
+    csll_destroy_list(&list);
+}
+END_TEST
+
+// ensure a cursor can erase while going round the list, down to an empty list
+START_TEST(test_csll_cursor_erase)
+{
+    circular_singly_linked_list_t *list = csll_create();
+    int nums[] = {1, 2, 3, 4, 5};
+
+    for (size_t idx = 0; idx < 5; idx++)
+    {
+        csll_push_tail(list, &nums[idx]);
+    }
+
+    // Erase every second node, going round until one is left (the Josephus problem)
+    csll_cursor_t cursor;
+    csll_cursor_head(list, &cursor);
+    while (list->current_size > 1)
+    {
+        csll_cursor_next(&cursor);
+        ck_assert_int_eq(csll_cursor_erase(&cursor), E_SUCCESS);
+    }
+
+    ck_assert_int_eq(*((int *)csll_peek_head(list)), 3);
+    ck_assert_ptr_eq(list->head, list->tail);
+    ck_assert_int_eq(*((int *)csll_cursor_get(&cursor)), 3);
+
+    ck_assert_int_eq(csll_cursor_erase(&cursor), E_SUCCESS);
+    ck_assert_ptr_eq(csll_cursor_get(&cursor), NULL);
+    ck_assert_ptr_eq(list->head, NULL);
+    ck_assert_ptr_eq(list->tail, NULL);
+    ck_assert_int_eq(csll_cursor_next(&cursor), E_OUT_OF_BOUNDS);
+    ck_assert_int_eq(csll_cursor_erase(&cursor), E_OUT_OF_BOUNDS);
+
+    csll_destroy_list(&list);
+}
+END_TEST
+
+// ensure a cursor inserts before and after itself, keeping the head and tail up to date
+START_TEST(test_csll_cursor_insert)
+{
+    circular_singly_linked_list_t *list = csll_create();
+    int nums[] = {10, 20, 30, 40};
+
+    // In an empty list the cursor moves onto the new node
+    csll_cursor_t cursor;
+    csll_cursor_head(list, &cursor);
+    ck_assert_int_eq(csll_cursor_insert_after(&cursor, &nums[0]), E_OUT_OF_BOUNDS);
+    ck_assert_int_eq(csll_cursor_insert_before(&cursor, &nums[1]), E_SUCCESS);
+    ck_assert_int_eq(*((int *)csll_cursor_get(&cursor)), 20);
+
+    ck_assert_int_eq(csll_cursor_insert_before(&cursor, &nums[0]), E_SUCCESS);
+    ck_assert_int_eq(csll_cursor_insert_after(&cursor, &nums[3]), E_SUCCESS);
+    ck_assert_int_eq(csll_cursor_insert_after(&cursor, &nums[2]), E_SUCCESS);
+
+    ck_assert_int_eq(*((int *)csll_peek_head(list)), 10);
+    ck_assert_int_eq(*((int *)csll_peek_tail(list)), 40);
+    ck_assert_int_eq(list->current_size, 4);
+
+    csll_cursor_head(list, &cursor);
+    for (size_t idx = 0; idx < 4; idx++)
+    {
+        ck_assert_int_eq(*((int *)csll_cursor_get(&cursor)), nums[idx]);
+        csll_cursor_next(&cursor);
+    }
+
+    csll_destroy_list(&list);
+}
+END_TEST
+
+// TEST LIST
+static TFun csll_cursor_tests[] =
+{
+    test_csll_cursor_wraps,
+    test_csll_cursor_erase,
+    test_csll_cursor_insert,
+    NULL
+};
+
+// CSLL SORT TESTS
+//***********************************************************************************************
+// orders ints and counts how often it is called, so tests can check presorted input stays near linear
+static int counting_int_comp_csll(const void *x, const void *y, const void *ctx)
+{
+    (*(size_t *)ctx)++;
+    return int_comp(x, y, NULL);
+}
+
+// orders sort_pair_t by key alone, so equal keys show whether the original order survived
+typedef struct sort_pair_csll
+{
+    int key;
+    int order;
+} sort_pair_csll_t;
+
+static int pair_key_comp_csll(const void *x, const void *y, const void *ctx)
+{
+    (void)ctx;
+    return ((const sort_pair_csll_t *)x)->key - ((const sort_pair_csll_t *)y)->key;
+}
+
+static int qsort_int_comp_csll(const void *x, const void *y)
+{
+    return *(const int *)x - *(const int *)y;
+}
+
+// ensure random values come out in the same order as qsort puts them
+START_TEST(test_csll_sort_random)
+{
+    enum { NUM_SORT = 2000 };
+    int *nums = malloc(NUM_SORT * sizeof(int));
+    int *expected = malloc(NUM_SORT * sizeof(int));
+    unsigned int seed = 99;
+    circular_singly_linked_list_t *list = csll_create();
+
+    for (size_t idx = 0; idx < NUM_SORT; idx++)
+    {
+        seed = seed * 1103515245 + 12345;
+        nums[idx] = (int)((seed >> 16) % 500);
+        expected[idx] = nums[idx];
+        csll_push_tail(list, &nums[idx]);
+    }
+    qsort(expected, NUM_SORT, sizeof(int), qsort_int_comp_csll);
+
+    ck_assert_int_eq(csll_sort(list, &int_comp_ctx), E_SUCCESS);
+    ck_assert_int_eq(list->current_size, NUM_SORT);
+    ck_assert_int_eq(*((int *)csll_peek_tail(list)), expected[NUM_SORT - 1]);
+    ck_assert_ptr_eq(list->tail->next, NULL);
+
+    // A tail already linked back to the head is linked back to the new head
+    circular_singly_linked_list_t *closed = csll_create();
+    for (size_t idx = 0; idx < 50; idx++)
+    {
+        csll_push_tail(closed, &nums[idx]);
+    }
+    closed->tail->next = closed->head;
+    ck_assert_int_eq(csll_sort(closed, &int_comp_ctx), E_SUCCESS);
+    ck_assert_ptr_eq(closed->tail->next, closed->head);
+    ck_assert_int_le(*((int *)closed->head->data), *((int *)closed->head->next->data));
+    closed->tail->next = NULL;
+    csll_destroy_list(&closed);
+
+    for (size_t idx = 0; idx < NUM_SORT; idx++)
+    {
+        ck_assert_int_eq(*((int *)csll_pop_head(list)), expected[idx]);
+    }
+
+    csll_destroy_list(&list);
+    free(nums);
+    free(expected);
+}
+END_TEST
+
+// ensure equal keys keep their original order, including inside descending runs
+START_TEST(test_csll_sort_stable)
+{
+    enum { NUM_PAIRS = 300 };
+    sort_pair_csll_t pairs[NUM_PAIRS];
+    compare_ctx by_key = {pair_key_comp_csll, NULL};
+    circular_singly_linked_list_t *list = csll_create();
+
+    // Keys fall in steps of three equal values, then a few ascending stretches follow
+    for (int idx = 0; idx < NUM_PAIRS; idx++)
+    {
+        pairs[idx].key = (idx < 200) ? (200 - idx) / 3 : idx % 7;
+        pairs[idx].order = idx;
+        csll_push_tail(list, &pairs[idx]);
+    }
+
+    ck_assert_int_eq(csll_sort(list, &by_key), E_SUCCESS);
+
+    sort_pair_csll_t *previous = csll_pop_head(list);
+    for (size_t idx = 1; idx < NUM_PAIRS; idx++)
+    {
+        sort_pair_csll_t *current = csll_pop_head(list);
+        ck_assert_int_le(previous->key, current->key);
+        if (previous->key == current->key)
+        {
+            ck_assert_int_lt(previous->order, current->order);
+        }
+        previous = current;
+    }
+
+    csll_destroy_list(&list);
+}
+END_TEST
+
+// ensure sorted and reversed lists take about one comparison per node, and nearly sorted ones a few
+START_TEST(test_csll_sort_runs)
+{
+    enum { NUM_RUN = 5000 };
+    int *nums = malloc(NUM_RUN * sizeof(int));
+    size_t comparisons = 0;
+    compare_ctx counting = {counting_int_comp_csll, &comparisons};
+
+    for (int pass = 0; pass < 3; pass++)
+    {
+        circular_singly_linked_list_t *list = csll_create();
+        for (int idx = 0; idx < NUM_RUN; idx++)
+        {
+            nums[idx] = (1 == pass) ? NUM_RUN - idx : idx;
+            csll_push_tail(list, &nums[idx]);
+        }
+
+        // The third pass swaps a handful of neighbours out of place
+        if (2 == pass)
+        {
+            for (int idx = 100; idx < NUM_RUN; idx += 1000)
+            {
+                nums[idx] = idx + 1;
+                nums[idx + 1] = idx;
+            }
+        }
+
+        // One run takes one comparison per node; the six runs of the third pass cost about log2(6) per node
+        comparisons = 0;
+        ck_assert_int_eq(csll_sort(list, &counting), E_SUCCESS);
+        ck_assert_uint_lt(comparisons, ((2 == pass) ? 4 : 2) * NUM_RUN);
+
+        for (int idx = 0; idx < NUM_RUN; idx++)
+        {
+            ck_assert_int_eq(*((int *)csll_pop_head(list)), (1 == pass) ? idx + 1 : idx);
+        }
+        csll_destroy_list(&list);
+    }
+
+    // Empty and single-node lists are already sorted; bad arguments are rejected
+    circular_singly_linked_list_t *list = csll_create();
+    ck_assert_int_eq(csll_sort(list, &int_comp_ctx), E_SUCCESS);
+    csll_push_tail(list, &nums[0]);
+    ck_assert_int_eq(csll_sort(list, &int_comp_ctx), E_SUCCESS);
+    ck_assert_ptr_eq(csll_peek_head(list), csll_peek_tail(list));
+    ck_assert_int_eq(csll_sort(NULL, &int_comp_ctx), E_LIST_ERROR);
+    ck_assert_int_eq(csll_sort(list, NULL), E_NULL_POINTER);
+
+    csll_destroy_list(&list);
+    free(nums);
+}
+END_TEST
+
+// TEST LIST
+static TFun csll_sort_tests[] =
+{
+    test_csll_sort_random,
+    test_csll_sort_stable,
+    test_csll_sort_runs,
+    NULL
+};
+
 static void add_tests(TCase * test_cases, TFun * test_functions)
 {
     while (* test_functions)
@@ -734,5 +1065,23 @@ Suite *circular_singly_linked_list_test_suite(void)
     add_tests(csll_remove_position_test_cases, csll_remove_position_test_list);
     suite_add_tcase(circular_singly_linked_list_test_suite, csll_remove_position_test_cases);
 
+    //Create csll_create_with_pool tests
+    TFun *csll_pool_test_list = csll_pool_tests;
+    TCase *csll_pool_test_cases = tcase_create(" csll_create_with_pool() Tests");
+    add_tests(csll_pool_test_cases, csll_pool_test_list);
+    suite_add_tcase(circular_singly_linked_list_test_suite, csll_pool_test_cases);
+
+    //Create csll cursor tests
+    TFun *csll_cursor_test_list = csll_cursor_tests;
+    TCase *csll_cursor_test_cases = tcase_create(" csll cursor Tests");
+    add_tests(csll_cursor_test_cases, csll_cursor_test_list);
+    suite_add_tcase(circular_singly_linked_list_test_suite, csll_cursor_test_cases);
+
+    //Create csll sort tests
+    TFun *csll_sort_test_list = csll_sort_tests;
+    TCase *csll_sort_test_cases = tcase_create(" csll_sort() Tests");
+    add_tests(csll_sort_test_cases, csll_sort_test_list);
+    suite_add_tcase(circular_singly_linked_list_test_suite, csll_sort_test_cases);
+
     return circular_singly_linked_list_test_suite;
 }
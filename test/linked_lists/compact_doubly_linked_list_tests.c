@@ -0,0 +1,345 @@
+#include <check.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "linked_lists/compact_doubly_linked_list.h"
+#include "exit_codes.h"
+
+#define NUM_VALUES 300
+
+static int values[NUM_VALUES];
+
+// fills values with 0 .. NUM_VALUES - 1 so tests can push their addresses
+static void fill_values(void)
+{
+    for (int idx = 0; idx < NUM_VALUES; idx++)
+    {
+        values[idx] = idx;
+    }
+}
+
+// CREATE LIST TESTS
+//***********************************************************************************************
+// ensure a new list is created empty and only allocates its array once it is needed
+START_TEST(test_cdll_create)
+{
+    compact_doubly_linked_list_t *list = cdll_create();
+    ck_assert_ptr_ne(list, NULL);
+    ck_assert_int_eq(cdll_size(list), 0);
+    ck_assert_int_eq(cdll_capacity(list), 0);
+    ck_assert_ptr_eq(cdll_peek_head(list), NULL);
+    ck_assert_ptr_eq(cdll_peek_tail(list), NULL);
+
+    int num = 1;
+    cdll_push_tail(list, &num);
+    ck_assert_int_eq(cdll_capacity(list), CDLL_MIN_CAPACITY);
+
+    cdll_destroy_list(&list);
+    ck_assert_ptr_eq(list, NULL);
+    cdll_destroy_list(NULL);
+}
+END_TEST
+
+// ensure reserve grows the array ahead of time and never shrinks it
+START_TEST(test_cdll_reserve)
+{
+    compact_doubly_linked_list_t *list = cdll_create();
+
+    ck_assert_int_eq(cdll_reserve(list, 1000), E_SUCCESS);
+    ck_assert_int_eq(cdll_capacity(list), 1000);
+    ck_assert_int_eq(cdll_reserve(list, 10), E_SUCCESS);
+    ck_assert_int_eq(cdll_capacity(list), 1000);
+    ck_assert_int_eq(cdll_reserve(list, (size_t)CDLL_MAX_CAPACITY + 1), E_TOO_BIG);
+    ck_assert_int_eq(cdll_reserve(NULL, 10), E_LIST_ERROR);
+
+    cdll_destroy_list(&list);
+}
+END_TEST
+
+// TEST LIST
+static TFun cdll_create_tests[] =
+{
+    test_cdll_create,
+    test_cdll_reserve,
+    NULL
+};
+
+// PUSH AND PEEK TESTS
+//***********************************************************************************************
+// ensure pushes at either end and in the middle keep both directions in order
+START_TEST(test_cdll_push)
+{
+    fill_values();
+    compact_doubly_linked_list_t *list = cdll_create();
+
+    for (size_t idx = 0; idx < NUM_VALUES / 3; idx++)
+    {
+        ck_assert_int_eq(cdll_push_head(list, &values[NUM_VALUES / 3 - 1 - idx]), E_SUCCESS);
+        ck_assert_int_eq(cdll_push_tail(list, &values[2 * NUM_VALUES / 3 + idx]), E_SUCCESS);
+    }
+    for (size_t idx = 0; idx < NUM_VALUES / 3; idx++)
+    {
+        size_t position = NUM_VALUES / 3 + idx + 1;
+        ck_assert_int_eq(cdll_push_position(list, &values[NUM_VALUES / 3 + idx], position), E_SUCCESS);
+    }
+
+    ck_assert_int_eq(cdll_size(list), NUM_VALUES);
+    for (size_t idx = 0; idx < NUM_VALUES; idx++)
+    {
+        ck_assert_int_eq(*((int *)cdll_peek_position(list, idx + 1)), idx);
+    }
+    ck_assert_int_eq(*((int *)cdll_peek_head(list)), 0);
+    ck_assert_int_eq(*((int *)cdll_peek_tail(list)), NUM_VALUES - 1);
+
+    cdll_destroy_list(&list);
+}
+END_TEST
+
+// ensure pushes reject missing lists, data and positions outside the list
+START_TEST(test_cdll_push_errors)
+{
+    compact_doubly_linked_list_t *list = cdll_create();
+    int num = 1;
+
+    ck_assert_int_eq(cdll_push_head(NULL, &num), E_LIST_ERROR);
+    ck_assert_int_eq(cdll_push_tail(NULL, &num), E_LIST_ERROR);
+    ck_assert_int_eq(cdll_push_position(NULL, &num, 1), E_LIST_ERROR);
+    ck_assert_int_eq(cdll_push_head(list, NULL), E_NULL_POINTER);
+    ck_assert_int_eq(cdll_push_position(list, &num, 1), E_OUT_OF_BOUNDS);
+
+    cdll_push_tail(list, &num);
+    ck_assert_int_eq(cdll_push_position(list, &num, 0), E_OUT_OF_BOUNDS);
+    ck_assert_int_eq(cdll_push_position(list, &num, 2), E_OUT_OF_BOUNDS);
+    ck_assert_ptr_eq(cdll_peek_position(list, 2), NULL);
+    ck_assert_int_eq(cdll_size(list), 1);
+
+    cdll_destroy_list(&list);
+}
+END_TEST
+
+// TEST LIST
+static TFun cdll_push_tests[] =
+{
+    test_cdll_push,
+    test_cdll_push_errors,
+    NULL
+};
+
+// POP AND REMOVE TESTS
+//***********************************************************************************************
+// ensure a mix of positional edits matches a plain array doing the same edits
+START_TEST(test_cdll_matches_array)
+{
+    fill_values();
+    compact_doubly_linked_list_t *list = cdll_create();
+    int *model[NUM_VALUES];
+    size_t model_size = 0;
+    unsigned int seed = 77;
+
+    for (size_t step = 0; step < 10000; step++)
+    {
+        seed = seed * 1103515245 + 12345;
+        size_t roll = (seed >> 16) % 100;
+        int *data = &values[step % NUM_VALUES];
+
+        if (0 == model_size)
+        {
+            ck_assert_int_eq(cdll_push_head(list, data), E_SUCCESS);
+            model[model_size++] = data;
+        }
+        else if ((roll < 50) && (model_size < NUM_VALUES))
+        {
+            size_t position = 1 + ((seed >> 4) % model_size);
+            ck_assert_int_eq(cdll_push_position(list, data, position), E_SUCCESS);
+            for (size_t idx = model_size; idx >= position; idx--)
+            {
+                model[idx] = model[idx - 1];
+            }
+            model[position - 1] = data;
+            model_size++;
+        }
+        else if (roll < 60)
+        {
+            ck_assert_ptr_eq(cdll_pop_tail(list), model[--model_size]);
+        }
+        else
+        {
+            size_t position = 1 + ((seed >> 4) % model_size);
+            ck_assert_ptr_eq(cdll_pop_position(list, position), model[position - 1]);
+            for (size_t idx = position - 1; idx + 1 < model_size; idx++)
+            {
+                model[idx] = model[idx + 1];
+            }
+            model_size--;
+        }
+
+        ck_assert_int_eq(cdll_size(list), model_size);
+    }
+
+    for (size_t idx = 0; idx < model_size; idx++)
+    {
+        ck_assert_ptr_eq(cdll_peek_position(list, idx + 1), model[idx]);
+    }
+
+    // Released slots are reused, so the array never outgrew the most elements held at once
+    ck_assert_uint_le(cdll_capacity(list), 2 * NUM_VALUES);
+
+    cdll_destroy_list(&list);
+}
+END_TEST
+
+// ensure removals at either end and at a position unlink cleanly and report bad input
+START_TEST(test_cdll_remove)
+{
+    fill_values();
+    compact_doubly_linked_list_t *list = cdll_create();
+
+    for (size_t idx = 0; idx < 6; idx++)
+    {
+        cdll_push_tail(list, &values[idx]);
+    }
+
+    ck_assert_int_eq(cdll_remove_head(list), E_SUCCESS);
+    ck_assert_int_eq(cdll_remove_tail(list), E_SUCCESS);
+    ck_assert_int_eq(cdll_remove_position(list, 2), E_SUCCESS);
+    ck_assert_int_eq(cdll_remove_position(list, 0), E_OUT_OF_BOUNDS);
+    ck_assert_int_eq(cdll_remove_position(list, 4), E_OUT_OF_BOUNDS);
+    ck_assert_int_eq(*((int *)cdll_pop_head(list)), 1);
+    ck_assert_int_eq(*((int *)cdll_pop_tail(list)), 4);
+    ck_assert_int_eq(*((int *)cdll_pop_position(list, 1)), 3);
+
+    ck_assert_int_eq(cdll_size(list), 0);
+    ck_assert_ptr_eq(cdll_pop_head(list), NULL);
+    ck_assert_int_eq(cdll_remove_head(list), E_LIST_ERROR);
+    ck_assert_int_eq(cdll_remove_tail(list), E_LIST_ERROR);
+    ck_assert_int_eq(cdll_remove_position(NULL, 1), E_LIST_ERROR);
+
+    cdll_destroy_list(&list);
+}
+END_TEST
+
+// TEST LIST
+static TFun cdll_pop_tests[] =
+{
+    test_cdll_matches_array,
+    test_cdll_remove,
+    NULL
+};
+
+// CLONE AND CLEAR TESTS
+//***********************************************************************************************
+// ensure a clone holds the same values in the same order and is independent of the original
+START_TEST(test_cdll_clone)
+{
+    fill_values();
+    compact_doubly_linked_list_t *list = cdll_create();
+
+    for (size_t idx = 0; idx < 20; idx++)
+    {
+        cdll_push_tail(list, &values[idx]);
+    }
+    cdll_remove_position(list, 5); // leaves a slot on the free list
+
+    compact_doubly_linked_list_t *clone = cdll_clone(list);
+    ck_assert_ptr_ne(clone, NULL);
+    ck_assert_int_eq(cdll_size(clone), 19);
+    for (size_t idx = 1; idx <= 19; idx++)
+    {
+        ck_assert_ptr_eq(cdll_peek_position(clone, idx), cdll_peek_position(list, idx));
+    }
+
+    // The clone takes over the free slot without disturbing the original
+    cdll_push_head(clone, &values[100]);
+    cdll_pop_tail(list);
+    ck_assert_int_eq(*((int *)cdll_peek_head(clone)), 100);
+    ck_assert_int_eq(*((int *)cdll_peek_tail(clone)), 19);
+    ck_assert_int_eq(*((int *)cdll_peek_head(list)), 0);
+    ck_assert_int_eq(*((int *)cdll_peek_tail(list)), 18);
+
+    compact_doubly_linked_list_t *empty = cdll_create();
+    compact_doubly_linked_list_t *empty_clone = cdll_clone(empty);
+    ck_assert_int_eq(cdll_size(empty_clone), 0);
+    ck_assert_int_eq(cdll_push_tail(empty_clone, &values[1]), E_SUCCESS);
+    ck_assert_ptr_eq(cdll_clone(NULL), NULL);
+
+    cdll_destroy_list(&empty_clone);
+    cdll_destroy_list(&empty);
+    cdll_destroy_list(&clone);
+    cdll_destroy_list(&list);
+}
+END_TEST
+
+// ensure clearing keeps the array and leaves the list ready for reuse
+START_TEST(test_cdll_clear)
+{
+    fill_values();
+    compact_doubly_linked_list_t *list = cdll_create();
+
+    for (size_t idx = 0; idx < 50; idx++)
+    {
+        cdll_push_tail(list, &values[idx]);
+    }
+    size_t capacity = cdll_capacity(list);
+
+    cdll_clear_list(&list);
+    ck_assert_int_eq(cdll_size(list), 0);
+    ck_assert_int_eq(cdll_capacity(list), capacity);
+    ck_assert_ptr_eq(cdll_peek_head(list), NULL);
+
+    cdll_push_tail(list, &values[9]);
+    cdll_push_head(list, &values[8]);
+    ck_assert_int_eq(*((int *)cdll_peek_position(list, 2)), 9);
+    ck_assert_int_eq(cdll_capacity(list), capacity);
+
+    cdll_destroy_list(&list);
+}
+END_TEST
+
+// TEST LIST
+static TFun cdll_clone_tests[] =
+{
+    test_cdll_clone,
+    test_cdll_clear,
+    NULL
+};
+
+static void add_tests(TCase * test_cases, TFun * test_functions)
+{
+    while (* test_functions)
+    {
+        // add the test from the core_tests array to the tcase
+        tcase_add_test(test_cases, * test_functions);
+        test_functions++;
+    }
+}
+
+Suite *compact_doubly_linked_list_test_suite(void)
+{
+    Suite *compact_doubly_linked_list_test_suite = suite_create("Compact Doubly Linked List Tests");
+
+    // Create cdll_create() / cdll_reserve() tests
+    TFun *cdll_create_test_list = cdll_create_tests;
+    TCase *cdll_create_test_cases = tcase_create(" cdll_create() / cdll_reserve() Tests");
+    add_tests(cdll_create_test_cases, cdll_create_test_list);
+    suite_add_tcase(compact_doubly_linked_list_test_suite, cdll_create_test_cases);
+
+    // Create cdll_push() / cdll_peek() tests
+    TFun *cdll_push_test_list = cdll_push_tests;
+    TCase *cdll_push_test_cases = tcase_create(" cdll_push() / cdll_peek() Tests");
+    add_tests(cdll_push_test_cases, cdll_push_test_list);
+    suite_add_tcase(compact_doubly_linked_list_test_suite, cdll_push_test_cases);
+
+    // Create cdll_pop() / cdll_remove() tests
+    TFun *cdll_pop_test_list = cdll_pop_tests;
+    TCase *cdll_pop_test_cases = tcase_create(" cdll_pop() / cdll_remove() Tests");
+    add_tests(cdll_pop_test_cases, cdll_pop_test_list);
+    suite_add_tcase(compact_doubly_linked_list_test_suite, cdll_pop_test_cases);
+
+    // Create cdll_clone() / cdll_clear_list() tests
+    TFun *cdll_clone_test_list = cdll_clone_tests;
+    TCase *cdll_clone_test_cases = tcase_create(" cdll_clone() / cdll_clear_list() Tests");
+    add_tests(cdll_clone_test_cases, cdll_clone_test_list);
+    suite_add_tcase(compact_doubly_linked_list_test_suite, cdll_clone_test_cases);
+
+    return compact_doubly_linked_list_test_suite;
+}
@@ -4,6 +4,7 @@
 
 #include "linked_lists/doubly_linked_list.h"
 #include "void_pointer_functions.h"
+#include "utilities/comparison_helpers.h"
 #include "exit_codes.h"
 
 struct dll_node
@@ -18,6 +19,8 @@ struct doubly_linked_list
     dll_node_t *head;
     dll_node_t *tail;
     size_t current_size;
+    node_pool_t *pool;
+    bool owns_pool;
 };
 
 // CREATE LIST TESTS
@@ -645,6 +648,362 @@ static TFun dll_remove_position_tests[] =
     NULL
 };
 
+// DLL POOL TESTS
+//***********************************************************************************************
+// ensure lists sharing a pool take nodes from it and hand them back for each other to reuse
+START_TEST(test_dll_create_with_pool)
+{
+    node_pool_t *pool = node_pool_create(dll_node_size(), 0);
+    doubly_linked_list_t *first = dll_create_with_pool(pool);
+    doubly_linked_list_t *second = dll_create_with_pool(pool);
+    ck_assert_ptr_ne(first, NULL);
+    ck_assert_ptr_ne(second, NULL);
+
+    int nums[] = {10, 20, 30};
+    for (size_t idx = 0; idx < 3; idx++)
+    {
+        ck_assert_int_eq(dll_push_tail(first, &nums[idx]), E_SUCCESS);
+        ck_assert_int_eq(dll_push_head(second, &nums[idx]), E_SUCCESS);
+    }
+    ck_assert_int_eq(node_pool_in_use(pool), 6);
+
+    ck_assert_int_eq(*((int *)dll_pop_head(first)), 10);
+    ck_assert_int_eq(node_pool_in_use(pool), 5);
+
+    ck_assert_int_eq(dll_push_tail(second, &nums[0]), E_SUCCESS);
+    ck_assert_int_eq(*((int *)dll_peek_tail(second)), 10);
+    ck_assert_int_eq(node_pool_in_use(pool), 6);
+
+    // Destroying one list returns only its own nodes
+    dll_destroy_list(&first);
+    ck_assert_int_eq(node_pool_in_use(pool), 4);
+    ck_assert_int_eq(*((int *)dll_peek_head(second)), 30);
+
+    dll_destroy_list(&second);
+    ck_assert_int_eq(node_pool_in_use(pool), 0);
+    node_pool_destroy(&pool);
+}
+END_TEST
+
+// ensure a pool whose nodes are too small is rejected
+START_TEST(test_dll_create_with_pool_small_nodes)
+{
+    node_pool_t *pool = node_pool_create(1, 0);
+
+    ck_assert_ptr_eq(dll_create_with_pool(pool), NULL);
+    ck_assert_ptr_eq(dll_create_with_pool(NULL), NULL);
+
+    node_pool_destroy(&pool);
+}
+END_TEST
+
+// TEST LIST
+static TFun dll_pool_tests[] =
+{
+    test_dll_create_with_pool,
+    test_dll_create_with_pool_small_nodes,
+    NULL
+};
+
+// DLL CURSOR TESTS
+//***********************************************************************************************
+// ensure a cursor walks both ways and steps back onto the tail from past the end
+START_TEST(test_dll_cursor_walk)
+{
+    doubly_linked_list_t *list = dll_create();
+    int nums[] = {1, 2, 3, 4};
+
+    for (size_t idx = 0; idx < 4; idx++)
+    {
+        dll_push_tail(list, &nums[idx]);
+    }
+
+    dll_cursor_t cursor;
+    dll_cursor_head(list, &cursor);
+    for (size_t idx = 0; idx < 4; idx++)
+    {
+        ck_assert_int_eq(*((int *)dll_cursor_get(&cursor)), nums[idx]);
+        ck_assert_int_eq(dll_cursor_next(&cursor), E_SUCCESS);
+    }
+    ck_assert_ptr_eq(dll_cursor_get(&cursor), NULL);
+    ck_assert_int_eq(dll_cursor_next(&cursor), E_OUT_OF_BOUNDS);
+
+    for (size_t idx = 4; idx > 0; idx--)
+    {
+        ck_assert_int_eq(dll_cursor_prev(&cursor), E_SUCCESS);
+        ck_assert_int_eq(*((int *)dll_cursor_get(&cursor)), nums[idx - 1]);
+    }
+    ck_assert_int_eq(dll_cursor_prev(&cursor), E_OUT_OF_BOUNDS);
+
+    dll_cursor_tail(list, &cursor);
+    ck_assert_int_eq(*((int *)dll_cursor_get(&cursor)), 4);
+
+    dll_destroy_list(&list);
+}
+END_TEST
+
+// ensure a cursor can erase while walking backwards, keeping both directions linked
+START_TEST(test_dll_cursor_erase)
+{
+    doubly_linked_list_t *list = dll_create();
+    int nums[] = {1, 2, 3, 4, 5, 6};
+
+    for (size_t idx = 0; idx < 6; idx++)
+    {
+        dll_push_tail(list, &nums[idx]);
+    }
+
+    // Erase the odd values, walking from the tail
+    dll_cursor_t cursor;
+    dll_cursor_tail(list, &cursor);
+    for (;;)
+    {
+        bool odd = (1 == *((int *)dll_cursor_get(&cursor)) % 2);
+        bool at_head = (E_SUCCESS != dll_cursor_prev(&cursor));
+
+        if (true == odd)
+        {
+            // prev has already moved on unless the cursor is on the head
+            if (false == at_head)
+            {
+                dll_cursor_next(&cursor);
+            }
+            ck_assert_int_eq(dll_cursor_erase(&cursor), E_SUCCESS);
+            if (true == at_head)
+            {
+                break;
+            }
+            dll_cursor_prev(&cursor);
+            dll_cursor_prev(&cursor);
+        }
+        else if (true == at_head)
+        {
+            break;
+        }
+    }
+
+    ck_assert_int_eq(list->current_size, 3);
+    ck_assert_int_eq(*((int *)dll_peek_head(list)), 2);
+    ck_assert_int_eq(*((int *)dll_peek_tail(list)), 6);
+    ck_assert_ptr_eq(list->head->prev, NULL);
+    ck_assert_ptr_eq(list->tail->next, NULL);
+    ck_assert_ptr_eq(list->head->next->next, list->tail);
+    ck_assert_ptr_eq(list->tail->prev->prev, list->head);
+    ck_assert_int_eq(*((int *)list->head->next->data), 4);
+
+    dll_destroy_list(&list);
+}
+END_TEST
+
+// ensure a cursor inserts before and after itself, keeping the head and tail up to date
+START_TEST(test_dll_cursor_insert)
+{
+    doubly_linked_list_t *list = dll_create();
+    int nums[] = {10, 20, 30, 40};
+
+    dll_cursor_t cursor;
+    dll_cursor_head(list, &cursor);
+    ck_assert_int_eq(dll_cursor_insert_after(&cursor, &nums[0]), E_OUT_OF_BOUNDS);
+    ck_assert_int_eq(dll_cursor_insert_before(&cursor, &nums[3]), E_SUCCESS);
+
+    dll_cursor_head(list, &cursor);
+    ck_assert_int_eq(dll_cursor_insert_before(&cursor, &nums[0]), E_SUCCESS);
+    ck_assert_int_eq(dll_cursor_insert_before(&cursor, &nums[2]), E_SUCCESS);
+    ck_assert_int_eq(dll_cursor_prev(&cursor), E_SUCCESS);
+    ck_assert_int_eq(dll_cursor_insert_before(&cursor, &nums[1]), E_SUCCESS);
+
+    ck_assert_int_eq(list->current_size, 4);
+    dll_cursor_tail(list, &cursor);
+    for (size_t idx = 4; idx > 0; idx--)
+    {
+        ck_assert_int_eq(*((int *)dll_cursor_get(&cursor)), nums[idx - 1]);
+        dll_cursor_prev(&cursor);
+    }
+
+    dll_cursor_tail(list, &cursor);
+    int extra = 50;
+    ck_assert_int_eq(dll_cursor_insert_after(&cursor, &extra), E_SUCCESS);
+    ck_assert_int_eq(*((int *)dll_peek_tail(list)), 50);
+    ck_assert_int_eq(*((int *)list->tail->prev->data), 40);
+
+    dll_destroy_list(&list);
+}
+END_TEST
+
+// TEST LIST
+static TFun dll_cursor_tests[] =
+{
+    test_dll_cursor_walk,
+    test_dll_cursor_erase,
+    test_dll_cursor_insert,
+    NULL
+};
+
+// DLL SORT TESTS
+//***********************************************************************************************
+// orders ints and counts how often it is called, so tests can check presorted input stays near linear
+static int counting_int_comp_dll(const void *x, const void *y, const void *ctx)
+{
+    (*(size_t *)ctx)++;
+    return int_comp(x, y, NULL);
+}
+
+// orders sort_pair_t by key alone, so equal keys show whether the original order survived
+typedef struct sort_pair_dll
+{
+    int key;
+    int order;
+} sort_pair_dll_t;
+
+static int pair_key_comp_dll(const void *x, const void *y, const void *ctx)
+{
+    (void)ctx;
+    return ((const sort_pair_dll_t *)x)->key - ((const sort_pair_dll_t *)y)->key;
+}
+
+static int qsort_int_comp_dll(const void *x, const void *y)
+{
+    return *(const int *)x - *(const int *)y;
+}
+
+// ensure random values come out in the same order as qsort puts them
+START_TEST(test_dll_sort_random)
+{
+    enum { NUM_SORT = 2000 };
+    int *nums = malloc(NUM_SORT * sizeof(int));
+    int *expected = malloc(NUM_SORT * sizeof(int));
+    unsigned int seed = 99;
+    doubly_linked_list_t *list = dll_create();
+
+    for (size_t idx = 0; idx < NUM_SORT; idx++)
+    {
+        seed = seed * 1103515245 + 12345;
+        nums[idx] = (int)((seed >> 16) % 500);
+        expected[idx] = nums[idx];
+        dll_push_tail(list, &nums[idx]);
+    }
+    qsort(expected, NUM_SORT, sizeof(int), qsort_int_comp_dll);
+
+    ck_assert_int_eq(dll_sort(list, &int_comp_ctx), E_SUCCESS);
+    ck_assert_int_eq(list->current_size, NUM_SORT);
+    ck_assert_int_eq(*((int *)dll_peek_tail(list)), expected[NUM_SORT - 1]);
+
+    // Both directions must agree after the relink
+    ck_assert_ptr_eq(list->head->prev, NULL);
+    ck_assert_ptr_eq(list->tail->next, NULL);
+    for (dll_node_t *node = list->head; NULL != node->next; node = node->next)
+    {
+        ck_assert_ptr_eq(node->next->prev, node);
+        ck_assert_int_le(*((int *)node->data), *((int *)node->next->data));
+    }
+
+    for (size_t idx = 0; idx < NUM_SORT; idx++)
+    {
+        ck_assert_int_eq(*((int *)dll_pop_head(list)), expected[idx]);
+    }
+
+    dll_destroy_list(&list);
+    free(nums);
+    free(expected);
+}
+END_TEST
+
+// ensure equal keys keep their original order, including inside descending runs
+START_TEST(test_dll_sort_stable)
+{
+    enum { NUM_PAIRS = 300 };
+    sort_pair_dll_t pairs[NUM_PAIRS];
+    compare_ctx by_key = {pair_key_comp_dll, NULL};
+    doubly_linked_list_t *list = dll_create();
+
+    // Keys fall in steps of three equal values, then a few ascending stretches follow
+    for (int idx = 0; idx < NUM_PAIRS; idx++)
+    {
+        pairs[idx].key = (idx < 200) ? (200 - idx) / 3 : idx % 7;
+        pairs[idx].order = idx;
+        dll_push_tail(list, &pairs[idx]);
+    }
+
+    ck_assert_int_eq(dll_sort(list, &by_key), E_SUCCESS);
+
+    sort_pair_dll_t *previous = dll_pop_head(list);
+    for (size_t idx = 1; idx < NUM_PAIRS; idx++)
+    {
+        sort_pair_dll_t *current = dll_pop_head(list);
+        ck_assert_int_le(previous->key, current->key);
+        if (previous->key == current->key)
+        {
+            ck_assert_int_lt(previous->order, current->order);
+        }
+        previous = current;
+    }
+
+    dll_destroy_list(&list);
+}
+END_TEST
+
+// ensure sorted and reversed lists take about one comparison per node, and nearly sorted ones a few
+START_TEST(test_dll_sort_runs)
+{
+    enum { NUM_RUN = 5000 };
+    int *nums = malloc(NUM_RUN * sizeof(int));
+    size_t comparisons = 0;
+    compare_ctx counting = {counting_int_comp_dll, &comparisons};
+
+    for (int pass = 0; pass < 3; pass++)
+    {
+        doubly_linked_list_t *list = dll_create();
+        for (int idx = 0; idx < NUM_RUN; idx++)
+        {
+            nums[idx] = (1 == pass) ? NUM_RUN - idx : idx;
+            dll_push_tail(list, &nums[idx]);
+        }
+
+        // The third pass swaps a handful of neighbours out of place
+        if (2 == pass)
+        {
+            for (int idx = 100; idx < NUM_RUN; idx += 1000)
+            {
+                nums[idx] = idx + 1;
+                nums[idx + 1] = idx;
+            }
+        }
+
+        // One run takes one comparison per node; the six runs of the third pass cost about log2(6) per node
+        comparisons = 0;
+        ck_assert_int_eq(dll_sort(list, &counting), E_SUCCESS);
+        ck_assert_uint_lt(comparisons, ((2 == pass) ? 4 : 2) * NUM_RUN);
+
+        for (int idx = 0; idx < NUM_RUN; idx++)
+        {
+            ck_assert_int_eq(*((int *)dll_pop_head(list)), (1 == pass) ? idx + 1 : idx);
+        }
+        dll_destroy_list(&list);
+    }
+
+    // Empty and single-node lists are already sorted; bad arguments are rejected
+    doubly_linked_list_t *list = dll_create();
+    ck_assert_int_eq(dll_sort(list, &int_comp_ctx), E_SUCCESS);
+    dll_push_tail(list, &nums[0]);
+    ck_assert_int_eq(dll_sort(list, &int_comp_ctx), E_SUCCESS);
+    ck_assert_ptr_eq(dll_peek_head(list), dll_peek_tail(list));
+    ck_assert_int_eq(dll_sort(NULL, &int_comp_ctx), E_LIST_ERROR);
+    ck_assert_int_eq(dll_sort(list, NULL), E_NULL_POINTER);
+
+    dll_destroy_list(&list);
+    free(nums);
+}
+END_TEST
+
+// TEST LIST
+static TFun dll_sort_tests[] =
+{
+    test_dll_sort_random,
+    test_dll_sort_stable,
+    test_dll_sort_runs,
+    NULL
+};
+
 static void add_tests(TCase * test_cases, TFun * test_functions)
 {
     while (* test_functions)
@@ -737,5 +1096,23 @@ Suite *doubly_linked_list_test_suite(void)
     add_tests(dll_remove_position_test_cases, dll_remove_position_test_list);
     suite_add_tcase(doubly_linked_list_test_suite, dll_remove_position_test_cases);
 
+    //Create dll_create_with_pool tests
+    TFun *dll_pool_test_list = dll_pool_tests;
+    TCase *dll_pool_test_cases = tcase_create(" dll_create_with_pool() Tests");
+    add_tests(dll_pool_test_cases, dll_pool_test_list);
+    suite_add_tcase(doubly_linked_list_test_suite, dll_pool_test_cases);
+
+    //Create dll cursor tests
+    TFun *dll_cursor_test_list = dll_cursor_tests;
+    TCase *dll_cursor_test_cases = tcase_create(" dll cursor Tests");
+    add_tests(dll_cursor_test_cases, dll_cursor_test_list);
+    suite_add_tcase(doubly_linked_list_test_suite, dll_cursor_test_cases);
+
+    //Create dll sort tests
+    TFun *dll_sort_test_list = dll_sort_tests;
+    TCase *dll_sort_test_cases = tcase_create(" dll_sort() Tests");
+    add_tests(dll_sort_test_cases, dll_sort_test_list);
+    suite_add_tcase(doubly_linked_list_test_suite, dll_sort_test_cases);
+
     return doubly_linked_list_test_suite;
 }
@@ -0,0 +1,331 @@
+#include <check.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "linked_lists/indexable_skip_list.h"
+#include "exit_codes.h"
+
+#define NUM_VALUES 500
+#define NUM_LARGE 200000
+
+static int values[NUM_VALUES];
+
+// fills values with 0 .. NUM_VALUES - 1 so tests can push their addresses
+static void fill_values(void)
+{
+    for (int idx = 0; idx < NUM_VALUES; idx++)
+    {
+        values[idx] = idx;
+    }
+}
+
+// CREATE LIST TESTS
+//***********************************************************************************************
+// ensure a new skip list is created empty
+START_TEST(test_isl_create)
+{
+    indexable_skip_list_t *list = isl_create();
+    ck_assert_ptr_ne(list, NULL);
+    ck_assert_int_eq(isl_size(list), 0);
+    ck_assert_ptr_eq(isl_peek_head(list), NULL);
+    ck_assert_ptr_eq(isl_peek_tail(list), NULL);
+    ck_assert_ptr_eq(isl_peek_position(list, 1), NULL);
+
+    isl_destroy_list(&list);
+    ck_assert_ptr_eq(list, NULL);
+    isl_destroy_list(NULL);
+}
+END_TEST
+
+// TEST LIST
+static TFun isl_create_tests[] =
+{
+    test_isl_create,
+    NULL
+};
+
+// PUSH AND PEEK TESTS
+//***********************************************************************************************
+// ensure pushes at either end keep the order they were made in
+START_TEST(test_isl_push_ends)
+{
+    fill_values();
+    indexable_skip_list_t *list = isl_create();
+
+    for (size_t idx = 0; idx < NUM_VALUES / 2; idx++)
+    {
+        ck_assert_int_eq(isl_push_head(list, &values[NUM_VALUES / 2 - 1 - idx]), E_SUCCESS);
+        ck_assert_int_eq(isl_push_tail(list, &values[NUM_VALUES / 2 + idx]), E_SUCCESS);
+    }
+
+    ck_assert_int_eq(isl_size(list), NUM_VALUES);
+    ck_assert_int_eq(*((int *)isl_peek_head(list)), 0);
+    ck_assert_int_eq(*((int *)isl_peek_tail(list)), NUM_VALUES - 1);
+    for (size_t idx = 0; idx < NUM_VALUES; idx++)
+    {
+        ck_assert_int_eq(*((int *)isl_peek_position(list, idx + 1)), idx);
+    }
+
+    ck_assert_ptr_eq(isl_peek_position(list, 0), NULL);
+    ck_assert_ptr_eq(isl_peek_position(list, NUM_VALUES + 1), NULL);
+
+    isl_destroy_list(&list);
+}
+END_TEST
+
+// ensure pushes reject missing lists, data and positions outside the list
+START_TEST(test_isl_push_errors)
+{
+    indexable_skip_list_t *list = isl_create();
+    int num = 1;
+
+    ck_assert_int_eq(isl_push_head(NULL, &num), E_LIST_ERROR);
+    ck_assert_int_eq(isl_push_tail(NULL, &num), E_LIST_ERROR);
+    ck_assert_int_eq(isl_push_position(NULL, &num, 1), E_LIST_ERROR);
+    ck_assert_int_eq(isl_push_head(list, NULL), E_NULL_POINTER);
+    ck_assert_int_eq(isl_push_tail(list, NULL), E_NULL_POINTER);
+    ck_assert_int_eq(isl_push_position(list, &num, 1), E_OUT_OF_BOUNDS);
+
+    isl_push_tail(list, &num);
+    ck_assert_int_eq(isl_push_position(list, &num, 0), E_OUT_OF_BOUNDS);
+    ck_assert_int_eq(isl_push_position(list, &num, 2), E_OUT_OF_BOUNDS);
+    ck_assert_int_eq(isl_size(list), 1);
+
+    isl_destroy_list(&list);
+}
+END_TEST
+
+// TEST LIST
+static TFun isl_push_tests[] =
+{
+    test_isl_push_ends,
+    test_isl_push_errors,
+    NULL
+};
+
+// POSITION TESTS
+//***********************************************************************************************
+// ensure a mix of positional edits matches a plain array doing the same edits
+START_TEST(test_isl_position_matches_array)
+{
+    fill_values();
+    indexable_skip_list_t *list = isl_create();
+    int *model[NUM_VALUES];
+    size_t model_size = 0;
+    unsigned int seed = 2024;
+
+    for (size_t step = 0; step < 20000; step++)
+    {
+        seed = seed * 1103515245 + 12345;
+        size_t roll = (seed >> 16) % 100;
+        int *data = &values[step % NUM_VALUES];
+
+        if (0 == model_size)
+        {
+            ck_assert_int_eq(isl_push_head(list, data), E_SUCCESS);
+            model[model_size++] = data;
+        }
+        else if ((roll < 50) && (model_size < NUM_VALUES))
+        {
+            size_t position = 1 + ((seed >> 4) % model_size);
+            ck_assert_int_eq(isl_push_position(list, data, position), E_SUCCESS);
+            for (size_t idx = model_size; idx >= position; idx--)
+            {
+                model[idx] = model[idx - 1];
+            }
+            model[position - 1] = data;
+            model_size++;
+        }
+        else if ((roll < 55) && (model_size < NUM_VALUES))
+        {
+            ck_assert_int_eq(isl_push_tail(list, data), E_SUCCESS);
+            model[model_size++] = data;
+        }
+        else
+        {
+            size_t position = 1 + ((seed >> 4) % model_size);
+            ck_assert_ptr_eq(isl_pop_position(list, position), model[position - 1]);
+            for (size_t idx = position - 1; idx + 1 < model_size; idx++)
+            {
+                model[idx] = model[idx + 1];
+            }
+            model_size--;
+        }
+
+        ck_assert_int_eq(isl_size(list), model_size);
+        if (0 != model_size)
+        {
+            ck_assert_ptr_eq(isl_peek_head(list), model[0]);
+            ck_assert_ptr_eq(isl_peek_tail(list), model[model_size - 1]);
+        }
+    }
+
+    for (size_t idx = 0; idx < model_size; idx++)
+    {
+        ck_assert_ptr_eq(isl_peek_position(list, idx + 1), model[idx]);
+    }
+
+    isl_destroy_list(&list);
+}
+END_TEST
+
+// ensure positional access stays quick on a large list
+START_TEST(test_isl_position_large)
+{
+    indexable_skip_list_t *list = isl_create();
+    size_t *large = malloc(NUM_LARGE * sizeof(size_t));
+
+    for (size_t idx = 0; idx < NUM_LARGE; idx++)
+    {
+        large[idx] = idx;
+        ck_assert_int_eq(isl_push_tail(list, &large[idx]), E_SUCCESS);
+    }
+
+    for (size_t idx = 1; idx <= NUM_LARGE; idx += 997)
+    {
+        ck_assert_int_eq(*((size_t *)isl_peek_position(list, idx)), idx - 1);
+    }
+
+    // Repeatedly taking the middle element removes every value from the middle outwards
+    for (size_t idx = 0; idx < 1000; idx++)
+    {
+        size_t middle = (NUM_LARGE - idx + 1) / 2;
+        size_t expected = *((size_t *)isl_peek_position(list, middle));
+        ck_assert_int_eq(*((size_t *)isl_pop_position(list, middle)), expected);
+    }
+
+    ck_assert_int_eq(isl_size(list), NUM_LARGE - 1000);
+    ck_assert_int_eq(*((size_t *)isl_peek_position(list, NUM_LARGE / 2 - 500)), NUM_LARGE / 2 - 501);
+    ck_assert_int_eq(*((size_t *)isl_peek_position(list, NUM_LARGE / 2 - 499)), NUM_LARGE / 2 + 500);
+    ck_assert_int_eq(*((size_t *)isl_peek_tail(list)), NUM_LARGE - 1);
+
+    isl_destroy_list(&list);
+    free(large);
+}
+END_TEST
+
+// TEST LIST
+static TFun isl_position_tests[] =
+{
+    test_isl_position_matches_array,
+    test_isl_position_large,
+    NULL
+};
+
+// POP AND REMOVE TESTS
+//***********************************************************************************************
+// ensure popping from both ends drains the list in order and leaves it usable
+START_TEST(test_isl_pop_ends)
+{
+    fill_values();
+    indexable_skip_list_t *list = isl_create();
+
+    for (size_t idx = 0; idx < NUM_VALUES; idx++)
+    {
+        isl_push_tail(list, &values[idx]);
+    }
+
+    for (size_t idx = 0; idx < NUM_VALUES / 2; idx++)
+    {
+        ck_assert_int_eq(*((int *)isl_pop_head(list)), idx);
+        ck_assert_int_eq(*((int *)isl_pop_tail(list)), NUM_VALUES - 1 - idx);
+    }
+
+    ck_assert_int_eq(isl_size(list), 0);
+    ck_assert_ptr_eq(isl_pop_head(list), NULL);
+    ck_assert_ptr_eq(isl_pop_tail(list), NULL);
+    ck_assert_ptr_eq(isl_pop_position(list, 1), NULL);
+
+    isl_push_head(list, &values[7]);
+    ck_assert_ptr_eq(isl_peek_head(list), isl_peek_tail(list));
+
+    isl_destroy_list(&list);
+}
+END_TEST
+
+// ensure removals keep the remaining positions in step and report bad positions
+START_TEST(test_isl_remove)
+{
+    fill_values();
+    indexable_skip_list_t *list = isl_create();
+
+    for (size_t idx = 0; idx < 10; idx++)
+    {
+        isl_push_tail(list, &values[idx]);
+    }
+
+    ck_assert_int_eq(isl_remove_head(list), E_SUCCESS);
+    ck_assert_int_eq(isl_remove_tail(list), E_SUCCESS);
+    ck_assert_int_eq(isl_remove_position(list, 4), E_SUCCESS);
+    ck_assert_int_eq(isl_remove_position(list, 0), E_OUT_OF_BOUNDS);
+    ck_assert_int_eq(isl_remove_position(list, 8), E_OUT_OF_BOUNDS);
+
+    int expected[] = {1, 2, 3, 5, 6, 7, 8};
+    ck_assert_int_eq(isl_size(list), 7);
+    for (size_t idx = 0; idx < 7; idx++)
+    {
+        ck_assert_int_eq(*((int *)isl_peek_position(list, idx + 1)), expected[idx]);
+    }
+
+    isl_clear_list(&list);
+    ck_assert_int_eq(isl_size(list), 0);
+    ck_assert_ptr_eq(isl_peek_tail(list), NULL);
+    ck_assert_int_eq(isl_remove_head(list), E_LIST_ERROR);
+    ck_assert_int_eq(isl_remove_tail(list), E_LIST_ERROR);
+    ck_assert_int_eq(isl_remove_position(NULL, 1), E_LIST_ERROR);
+
+    isl_push_tail(list, &values[3]);
+    ck_assert_int_eq(*((int *)isl_peek_position(list, 1)), 3);
+
+    isl_destroy_list(&list);
+}
+END_TEST
+
+// TEST LIST
+static TFun isl_pop_tests[] =
+{
+    test_isl_pop_ends,
+    test_isl_remove,
+    NULL
+};
+
+static void add_tests(TCase * test_cases, TFun * test_functions)
+{
+    while (* test_functions)
+    {
+        // add the test from the core_tests array to the tcase
+        tcase_add_test(test_cases, * test_functions);
+        test_functions++;
+    }
+}
+
+Suite *indexable_skip_list_test_suite(void)
+{
+    Suite *indexable_skip_list_test_suite = suite_create("Indexable Skip List Tests");
+
+    // Create isl_create() tests
+    TFun *isl_create_test_list = isl_create_tests;
+    TCase *isl_create_test_cases = tcase_create(" isl_create() Tests");
+    add_tests(isl_create_test_cases, isl_create_test_list);
+    suite_add_tcase(indexable_skip_list_test_suite, isl_create_test_cases);
+
+    // Create isl_push_head() / isl_push_tail() tests
+    TFun *isl_push_test_list = isl_push_tests;
+    TCase *isl_push_test_cases = tcase_create(" isl_push_head() / isl_push_tail() Tests");
+    add_tests(isl_push_test_cases, isl_push_test_list);
+    suite_add_tcase(indexable_skip_list_test_suite, isl_push_test_cases);
+
+    // Create isl_push_position() / isl_pop_position() tests
+    TFun *isl_position_test_list = isl_position_tests;
+    TCase *isl_position_test_cases = tcase_create(" isl_push_position() / isl_pop_position() Tests");
+    add_tests(isl_position_test_cases, isl_position_test_list);
+    suite_add_tcase(indexable_skip_list_test_suite, isl_position_test_cases);
+
+    // Create isl_pop_head() / isl_pop_tail() / isl_remove() tests
+    TFun *isl_pop_test_list = isl_pop_tests;
+    TCase *isl_pop_test_cases = tcase_create(" isl_pop_head() / isl_pop_tail() / isl_remove() Tests");
+    add_tests(isl_pop_test_cases, isl_pop_test_list);
+    suite_add_tcase(indexable_skip_list_test_suite, isl_pop_test_cases);
+
+    return indexable_skip_list_test_suite;
+}
@@ -0,0 +1,332 @@
+#include <check.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "linked_lists/intrusive_list.h"
+#include "exit_codes.h"
+
+// an object that can be on one of each kind of list at the same time
+typedef struct item
+{
+    int value;
+    isll_link_t singly;
+    idll_link_t doubly;
+    icsll_link_t circular;
+} item_t;
+
+static void fill_items(item_t *items, size_t count)
+{
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        items[idx].value = (int)idx;
+    }
+}
+
+// CONTAINER OF TESTS
+//***********************************************************************************************
+// ensure CONTAINER_OF gets back to the object from any of its links
+START_TEST(test_container_of)
+{
+    item_t item = {42, {NULL}, {NULL, NULL}, {NULL}};
+
+    ck_assert_ptr_eq(CONTAINER_OF(&item.singly, item_t, singly), &item);
+    ck_assert_ptr_eq(CONTAINER_OF(&item.doubly, item_t, doubly), &item);
+    ck_assert_ptr_eq(CONTAINER_OF(&item.circular, item_t, circular), &item);
+    ck_assert_int_eq(CONTAINER_OF(&item.circular, item_t, circular)->value, 42);
+}
+END_TEST
+
+// ensure one object can be on all three kinds of list at once
+START_TEST(test_intrusive_shared_objects)
+{
+    item_t items[4];
+    fill_items(items, 4);
+
+    isll_t singly;
+    idll_t doubly;
+    icsll_t circular;
+    isll_init(&singly);
+    idll_init(&doubly);
+    icsll_init(&circular);
+
+    for (size_t idx = 0; idx < 4; idx++)
+    {
+        isll_push_tail(&singly, &items[idx].singly);
+        idll_push_head(&doubly, &items[idx].doubly);
+        icsll_push_tail(&circular, &items[idx].circular);
+    }
+
+    ck_assert_int_eq(CONTAINER_OF(isll_peek_head(&singly), item_t, singly)->value, 0);
+    ck_assert_int_eq(CONTAINER_OF(idll_peek_head(&doubly), item_t, doubly)->value, 3);
+    ck_assert_int_eq(CONTAINER_OF(icsll_peek_tail(&circular), item_t, circular)->value, 3);
+
+    // Taking an object off one list leaves it on the others
+    ck_assert_int_eq(idll_remove(&doubly, &items[0].doubly), E_SUCCESS);
+    ck_assert_int_eq(doubly.current_size, 3);
+    ck_assert_int_eq(singly.current_size, 4);
+    ck_assert_int_eq(CONTAINER_OF(isll_pop_head(&singly), item_t, singly)->value, 0);
+    ck_assert_int_eq(CONTAINER_OF(icsll_pop_head(&circular), item_t, circular)->value, 0);
+}
+END_TEST
+
+// TEST LIST
+static TFun intrusive_container_tests[] =
+{
+    test_container_of,
+    test_intrusive_shared_objects,
+    NULL
+};
+
+// INTRUSIVE SINGLY LINKED TESTS
+//***********************************************************************************************
+// ensure pushes, inserts and pops keep the order and the tail
+START_TEST(test_isll_order)
+{
+    item_t items[5];
+    fill_items(items, 5);
+    isll_t list;
+    isll_init(&list);
+
+    ck_assert_ptr_eq(isll_pop_head(&list), NULL);
+    ck_assert_int_eq(isll_push_tail(&list, &items[1].singly), E_SUCCESS);
+    ck_assert_int_eq(isll_push_tail(&list, &items[3].singly), E_SUCCESS);
+    ck_assert_int_eq(isll_push_head(&list, &items[0].singly), E_SUCCESS);
+    ck_assert_int_eq(isll_insert_after(&list, &items[1].singly, &items[2].singly), E_SUCCESS);
+    ck_assert_int_eq(isll_insert_after(&list, &items[3].singly, &items[4].singly), E_SUCCESS);
+
+    ck_assert_ptr_eq(isll_peek_tail(&list), &items[4].singly);
+    ck_assert_int_eq(list.current_size, 5);
+
+    int expected = 0;
+    for (isll_link_t *link = isll_peek_head(&list); NULL != link; link = link->next)
+    {
+        ck_assert_int_eq(CONTAINER_OF(link, item_t, singly)->value, expected++);
+    }
+    ck_assert_int_eq(expected, 5);
+
+    for (int idx = 0; idx < 5; idx++)
+    {
+        ck_assert_int_eq(CONTAINER_OF(isll_pop_head(&list), item_t, singly)->value, idx);
+    }
+    ck_assert_ptr_eq(isll_peek_head(&list), NULL);
+    ck_assert_ptr_eq(isll_peek_tail(&list), NULL);
+}
+END_TEST
+
+// ensure remove_after unlinks in the middle and at the tail, and rejects bad arguments
+START_TEST(test_isll_remove_after)
+{
+    item_t items[3];
+    fill_items(items, 3);
+    isll_t list;
+    isll_init(&list);
+
+    for (size_t idx = 0; idx < 3; idx++)
+    {
+        isll_push_tail(&list, &items[idx].singly);
+    }
+
+    ck_assert_ptr_eq(isll_remove_after(&list, &items[1].singly), &items[2].singly);
+    ck_assert_ptr_eq(isll_peek_tail(&list), &items[1].singly);
+    ck_assert_ptr_eq(isll_remove_after(&list, &items[1].singly), NULL);
+    ck_assert_ptr_eq(isll_remove_after(&list, &items[0].singly), &items[1].singly);
+    ck_assert_ptr_eq(isll_peek_tail(&list), &items[0].singly);
+    ck_assert_int_eq(list.current_size, 1);
+
+    ck_assert_int_eq(isll_push_tail(NULL, &items[1].singly), E_LIST_ERROR);
+    ck_assert_int_eq(isll_push_head(&list, NULL), E_NULL_POINTER);
+    ck_assert_ptr_eq(isll_pop_head(NULL), NULL);
+}
+END_TEST
+
+// TEST LIST
+static TFun isll_tests[] =
+{
+    test_isll_order,
+    test_isll_remove_after,
+    NULL
+};
+
+// INTRUSIVE DOUBLY LINKED TESTS
+//***********************************************************************************************
+// ensure inserts on either side of a link keep both directions in step
+START_TEST(test_idll_order)
+{
+    item_t items[5];
+    fill_items(items, 5);
+    idll_t list;
+    idll_init(&list);
+
+    ck_assert_int_eq(idll_push_tail(&list, &items[2].doubly), E_SUCCESS);
+    ck_assert_int_eq(idll_insert_before(&list, &items[2].doubly, &items[0].doubly), E_SUCCESS);
+    ck_assert_int_eq(idll_insert_after(&list, &items[0].doubly, &items[1].doubly), E_SUCCESS);
+    ck_assert_int_eq(idll_insert_after(&list, &items[2].doubly, &items[4].doubly), E_SUCCESS);
+    ck_assert_int_eq(idll_insert_before(&list, &items[4].doubly, &items[3].doubly), E_SUCCESS);
+    ck_assert_int_eq(list.current_size, 5);
+
+    int expected = 0;
+    for (idll_link_t *link = idll_peek_head(&list); NULL != link; link = link->next)
+    {
+        ck_assert_int_eq(CONTAINER_OF(link, item_t, doubly)->value, expected++);
+    }
+    for (idll_link_t *link = idll_peek_tail(&list); NULL != link; link = link->prev)
+    {
+        ck_assert_int_eq(CONTAINER_OF(link, item_t, doubly)->value, --expected);
+    }
+
+    ck_assert_int_eq(CONTAINER_OF(idll_pop_tail(&list), item_t, doubly)->value, 4);
+    ck_assert_int_eq(CONTAINER_OF(idll_pop_head(&list), item_t, doubly)->value, 0);
+    ck_assert_ptr_eq(idll_peek_head(&list)->prev, NULL);
+    ck_assert_ptr_eq(idll_peek_tail(&list)->next, NULL);
+}
+END_TEST
+
+// ensure an object is unlinked in O(1) from the head, middle or tail given only its link
+START_TEST(test_idll_remove)
+{
+    item_t items[4];
+    fill_items(items, 4);
+    idll_t list;
+    idll_init(&list);
+
+    for (size_t idx = 0; idx < 4; idx++)
+    {
+        idll_push_tail(&list, &items[idx].doubly);
+    }
+
+    ck_assert_int_eq(idll_remove(&list, &items[1].doubly), E_SUCCESS);
+    ck_assert_ptr_eq(items[0].doubly.next, &items[2].doubly);
+    ck_assert_ptr_eq(items[2].doubly.prev, &items[0].doubly);
+
+    ck_assert_int_eq(idll_remove(&list, &items[3].doubly), E_SUCCESS);
+    ck_assert_ptr_eq(idll_peek_tail(&list), &items[2].doubly);
+    ck_assert_int_eq(idll_remove(&list, &items[0].doubly), E_SUCCESS);
+    ck_assert_ptr_eq(idll_peek_head(&list), &items[2].doubly);
+    ck_assert_int_eq(idll_remove(&list, &items[2].doubly), E_SUCCESS);
+    ck_assert_ptr_eq(idll_peek_head(&list), NULL);
+    ck_assert_ptr_eq(idll_peek_tail(&list), NULL);
+    ck_assert_int_eq(list.current_size, 0);
+    ck_assert_ptr_eq(idll_pop_head(&list), NULL);
+    ck_assert_ptr_eq(idll_pop_tail(&list), NULL);
+
+    ck_assert_int_eq(idll_remove(NULL, &items[0].doubly), E_LIST_ERROR);
+    ck_assert_int_eq(idll_remove(&list, NULL), E_NULL_POINTER);
+    ck_assert_int_eq(idll_insert_after(&list, NULL, &items[0].doubly), E_NULL_POINTER);
+}
+END_TEST
+
+// TEST LIST
+static TFun idll_tests[] =
+{
+    test_idll_order,
+    test_idll_remove,
+    NULL
+};
+
+// INTRUSIVE CIRCULAR SINGLY LINKED TESTS
+//***********************************************************************************************
+// ensure the list stays closed through pushes and rotations
+START_TEST(test_icsll_rotate)
+{
+    item_t items[4];
+    fill_items(items, 4);
+    icsll_t list;
+    icsll_init(&list);
+
+    ck_assert_int_eq(icsll_rotate(&list), E_LIST_ERROR);
+    ck_assert_int_eq(icsll_push_tail(&list, &items[1].circular), E_SUCCESS);
+    ck_assert_ptr_eq(items[1].circular.next, &items[1].circular);
+    ck_assert_int_eq(icsll_push_tail(&list, &items[2].circular), E_SUCCESS);
+    ck_assert_int_eq(icsll_push_tail(&list, &items[3].circular), E_SUCCESS);
+    ck_assert_int_eq(icsll_push_head(&list, &items[0].circular), E_SUCCESS);
+    ck_assert_ptr_eq(icsll_peek_tail(&list)->next, icsll_peek_head(&list));
+
+    // Rotating hands out every object in turn, over and over
+    for (int idx = 0; idx < 10; idx++)
+    {
+        ck_assert_int_eq(CONTAINER_OF(icsll_peek_head(&list), item_t, circular)->value, idx % 4);
+        ck_assert_int_eq(icsll_rotate(&list), E_SUCCESS);
+    }
+    ck_assert_int_eq(list.current_size, 4);
+}
+END_TEST
+
+// ensure removals keep the list closed and empty it cleanly
+START_TEST(test_icsll_remove_after)
+{
+    item_t items[3];
+    fill_items(items, 3);
+    icsll_t list;
+    icsll_init(&list);
+
+    for (size_t idx = 0; idx < 3; idx++)
+    {
+        icsll_push_tail(&list, &items[idx].circular);
+    }
+
+    // Removing after the middle object takes the tail
+    ck_assert_ptr_eq(icsll_remove_after(&list, &items[1].circular), &items[2].circular);
+    ck_assert_ptr_eq(icsll_peek_tail(&list), &items[1].circular);
+    ck_assert_ptr_eq(items[1].circular.next, &items[0].circular);
+
+    ck_assert_ptr_eq(icsll_pop_head(&list), &items[0].circular);
+    ck_assert_ptr_eq(items[1].circular.next, &items[1].circular);
+    ck_assert_ptr_eq(icsll_pop_head(&list), &items[1].circular);
+    ck_assert_ptr_eq(icsll_peek_head(&list), NULL);
+    ck_assert_ptr_eq(icsll_pop_head(&list), NULL);
+    ck_assert_int_eq(list.current_size, 0);
+
+    ck_assert_int_eq(icsll_push_head(NULL, &items[0].circular), E_LIST_ERROR);
+    ck_assert_int_eq(icsll_push_tail(&list, NULL), E_NULL_POINTER);
+    ck_assert_ptr_eq(list.tail, NULL);
+}
+END_TEST
+
+// TEST LIST
+static TFun icsll_tests[] =
+{
+    test_icsll_rotate,
+    test_icsll_remove_after,
+    NULL
+};
+
+static void add_tests(TCase * test_cases, TFun * test_functions)
+{
+    while (* test_functions)
+    {
+        // add the test from the core_tests array to the tcase
+        tcase_add_test(test_cases, * test_functions);
+        test_functions++;
+    }
+}
+
+Suite *intrusive_list_test_suite(void)
+{
+    Suite *intrusive_list_test_suite = suite_create("Intrusive List Tests");
+
+    // Create CONTAINER_OF() tests
+    TFun *intrusive_container_test_list = intrusive_container_tests;
+    TCase *intrusive_container_test_cases = tcase_create(" CONTAINER_OF() Tests");
+    add_tests(intrusive_container_test_cases, intrusive_container_test_list);
+    suite_add_tcase(intrusive_list_test_suite, intrusive_container_test_cases);
+
+    // Create isll tests
+    TFun *isll_test_list = isll_tests;
+    TCase *isll_test_cases = tcase_create(" isll Tests");
+    add_tests(isll_test_cases, isll_test_list);
+    suite_add_tcase(intrusive_list_test_suite, isll_test_cases);
+
+    // Create idll tests
+    TFun *idll_test_list = idll_tests;
+    TCase *idll_test_cases = tcase_create(" idll Tests");
+    add_tests(idll_test_cases, idll_test_list);
+    suite_add_tcase(intrusive_list_test_suite, idll_test_cases);
+
+    // Create icsll tests
+    TFun *icsll_test_list = icsll_tests;
+    TCase *icsll_test_cases = tcase_create(" icsll Tests");
+    add_tests(icsll_test_cases, icsll_test_list);
+    suite_add_tcase(intrusive_list_test_suite, icsll_test_cases);
+
+    return intrusive_list_test_suite;
+}
@@ -0,0 +1,191 @@
+#include <check.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "utilities/node_pool.h"
+#include "exit_codes.h"
+
+// NODE POOL CREATE TESTS
+//***********************************************************************************************
+// ensure a pool is created for any non-zero node size, rounded up to hold a pointer
+START_TEST(test_node_pool_create)
+{
+    node_pool_t *pool = node_pool_create(24, 0);
+    ck_assert_ptr_ne(pool, NULL);
+    ck_assert_int_eq(node_pool_node_size(pool), 24);
+    ck_assert_int_eq(node_pool_in_use(pool), 0);
+    node_pool_destroy(&pool);
+    ck_assert_ptr_eq(pool, NULL);
+
+    pool = node_pool_create(1, 0);
+    ck_assert_int_eq(node_pool_node_size(pool), sizeof(void *));
+    node_pool_destroy(&pool);
+
+    pool = node_pool_create(sizeof(void *) + 1, 0);
+    ck_assert_int_eq(node_pool_node_size(pool), 2 * sizeof(void *));
+    node_pool_destroy(&pool);
+
+    ck_assert_ptr_eq(node_pool_create(0, 0), NULL);
+    ck_assert_int_eq(node_pool_node_size(NULL), 0);
+    node_pool_destroy(NULL);
+    node_pool_destroy(&pool);
+}
+END_TEST
+
+// TEST LIST
+static TFun node_pool_create_tests[] =
+{
+    test_node_pool_create,
+    NULL
+};
+
+// NODE POOL ALLOC TESTS
+//***********************************************************************************************
+// ensure nodes are zeroed, distinct and aligned
+START_TEST(test_node_pool_alloc_distinct)
+{
+    enum { NUM_NODES = 5000 };
+    node_pool_t *pool = node_pool_create(24, 0);
+    unsigned char **nodes = calloc(NUM_NODES, sizeof(unsigned char *));
+
+    for (size_t idx = 0; idx < NUM_NODES; idx++)
+    {
+        nodes[idx] = node_pool_alloc(pool);
+        ck_assert_ptr_ne(nodes[idx], NULL);
+        ck_assert_int_eq((uintptr_t)nodes[idx] % _Alignof(void *), 0);
+
+        for (size_t byte = 0; byte < 24; byte++)
+        {
+            ck_assert_int_eq(nodes[idx][byte], 0);
+        }
+        memset(nodes[idx], 0xab, 24);
+    }
+    ck_assert_int_eq(node_pool_in_use(pool), NUM_NODES);
+
+    // Writing every node in full must not have touched any other node
+    for (size_t idx = 0; idx < NUM_NODES; idx++)
+    {
+        ck_assert_int_eq(nodes[idx][0], 0xab);
+        ck_assert_int_eq(nodes[idx][23], 0xab);
+    }
+
+    free(nodes);
+    node_pool_destroy(&pool);
+}
+END_TEST
+
+// ensure released nodes are reused, most recently released first, and come back zeroed
+START_TEST(test_node_pool_free_reuses)
+{
+    node_pool_t *pool = node_pool_create(16, 0);
+
+    void *first = node_pool_alloc(pool);
+    void *second = node_pool_alloc(pool);
+    memset(second, 0xff, 16);
+
+    node_pool_free(pool, first);
+    node_pool_free(pool, second);
+    node_pool_free(pool, NULL);
+    ck_assert_int_eq(node_pool_in_use(pool), 0);
+
+    unsigned char *again = node_pool_alloc(pool);
+    ck_assert_ptr_eq(again, second);
+    ck_assert_int_eq(again[8], 0);
+    ck_assert_ptr_eq(node_pool_alloc(pool), first);
+    ck_assert_int_eq(node_pool_in_use(pool), 2);
+
+    ck_assert_ptr_eq(node_pool_alloc(NULL), NULL);
+    node_pool_destroy(&pool);
+}
+END_TEST
+
+// ensure a small slab limit still serves any number of nodes
+START_TEST(test_node_pool_small_slabs)
+{
+    node_pool_t *pool = node_pool_create(32, 2);
+
+    for (size_t idx = 0; idx < 100; idx++)
+    {
+        ck_assert_ptr_ne(node_pool_alloc(pool), NULL);
+    }
+    ck_assert_int_eq(node_pool_in_use(pool), 100);
+
+    node_pool_destroy(&pool);
+}
+END_TEST
+
+// TEST LIST
+static TFun node_pool_alloc_tests[] =
+{
+    test_node_pool_alloc_distinct,
+    test_node_pool_free_reuses,
+    test_node_pool_small_slabs,
+    NULL
+};
+
+// NODE POOL RESET TESTS
+//***********************************************************************************************
+// ensure a reset releases every node at once and the pool can be used again
+START_TEST(test_node_pool_reset)
+{
+    node_pool_t *pool = node_pool_create(16, 0);
+
+    for (size_t idx = 0; idx < 1000; idx++)
+    {
+        node_pool_alloc(pool);
+    }
+
+    node_pool_reset(pool);
+    ck_assert_int_eq(node_pool_in_use(pool), 0);
+
+    ck_assert_ptr_ne(node_pool_alloc(pool), NULL);
+    ck_assert_int_eq(node_pool_in_use(pool), 1);
+
+    node_pool_reset(NULL);
+    node_pool_destroy(&pool);
+}
+END_TEST
+
+// TEST LIST
+static TFun node_pool_reset_tests[] =
+{
+    test_node_pool_reset,
+    NULL
+};
+
+static void add_tests(TCase * test_cases, TFun * test_functions)
+{
+    while (* test_functions)
+    {
+        // add the test from the core_tests array to the tcase
+        tcase_add_test(test_cases, * test_functions);
+        test_functions++;
+    }
+}
+
+Suite *node_pool_test_suite(void)
+{
+    Suite *node_pool_test_suite = suite_create("Node Pool Tests");
+
+    // Create node_pool_create() tests
+    TFun *node_pool_create_test_list = node_pool_create_tests;
+    TCase *node_pool_create_test_cases = tcase_create(" node_pool_create() Tests");
+    add_tests(node_pool_create_test_cases, node_pool_create_test_list);
+    suite_add_tcase(node_pool_test_suite, node_pool_create_test_cases);
+
+    // Create node_pool_alloc() / node_pool_free() tests
+    TFun *node_pool_alloc_test_list = node_pool_alloc_tests;
+    TCase *node_pool_alloc_test_cases = tcase_create(" node_pool_alloc() / node_pool_free() Tests");
+    add_tests(node_pool_alloc_test_cases, node_pool_alloc_test_list);
+    suite_add_tcase(node_pool_test_suite, node_pool_alloc_test_cases);
+
+    // Create node_pool_reset() tests
+    TFun *node_pool_reset_test_list = node_pool_reset_tests;
+    TCase *node_pool_reset_test_cases = tcase_create(" node_pool_reset() Tests");
+    add_tests(node_pool_reset_test_cases, node_pool_reset_test_list);
+    suite_add_tcase(node_pool_test_suite, node_pool_reset_test_cases);
+
+    return node_pool_test_suite;
+}
@@ -4,6 +4,7 @@
 
 #include "linked_lists/singly_linked_list.h"
 #include "void_pointer_functions.h"
+#include "utilities/comparison_helpers.h"
 #include "exit_codes.h"
 
 struct sll_node
@@ -17,6 +18,8 @@ struct singly_linked_list
     sll_node_t *head;
     sll_node_t *tail;
     size_t current_size;
+    node_pool_t *pool;
+    bool owns_pool;
 };
 
 // CREATE LIST TESTS
@@ -642,6 +645,347 @@ static TFun sll_remove_position_tests[] =
     NULL
 };
 
+// SLL POOL TESTS
+//***********************************************************************************************
+// ensure lists sharing a pool take nodes from it and hand them back for each other to reuse
+START_TEST(test_sll_create_with_pool)
+{
+    node_pool_t *pool = node_pool_create(sll_node_size(), 0);
+    singly_linked_list_t *first = sll_create_with_pool(pool);
+    singly_linked_list_t *second = sll_create_with_pool(pool);
+    ck_assert_ptr_ne(first, NULL);
+    ck_assert_ptr_ne(second, NULL);
+
+    int nums[] = {10, 20, 30};
+    for (size_t idx = 0; idx < 3; idx++)
+    {
+        ck_assert_int_eq(sll_push_tail(first, &nums[idx]), E_SUCCESS);
+        ck_assert_int_eq(sll_push_head(second, &nums[idx]), E_SUCCESS);
+    }
+    ck_assert_int_eq(node_pool_in_use(pool), 6);
+
+    ck_assert_int_eq(*((int *)sll_pop_head(first)), 10);
+    ck_assert_int_eq(node_pool_in_use(pool), 5);
+
+    ck_assert_int_eq(sll_push_tail(second, &nums[0]), E_SUCCESS);
+    ck_assert_int_eq(*((int *)sll_peek_tail(second)), 10);
+    ck_assert_int_eq(node_pool_in_use(pool), 6);
+
+    // Destroying one list returns only its own nodes
+    sll_destroy_list(&first);
+    ck_assert_int_eq(node_pool_in_use(pool), 4);
+    ck_assert_int_eq(*((int *)sll_peek_head(second)), 30);
+
+    sll_destroy_list(&second);
+    ck_assert_int_eq(node_pool_in_use(pool), 0);
+    node_pool_destroy(&pool);
+}
+END_TEST
+
+// ensure a pool whose nodes are too small is rejected
+START_TEST(test_sll_create_with_pool_small_nodes)
+{
+    node_pool_t *pool = node_pool_create(1, 0);
+
+    ck_assert_ptr_eq(sll_create_with_pool(pool), NULL);
+    ck_assert_ptr_eq(sll_create_with_pool(NULL), NULL);
+
+    node_pool_destroy(&pool);
+}
+END_TEST
+
+// TEST LIST
+static TFun sll_pool_tests[] =
+{
+    test_sll_create_with_pool,
+    test_sll_create_with_pool_small_nodes,
+    NULL
+};
+
+// SLL CURSOR TESTS
+//***********************************************************************************************
+// walks the list with a cursor and checks it holds exactly the expected values
+static void check_sll_values(singly_linked_list_t *list, const int *expected, size_t count)
+{
+    sll_cursor_t cursor;
+    ck_assert_int_eq(sll_cursor_head(list, &cursor), E_SUCCESS);
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        ck_assert_int_eq(*((int *)sll_cursor_get(&cursor)), expected[idx]);
+        ck_assert_int_eq(sll_cursor_next(&cursor), E_SUCCESS);
+    }
+
+    ck_assert_ptr_eq(sll_cursor_get(&cursor), NULL);
+    ck_assert_int_eq(list->current_size, count);
+}
+
+// ensure a cursor can erase while walking the list
+START_TEST(test_sll_cursor_erase_while_walking)
+{
+    singly_linked_list_t *list = sll_create();
+    int nums[] = {1, 2, 3, 4, 5, 6, 7, 8};
+
+    for (size_t idx = 0; idx < 8; idx++)
+    {
+        sll_push_tail(list, &nums[idx]);
+    }
+
+    sll_cursor_t cursor;
+    sll_cursor_head(list, &cursor);
+    while (NULL != sll_cursor_get(&cursor))
+    {
+        if (0 == *((int *)sll_cursor_get(&cursor)) % 2)
+        {
+            ck_assert_int_eq(sll_cursor_erase(&cursor), E_SUCCESS);
+        }
+        else
+        {
+            ck_assert_int_eq(sll_cursor_next(&cursor), E_SUCCESS);
+        }
+    }
+
+    int expected[] = {1, 3, 5, 7};
+    check_sll_values(list, expected, 4);
+    ck_assert_int_eq(*((int *)sll_peek_tail(list)), 7);
+
+    // Erasing everything from the head empties the list
+    sll_cursor_head(list, &cursor);
+    while (E_SUCCESS == sll_cursor_erase(&cursor))
+    {
+    }
+    ck_assert_ptr_eq(list->head, NULL);
+    ck_assert_ptr_eq(list->tail, NULL);
+    ck_assert_int_eq(list->current_size, 0);
+
+    sll_destroy_list(&list);
+}
+END_TEST
+
+// ensure a cursor inserts before and after itself, keeping the head and tail up to date
+START_TEST(test_sll_cursor_insert)
+{
+    singly_linked_list_t *list = sll_create();
+    int nums[] = {10, 20, 30, 40};
+
+    sll_cursor_t cursor;
+    sll_cursor_head(list, &cursor);
+
+    // Past the end of an empty list, insert_before appends
+    ck_assert_int_eq(sll_cursor_insert_before(&cursor, &nums[1]), E_SUCCESS);
+    ck_assert_ptr_eq(sll_cursor_get(&cursor), NULL);
+
+    sll_cursor_head(list, &cursor);
+    ck_assert_int_eq(sll_cursor_insert_after(&cursor, &nums[3]), E_SUCCESS);
+    ck_assert_int_eq(sll_cursor_insert_before(&cursor, &nums[0]), E_SUCCESS);
+    ck_assert_int_eq(*((int *)sll_cursor_get(&cursor)), 20);
+
+    sll_cursor_next(&cursor);
+    ck_assert_int_eq(sll_cursor_insert_before(&cursor, &nums[2]), E_SUCCESS);
+
+    int expected[] = {10, 20, 30, 40};
+    check_sll_values(list, expected, 4);
+    ck_assert_int_eq(*((int *)sll_peek_head(list)), 10);
+    ck_assert_int_eq(*((int *)sll_peek_tail(list)), 40);
+
+    // Erasing the tail leaves the cursor past the end, where it appends again
+    ck_assert_int_eq(sll_cursor_erase(&cursor), E_SUCCESS);
+    ck_assert_int_eq(*((int *)sll_peek_tail(list)), 30);
+    ck_assert_int_eq(sll_cursor_insert_before(&cursor, &nums[3]), E_SUCCESS);
+    check_sll_values(list, expected, 4);
+
+    sll_destroy_list(&list);
+}
+END_TEST
+
+// ensure a cursor past the end or without a list is rejected
+START_TEST(test_sll_cursor_errors)
+{
+    singly_linked_list_t *list = sll_create();
+    int num = 10;
+
+    sll_cursor_t cursor;
+    ck_assert_int_eq(sll_cursor_head(NULL, &cursor), E_LIST_ERROR);
+    ck_assert_int_eq(sll_cursor_head(list, NULL), E_NULL_POINTER);
+
+    sll_cursor_head(list, &cursor);
+    ck_assert_int_eq(sll_cursor_next(&cursor), E_OUT_OF_BOUNDS);
+    ck_assert_int_eq(sll_cursor_erase(&cursor), E_OUT_OF_BOUNDS);
+    ck_assert_int_eq(sll_cursor_insert_after(&cursor, &num), E_OUT_OF_BOUNDS);
+    ck_assert_int_eq(sll_cursor_insert_before(&cursor, NULL), E_NULL_POINTER);
+    ck_assert_int_eq(sll_cursor_next(NULL), E_NULL_POINTER);
+    ck_assert_ptr_eq(sll_cursor_get(NULL), NULL);
+
+    sll_destroy_list(&list);
+}
+END_TEST
+
+// TEST LIST
+static TFun sll_cursor_tests[] =
+{
+    test_sll_cursor_erase_while_walking,
+    test_sll_cursor_insert,
+    test_sll_cursor_errors,
+    NULL
+};
+
+// SLL SORT TESTS
+//***********************************************************************************************
+// orders ints and counts how often it is called, so tests can check presorted input stays near linear
+static int counting_int_comp_sll(const void *x, const void *y, const void *ctx)
+{
+    (*(size_t *)ctx)++;
+    return int_comp(x, y, NULL);
+}
+
+// orders sort_pair_t by key alone, so equal keys show whether the original order survived
+typedef struct sort_pair_sll
+{
+    int key;
+    int order;
+} sort_pair_sll_t;
+
+static int pair_key_comp_sll(const void *x, const void *y, const void *ctx)
+{
+    (void)ctx;
+    return ((const sort_pair_sll_t *)x)->key - ((const sort_pair_sll_t *)y)->key;
+}
+
+static int qsort_int_comp_sll(const void *x, const void *y)
+{
+    return *(const int *)x - *(const int *)y;
+}
+
+// ensure random values come out in the same order as qsort puts them
+START_TEST(test_sll_sort_random)
+{
+    enum { NUM_SORT = 2000 };
+    int *nums = malloc(NUM_SORT * sizeof(int));
+    int *expected = malloc(NUM_SORT * sizeof(int));
+    unsigned int seed = 99;
+    singly_linked_list_t *list = sll_create();
+
+    for (size_t idx = 0; idx < NUM_SORT; idx++)
+    {
+        seed = seed * 1103515245 + 12345;
+        nums[idx] = (int)((seed >> 16) % 500);
+        expected[idx] = nums[idx];
+        sll_push_tail(list, &nums[idx]);
+    }
+    qsort(expected, NUM_SORT, sizeof(int), qsort_int_comp_sll);
+
+    ck_assert_int_eq(sll_sort(list, &int_comp_ctx), E_SUCCESS);
+    ck_assert_int_eq(list->current_size, NUM_SORT);
+    ck_assert_int_eq(*((int *)sll_peek_tail(list)), expected[NUM_SORT - 1]);
+    ck_assert_ptr_eq(list->tail->next, NULL);
+
+    for (size_t idx = 0; idx < NUM_SORT; idx++)
+    {
+        ck_assert_int_eq(*((int *)sll_pop_head(list)), expected[idx]);
+    }
+
+    sll_destroy_list(&list);
+    free(nums);
+    free(expected);
+}
+END_TEST
+
+// ensure equal keys keep their original order, including inside descending runs
+START_TEST(test_sll_sort_stable)
+{
+    enum { NUM_PAIRS = 300 };
+    sort_pair_sll_t pairs[NUM_PAIRS];
+    compare_ctx by_key = {pair_key_comp_sll, NULL};
+    singly_linked_list_t *list = sll_create();
+
+    // Keys fall in steps of three equal values, then a few ascending stretches follow
+    for (int idx = 0; idx < NUM_PAIRS; idx++)
+    {
+        pairs[idx].key = (idx < 200) ? (200 - idx) / 3 : idx % 7;
+        pairs[idx].order = idx;
+        sll_push_tail(list, &pairs[idx]);
+    }
+
+    ck_assert_int_eq(sll_sort(list, &by_key), E_SUCCESS);
+
+    sort_pair_sll_t *previous = sll_pop_head(list);
+    for (size_t idx = 1; idx < NUM_PAIRS; idx++)
+    {
+        sort_pair_sll_t *current = sll_pop_head(list);
+        ck_assert_int_le(previous->key, current->key);
+        if (previous->key == current->key)
+        {
+            ck_assert_int_lt(previous->order, current->order);
+        }
+        previous = current;
+    }
+
+    sll_destroy_list(&list);
+}
+END_TEST
+
+// ensure sorted and reversed lists take about one comparison per node, and nearly sorted ones a few
+START_TEST(test_sll_sort_runs)
+{
+    enum { NUM_RUN = 5000 };
+    int *nums = malloc(NUM_RUN * sizeof(int));
+    size_t comparisons = 0;
+    compare_ctx counting = {counting_int_comp_sll, &comparisons};
+
+    for (int pass = 0; pass < 3; pass++)
+    {
+        singly_linked_list_t *list = sll_create();
+        for (int idx = 0; idx < NUM_RUN; idx++)
+        {
+            nums[idx] = (1 == pass) ? NUM_RUN - idx : idx;
+            sll_push_tail(list, &nums[idx]);
+        }
+
+        // The third pass swaps a handful of neighbours out of place
+        if (2 == pass)
+        {
+            for (int idx = 100; idx < NUM_RUN; idx += 1000)
+            {
+                nums[idx] = idx + 1;
+                nums[idx + 1] = idx;
+            }
+        }
+
+        // One run takes one comparison per node; the six runs of the third pass cost about log2(6) per node
+        comparisons = 0;
+        ck_assert_int_eq(sll_sort(list, &counting), E_SUCCESS);
+        ck_assert_uint_lt(comparisons, ((2 == pass) ? 4 : 2) * NUM_RUN);
+
+        for (int idx = 0; idx < NUM_RUN; idx++)
+        {
+            ck_assert_int_eq(*((int *)sll_pop_head(list)), (1 == pass) ? idx + 1 : idx);
+        }
+        sll_destroy_list(&list);
+    }
+
+    // Empty and single-node lists are already sorted; bad arguments are rejected
+    singly_linked_list_t *list = sll_create();
+    ck_assert_int_eq(sll_sort(list, &int_comp_ctx), E_SUCCESS);
+    sll_push_tail(list, &nums[0]);
+    ck_assert_int_eq(sll_sort(list, &int_comp_ctx), E_SUCCESS);
+    ck_assert_ptr_eq(sll_peek_head(list), sll_peek_tail(list));
+    ck_assert_int_eq(sll_sort(NULL, &int_comp_ctx), E_LIST_ERROR);
+    ck_assert_int_eq(sll_sort(list, NULL), E_NULL_POINTER);
+
+    sll_destroy_list(&list);
+    free(nums);
+}
+END_TEST
+
+// TEST LIST
+static TFun sll_sort_tests[] =
+{
+    test_sll_sort_random,
+    test_sll_sort_stable,
+    test_sll_sort_runs,
+    NULL
+};
+
 static void add_tests(TCase * test_cases, TFun * test_functions)
 {
     while (* test_functions)
@@ -734,5 +1078,23 @@ Suite *singly_linked_list_test_suite(void)
     add_tests(sll_remove_position_test_cases, sll_remove_position_test_list);
     suite_add_tcase(singly_linked_list_test_suite, sll_remove_position_test_cases);
 
+    //Create sll_create_with_pool tests
+    TFun *sll_pool_test_list = sll_pool_tests;
+    TCase *sll_pool_test_cases = tcase_create(" sll_create_with_pool() Tests");
+    add_tests(sll_pool_test_cases, sll_pool_test_list);
+    suite_add_tcase(singly_linked_list_test_suite, sll_pool_test_cases);
+
+    //Create sll cursor tests
+    TFun *sll_cursor_test_list = sll_cursor_tests;
+    TCase *sll_cursor_test_cases = tcase_create(" sll cursor Tests");
+    add_tests(sll_cursor_test_cases, sll_cursor_test_list);
+    suite_add_tcase(singly_linked_list_test_suite, sll_cursor_test_cases);
+
+    //Create sll sort tests
+    TFun *sll_sort_test_list = sll_sort_tests;
+    TCase *sll_sort_test_cases = tcase_create(" sll_sort() Tests");
+    add_tests(sll_sort_test_cases, sll_sort_test_list);
+    suite_add_tcase(singly_linked_list_test_suite, sll_sort_test_cases);
+
     return singly_linked_list_test_suite;
 }
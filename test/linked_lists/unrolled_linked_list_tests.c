@@ -0,0 +1,353 @@
+#include <check.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "linked_lists/unrolled_linked_list.h"
+#include "exit_codes.h"
+
+#define NUM_VALUES 200
+
+static int values[NUM_VALUES];
+
+// fills values with 0 .. NUM_VALUES - 1 so tests can push their addresses
+static void fill_values(void)
+{
+    for (int idx = 0; idx < NUM_VALUES; idx++)
+    {
+        values[idx] = idx;
+    }
+}
+
+// CREATE LIST TESTS
+//***********************************************************************************************
+// ensure a new unrolled list is created empty
+START_TEST(test_ull_create)
+{
+    unrolled_linked_list_t *list = ull_create();
+    ck_assert_ptr_ne(list, NULL);
+    ck_assert_int_eq(ull_size(list), 0);
+    ck_assert_int_eq(ull_node_count(list), 0);
+    ck_assert_ptr_eq(ull_peek_head(list), NULL);
+    ck_assert_ptr_eq(ull_peek_tail(list), NULL);
+
+    ull_destroy_list(&list);
+    ck_assert_ptr_eq(list, NULL);
+}
+END_TEST
+
+// ensure lists sharing a pool keep their own elements, and undersized pools are rejected
+START_TEST(test_ull_create_with_pool)
+{
+    fill_values();
+    node_pool_t *pool = node_pool_create(ull_node_size(), 0);
+    unrolled_linked_list_t *first = ull_create_with_pool(pool);
+    unrolled_linked_list_t *second = ull_create_with_pool(pool);
+
+    for (size_t idx = 0; idx < 50; idx++)
+    {
+        ull_push_tail((0 == idx % 2) ? first : second, &values[idx]);
+    }
+    ck_assert_int_eq(node_pool_in_use(pool), ull_node_count(first) + ull_node_count(second));
+
+    ull_destroy_list(&first);
+    ck_assert_int_eq(node_pool_in_use(pool), ull_node_count(second));
+    ck_assert_int_eq(*((int *)ull_peek_tail(second)), 49);
+    ull_destroy_list(&second);
+    ck_assert_int_eq(node_pool_in_use(pool), 0);
+    node_pool_destroy(&pool);
+
+    pool = node_pool_create(ull_node_size() / 2, 0);
+    ck_assert_ptr_eq(ull_create_with_pool(pool), NULL);
+    ck_assert_ptr_eq(ull_create_with_pool(NULL), NULL);
+    node_pool_destroy(&pool);
+}
+END_TEST
+
+// TEST LIST
+static TFun ull_create_tests[] =
+{
+    test_ull_create,
+    test_ull_create_with_pool,
+    NULL
+};
+
+// PUSH TESTS
+//***********************************************************************************************
+// ensure pushes at either end fill nodes completely before starting a new one
+START_TEST(test_ull_push_fills_nodes)
+{
+    fill_values();
+    unrolled_linked_list_t *list = ull_create();
+
+    for (size_t idx = 0; idx < 3 * ULL_NODE_CAPACITY; idx++)
+    {
+        ck_assert_int_eq(ull_push_tail(list, &values[idx]), E_SUCCESS);
+    }
+    ck_assert_int_eq(ull_size(list), 3 * ULL_NODE_CAPACITY);
+    ck_assert_int_eq(ull_node_count(list), 3);
+
+    ck_assert_int_eq(ull_push_head(list, &values[199]), E_SUCCESS);
+    ck_assert_int_eq(ull_node_count(list), 4);
+    ck_assert_int_eq(*((int *)ull_peek_head(list)), 199);
+    ck_assert_int_eq(*((int *)ull_peek_tail(list)), 3 * ULL_NODE_CAPACITY - 1);
+
+    for (size_t idx = 0; idx < 3 * ULL_NODE_CAPACITY; idx++)
+    {
+        ck_assert_int_eq(*((int *)ull_peek_position(list, idx + 2)), idx);
+    }
+
+    ull_destroy_list(&list);
+}
+END_TEST
+
+// ensure pushes reject missing lists and data
+START_TEST(test_ull_push_errors)
+{
+    unrolled_linked_list_t *list = ull_create();
+    int num = 1;
+
+    ck_assert_int_eq(ull_push_head(NULL, &num), E_LIST_ERROR);
+    ck_assert_int_eq(ull_push_tail(NULL, &num), E_LIST_ERROR);
+    ck_assert_int_eq(ull_push_head(list, NULL), E_NULL_POINTER);
+    ck_assert_int_eq(ull_push_tail(list, NULL), E_NULL_POINTER);
+    ck_assert_int_eq(ull_push_position(list, &num, 1), E_OUT_OF_BOUNDS);
+
+    ull_push_tail(list, &num);
+    ck_assert_int_eq(ull_push_position(list, &num, 0), E_OUT_OF_BOUNDS);
+    ck_assert_int_eq(ull_push_position(list, &num, 2), E_OUT_OF_BOUNDS);
+    ck_assert_int_eq(ull_size(list), 1);
+
+    ull_destroy_list(&list);
+}
+END_TEST
+
+// TEST LIST
+static TFun ull_push_tests[] =
+{
+    test_ull_push_fills_nodes,
+    test_ull_push_errors,
+    NULL
+};
+
+// POSITION TESTS
+//***********************************************************************************************
+// ensure inserting into a full node splits it and keeps every element in order
+START_TEST(test_ull_push_position_splits)
+{
+    fill_values();
+    unrolled_linked_list_t *list = ull_create();
+
+    // Even values first, then the odd ones slotted in between them
+    for (size_t idx = 0; idx < NUM_VALUES; idx += 2)
+    {
+        ull_push_tail(list, &values[idx]);
+    }
+    for (size_t idx = 1; idx < NUM_VALUES - 1; idx += 2)
+    {
+        ck_assert_int_eq(ull_push_position(list, &values[idx], idx + 1), E_SUCCESS);
+    }
+    ck_assert_int_eq(*((int *)ull_peek_tail(list)), NUM_VALUES - 2);
+    ull_push_tail(list, &values[NUM_VALUES - 1]);
+
+    ck_assert_int_eq(ull_size(list), NUM_VALUES);
+    for (size_t idx = 0; idx < NUM_VALUES; idx++)
+    {
+        ck_assert_int_eq(*((int *)ull_peek_position(list, idx + 1)), idx);
+    }
+
+    // Split nodes are never less than half full
+    ck_assert_uint_le(ull_node_count(list), 2 * NUM_VALUES / ULL_NODE_CAPACITY + 1);
+
+    ull_destroy_list(&list);
+}
+END_TEST
+
+// ensure a mix of positional edits matches a plain array doing the same edits
+START_TEST(test_ull_position_matches_array)
+{
+    fill_values();
+    unrolled_linked_list_t *list = ull_create();
+    int *model[NUM_VALUES];
+    size_t model_size = 0;
+    unsigned int seed = 12345;
+
+    for (size_t step = 0; step < 4000; step++)
+    {
+        seed = seed * 1103515245 + 12345;
+        size_t roll = (seed >> 16) % 100;
+
+        if ((model_size < 2) || ((roll < 55) && (model_size < NUM_VALUES)))
+        {
+            int *data = &values[step % NUM_VALUES];
+            if (0 == model_size)
+            {
+                ck_assert_int_eq(ull_push_tail(list, data), E_SUCCESS);
+                model[model_size++] = data;
+                continue;
+            }
+
+            size_t position = 1 + ((seed >> 8) % model_size);
+            ck_assert_int_eq(ull_push_position(list, data, position), E_SUCCESS);
+            for (size_t idx = model_size; idx >= position; idx--)
+            {
+                model[idx] = model[idx - 1];
+            }
+            model[position - 1] = data;
+            model_size++;
+        }
+        else
+        {
+            size_t position = 1 + ((seed >> 8) % model_size);
+            ck_assert_ptr_eq(ull_pop_position(list, position), model[position - 1]);
+            for (size_t idx = position - 1; idx + 1 < model_size; idx++)
+            {
+                model[idx] = model[idx + 1];
+            }
+            model_size--;
+        }
+
+        ck_assert_int_eq(ull_size(list), model_size);
+    }
+
+    for (size_t idx = 0; idx < model_size; idx++)
+    {
+        ck_assert_ptr_eq(ull_peek_position(list, idx + 1), model[idx]);
+    }
+    ck_assert_ptr_eq(ull_peek_tail(list), model[model_size - 1]);
+
+    ull_destroy_list(&list);
+}
+END_TEST
+
+// TEST LIST
+static TFun ull_position_tests[] =
+{
+    test_ull_push_position_splits,
+    test_ull_position_matches_array,
+    NULL
+};
+
+// POP AND REMOVE TESTS
+//***********************************************************************************************
+// ensure popping from both ends drains the list in order and frees emptied nodes
+START_TEST(test_ull_pop_ends)
+{
+    fill_values();
+    unrolled_linked_list_t *list = ull_create();
+
+    for (size_t idx = 0; idx < NUM_VALUES; idx++)
+    {
+        ull_push_tail(list, &values[idx]);
+    }
+
+    for (size_t idx = 0; idx < NUM_VALUES / 2; idx++)
+    {
+        ck_assert_int_eq(*((int *)ull_pop_head(list)), idx);
+        ck_assert_int_eq(*((int *)ull_pop_tail(list)), NUM_VALUES - 1 - idx);
+    }
+
+    ck_assert_int_eq(ull_size(list), 0);
+    ck_assert_int_eq(ull_node_count(list), 0);
+    ck_assert_ptr_eq(ull_pop_head(list), NULL);
+    ck_assert_ptr_eq(ull_pop_tail(list), NULL);
+
+    // The list is usable again once empty
+    ull_push_head(list, &values[7]);
+    ck_assert_ptr_eq(ull_peek_head(list), ull_peek_tail(list));
+
+    ull_destroy_list(&list);
+}
+END_TEST
+
+// ensure removals merge neighbouring nodes once their elements fit in one
+START_TEST(test_ull_remove_merges)
+{
+    fill_values();
+    unrolled_linked_list_t *list = ull_create();
+
+    for (size_t idx = 0; idx < 4 * ULL_NODE_CAPACITY; idx++)
+    {
+        ull_push_tail(list, &values[idx]);
+    }
+    ck_assert_int_eq(ull_node_count(list), 4);
+
+    // Thin the first node down to one element; a full second node does not fit in with it yet
+    for (size_t idx = 0; idx < ULL_NODE_CAPACITY - 1; idx++)
+    {
+        ck_assert_int_eq(ull_remove_position(list, 2), E_SUCCESS);
+    }
+    ck_assert_int_eq(ull_node_count(list), 4);
+
+    // One removal from the second node lets it merge back into the first
+    ck_assert_int_eq(ull_remove_position(list, 2), E_SUCCESS);
+    ck_assert_int_eq(ull_node_count(list), 3);
+    ck_assert_int_eq(*((int *)ull_peek_position(list, 1)), 0);
+    ck_assert_int_eq(*((int *)ull_peek_position(list, 2)), ULL_NODE_CAPACITY + 1);
+
+    ck_assert_int_eq(ull_remove_head(list), E_SUCCESS);
+    ck_assert_int_eq(ull_remove_tail(list), E_SUCCESS);
+    ck_assert_int_eq(ull_size(list), 3 * ULL_NODE_CAPACITY - 2);
+    ck_assert_int_eq(*((int *)ull_peek_head(list)), ULL_NODE_CAPACITY + 1);
+    ck_assert_int_eq(*((int *)ull_peek_tail(list)), 4 * ULL_NODE_CAPACITY - 2);
+
+    ck_assert_int_eq(ull_remove_position(list, 0), E_OUT_OF_BOUNDS);
+    ck_assert_int_eq(ull_remove_position(list, ull_size(list) + 1), E_OUT_OF_BOUNDS);
+
+    ull_clear_list(&list);
+    ck_assert_int_eq(ull_size(list), 0);
+    ck_assert_int_eq(ull_remove_head(list), E_LIST_ERROR);
+    ck_assert_int_eq(ull_remove_tail(list), E_LIST_ERROR);
+    ck_assert_int_eq(ull_remove_position(NULL, 1), E_LIST_ERROR);
+
+    ull_destroy_list(&list);
+}
+END_TEST
+
+// TEST LIST
+static TFun ull_pop_tests[] =
+{
+    test_ull_pop_ends,
+    test_ull_remove_merges,
+    NULL
+};
+
+static void add_tests(TCase * test_cases, TFun * test_functions)
+{
+    while (* test_functions)
+    {
+        // add the test from the core_tests array to the tcase
+        tcase_add_test(test_cases, * test_functions);
+        test_functions++;
+    }
+}
+
+Suite *unrolled_linked_list_test_suite(void)
+{
+    Suite *unrolled_linked_list_test_suite = suite_create("Unrolled Linked List Tests");
+
+    // Create ull_create() tests
+    TFun *ull_create_test_list = ull_create_tests;
+    TCase *ull_create_test_cases = tcase_create(" ull_create() Tests");
+    add_tests(ull_create_test_cases, ull_create_test_list);
+    suite_add_tcase(unrolled_linked_list_test_suite, ull_create_test_cases);
+
+    // Create ull_push_head() / ull_push_tail() tests
+    TFun *ull_push_test_list = ull_push_tests;
+    TCase *ull_push_test_cases = tcase_create(" ull_push_head() / ull_push_tail() Tests");
+    add_tests(ull_push_test_cases, ull_push_test_list);
+    suite_add_tcase(unrolled_linked_list_test_suite, ull_push_test_cases);
+
+    // Create ull_push_position() / ull_pop_position() tests
+    TFun *ull_position_test_list = ull_position_tests;
+    TCase *ull_position_test_cases = tcase_create(" ull_push_position() / ull_pop_position() Tests");
+    add_tests(ull_position_test_cases, ull_position_test_list);
+    suite_add_tcase(unrolled_linked_list_test_suite, ull_position_test_cases);
+
+    // Create ull_pop_head() / ull_pop_tail() / ull_remove() tests
+    TFun *ull_pop_test_list = ull_pop_tests;
+    TCase *ull_pop_test_cases = tcase_create(" ull_pop_head() / ull_pop_tail() / ull_remove() Tests");
+    add_tests(ull_pop_test_cases, ull_pop_test_list);
+    suite_add_tcase(unrolled_linked_list_test_suite, ull_pop_test_cases);
+
+    return unrolled_linked_list_test_suite;
+}
@@ -0,0 +1,260 @@
+#include <check.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "segmented_array_list.h"
+#include "exit_codes.h"
+#include "utilities/comparison_helpers.h"
+
+// CREATE LIST TESTS
+//***********************************************************************************************
+// ensure a new segmented array list is created
+START_TEST(test_segmented_list_create)
+{
+    segmented_array_list_t *list = segmented_list_create(NULL, NULL);
+    ck_assert_ptr_ne(list, NULL);
+    ck_assert(segmented_list_is_empty(list));
+
+    segmented_list_destroy(&list);
+    ck_assert_ptr_eq(list, NULL);
+}
+END_TEST
+
+// ensure a zero element size is rejected
+START_TEST(test_segmented_list_create_typed_zero_size)
+{
+    segmented_array_list_t *list = segmented_list_create_typed(0, NULL, NULL);
+    ck_assert_ptr_eq(list, NULL);
+}
+END_TEST
+
+// TEST LIST
+static TFun segmented_list_create_tests[] =
+{
+    test_segmented_list_create,
+    test_segmented_list_create_typed_zero_size,
+    NULL
+};
+
+// PUSH TESTS
+//***********************************************************************************************
+START_TEST(test_segmented_list_push_NULL)
+{
+    int num = 10;
+    segmented_array_list_t *list = segmented_list_create(NULL, NULL);
+
+    ck_assert_int_eq(segmented_list_push(NULL, &num), E_LIST_ERROR);
+    ck_assert_int_eq(segmented_list_push(list, NULL), E_NULL_POINTER);
+
+    segmented_list_destroy(&list);
+}
+END_TEST
+
+// ensure pointers are stored across several segments
+START_TEST(test_segmented_list_push_pointers)
+{
+    int num_array[100];
+    segmented_array_list_t *list = segmented_list_create(NULL, &int_eq_ctx);
+
+    for (int idx = 0; idx < 100; idx++)
+    {
+        num_array[idx] = idx * 3;
+        ck_assert_int_eq(segmented_list_push(list, &num_array[idx]), E_SUCCESS);
+    }
+
+    ck_assert_int_eq(segmented_list_size(list), 100);
+
+    for (size_t idx = 0; idx < 100; idx++)
+    {
+        ck_assert_ptr_eq(segmented_list_get(list, idx), &num_array[idx]);
+    }
+
+    ck_assert_ptr_eq(segmented_list_get(list, 100), NULL);
+
+    int present = 297;
+    int absent = 298;
+    ck_assert(segmented_list_contains(list, &present));
+    ck_assert(!segmented_list_contains(list, &absent));
+
+    segmented_list_destroy(&list);
+}
+END_TEST
+
+// ensure slot addresses do not move while the list grows
+START_TEST(test_segmented_list_stable_addresses)
+{
+    segmented_array_list_t *list = segmented_list_create_typed(sizeof(size_t), NULL, NULL);
+
+    size_t value = 0;
+    segmented_list_push(list, &value);
+    size_t *first = segmented_list_get(list, 0);
+
+    value = 7;
+    segmented_list_push(list, &value);
+    size_t *second = segmented_list_get(list, 1);
+
+    for (value = 2; value < 50000; value++)
+    {
+        ck_assert_int_eq(segmented_list_push(list, &value), E_SUCCESS);
+    }
+
+    ck_assert_ptr_eq(segmented_list_get(list, 0), first);
+    ck_assert_ptr_eq(segmented_list_get(list, 1), second);
+    ck_assert_uint_eq(*second, 7);
+
+    for (size_t idx = 2; idx < 50000; idx += 331)
+    {
+        ck_assert_uint_eq(*((size_t *)segmented_list_get(list, idx)), idx);
+    }
+
+    segmented_list_destroy(&list);
+}
+END_TEST
+
+// TEST LIST
+static TFun segmented_list_push_tests[] =
+{
+    test_segmented_list_push_NULL,
+    test_segmented_list_push_pointers,
+    test_segmented_list_stable_addresses,
+    NULL
+};
+
+// SET / POP TESTS
+//***********************************************************************************************
+static int destroy_count = 0;
+
+static void count_destroy(void *data, const void *context)
+{
+    (void) data;
+    (void) context;
+    destroy_count++;
+}
+
+static destroy_ctx count_destroy_ctx = {count_destroy, NULL, NULL};
+
+static void count_destroy_many(void **items, size_t count, const void *context)
+{
+    (void) items;
+    (void) context;
+    destroy_count += (int)count;
+}
+
+static destroy_ctx count_destroy_many_ctx = {NULL, NULL, count_destroy_many};
+
+// ensure set replaces in place and destroys the old element
+START_TEST(test_segmented_list_set)
+{
+    destroy_count = 0;
+    segmented_array_list_t *list = segmented_list_create_typed(sizeof(int), &count_destroy_ctx, NULL);
+
+    int num = 1;
+    segmented_list_push(list, &num);
+    int *slot = segmented_list_get(list, 0);
+
+    num = 42;
+    ck_assert_int_eq(segmented_list_set(list, 0, &num), E_SUCCESS);
+    ck_assert_int_eq(destroy_count, 1);
+    ck_assert_ptr_eq(segmented_list_get(list, 0), slot);
+    ck_assert_int_eq(*slot, 42);
+
+    ck_assert_int_eq(segmented_list_set(list, 1, &num), E_OUT_OF_BOUNDS);
+
+    segmented_list_destroy(&list);
+    ck_assert_int_eq(destroy_count, 2);
+}
+END_TEST
+
+// ensure pop removes the last element and keeps the slot for the next push
+START_TEST(test_segmented_list_pop)
+{
+    destroy_count = 0;
+    segmented_array_list_t *list = segmented_list_create_typed(sizeof(int), &count_destroy_ctx, NULL);
+
+    ck_assert_int_eq(segmented_list_pop(list), E_LIST_ERROR);
+
+    for (int num = 0; num < 9; num++)
+    {
+        segmented_list_push(list, &num);
+    }
+
+    int *last = segmented_list_get(list, 8);
+
+    ck_assert_int_eq(segmented_list_pop(list), E_SUCCESS);
+    ck_assert_int_eq(segmented_list_size(list), 8);
+    ck_assert_int_eq(destroy_count, 1);
+
+    int num = 99;
+    segmented_list_push(list, &num);
+    ck_assert_ptr_eq(segmented_list_get(list, 8), last);
+    ck_assert_int_eq(*last, 99);
+
+    segmented_list_destroy(&list);
+    ck_assert_int_eq(destroy_count, 10);
+}
+END_TEST
+
+// ensure a ctx with only destroy_many still frees elements dropped one at a time
+START_TEST(test_segmented_list_destroy_many_only)
+{
+    destroy_count = 0;
+    segmented_array_list_t *list = segmented_list_create_typed(sizeof(int), &count_destroy_many_ctx, NULL);
+
+    for (int num = 0; num < 5; num++)
+    {
+        segmented_list_push(list, &num);
+    }
+
+    int num = 7;
+    ck_assert_int_eq(segmented_list_set(list, 0, &num), E_SUCCESS);
+    ck_assert_int_eq(segmented_list_pop(list), E_SUCCESS);
+    ck_assert_int_eq(destroy_count, 2);
+
+    segmented_list_destroy(&list);
+    ck_assert_int_eq(destroy_count, 6);
+}
+END_TEST
+
+// TEST LIST
+static TFun segmented_list_modify_tests[] =
+{
+    test_segmented_list_set,
+    test_segmented_list_pop,
+    test_segmented_list_destroy_many_only,
+    NULL
+};
+
+static void add_tests(TCase * test_cases, TFun * test_functions)
+{
+    while (* test_functions)
+    {
+        // add the test from the core_tests array to the tcase
+        tcase_add_test(test_cases, * test_functions);
+        test_functions++;
+    }
+}
+
+Suite *segmented_array_list_test_suite(void)
+{
+    Suite *segmented_array_list_test_suite = suite_create("Segmented Array List Tests");
+
+    // Create segmented_list_create tests
+    TFun *segmented_list_create_test_list = segmented_list_create_tests;
+    TCase *segmented_list_create_test_cases = tcase_create(" segmented_list_create() Tests");
+    add_tests(segmented_list_create_test_cases, segmented_list_create_test_list);
+    suite_add_tcase(segmented_array_list_test_suite, segmented_list_create_test_cases);
+
+    // Create segmented_list_push tests
+    TFun *segmented_list_push_test_list = segmented_list_push_tests;
+    TCase *segmented_list_push_test_cases = tcase_create(" segmented_list_push() Tests");
+    add_tests(segmented_list_push_test_cases, segmented_list_push_test_list);
+    suite_add_tcase(segmented_array_list_test_suite, segmented_list_push_test_cases);
+
+    // Create segmented_list_set/pop tests
+    TFun *segmented_list_modify_test_list = segmented_list_modify_tests;
+    TCase *segmented_list_modify_test_cases = tcase_create(" segmented_list_set()/pop() Tests");
+    add_tests(segmented_list_modify_test_cases, segmented_list_modify_test_list);
+    suite_add_tcase(segmented_array_list_test_suite, segmented_list_modify_test_cases);
+
+    return segmented_array_list_test_suite;
+}